@@ -0,0 +1,58 @@
+# The FamiTracker library is built on the Qt port of MFC so it needs gui,
+# but the exporter itself never creates a widget.
+QT = core gui
+
+TOP = ../..
+
+TARGET = ftmexport
+TEMPLATE = app
+
+CONFIG += console
+CONFIG -= app_bundle
+
+CONFIG(release, debug|release) {
+   LIB_BUILD_TYPE_DIR = release
+} else {
+   LIB_BUILD_TYPE_DIR = debug
+}
+
+FAMITRACKER_LIBS = \
+    -L$$TOP/libs/famitracker/$${LIB_BUILD_TYPE_DIR} \
+    -L$$TOP/libs/famitracker/ \
+    -lfamitracker
+
+win32 {
+   FAMITRACKER_CXXFLAGS = -I$$TOP/libs/famitracker
+}
+
+mac {
+   CONFIG(release, debug|release) {
+      DESTDIR = release
+      OBJECTS_DIR = release
+   } else {
+      DESTDIR = debug
+      OBJECTS_DIR = debug
+   }
+
+   FAMITRACKER_CXXFLAGS = -I$$TOP/libs/famitracker -I$$TOP/deps/osx/wine/include
+
+   QMAKE_CFLAGS += -DWINE_UNICODE_NATIVE
+   QMAKE_CXXFLAGS += -DWINE_UNICODE_NATIVE
+}
+
+unix:!mac {
+   FAMITRACKER_CXXFLAGS = -I$$TOP/libs/famitracker -I/usr/include/wine/windows/
+
+   QMAKE_CFLAGS += -DWINE_UNICODE_NATIVE
+   QMAKE_CXXFLAGS += -DWINE_UNICODE_NATIVE
+}
+
+QMAKE_CXXFLAGS += -DIDE \
+                  $$FAMITRACKER_CXXFLAGS
+LIBS += $$FAMITRACKER_LIBS
+
+INCLUDEPATH += \
+   $$TOP/common
+
+SOURCES += \
+   main.cpp
@@ -0,0 +1,315 @@
+#include <QCoreApplication>
+#include <QStringList>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QDir>
+#include <QRunnable>
+#include <QThreadPool>
+
+#include <stdio.h>
+
+#include "stdafx.h"
+#include "FamiTracker.h"
+#include "FamiTrackerDoc.h"
+#include "Compiler.h"
+#include "cqtmfc_famitracker.h"
+
+// Converts FamiTracker modules to NSF, NES, BIN, PRG or ASM without the
+// tracker GUI, for build pipelines.
+//
+// ftmexport [-f nsf|nes|bin|prg|asm] [-ntsc|-pal|-dual] [-o DIR] [-j N] [-v]
+//           module.ftm ...
+//
+// Each module is loaded into its own document and compiled on a pool
+// thread.  Output files are named after the module and written next to it
+// unless -o is given.  BIN exports also write <name>_samples.bin when the
+// module has DPCM samples.  The exit status is non-zero if any module
+// failed to export.
+
+enum
+{
+   FORMAT_NSF,
+   FORMAT_NES,
+   FORMAT_BIN,
+   FORMAT_PRG,
+   FORMAT_ASM
+};
+
+static const char* FORMAT_NAMES [] = { "nsf", "nes", "bin", "prg", "asm" };
+
+// Machine selection, by default the module's own setting is used.
+enum
+{
+   MACHINE_MODULE = -1,
+   MACHINE_NTSC_NSF = 0,
+   MACHINE_PAL_NSF,
+   MACHINE_DUAL_NSF
+};
+
+typedef struct _ExportJob
+{
+   QString module;
+   QString output;
+   QString log;
+   QString error;
+   qint64  nsecs;
+   bool    ok;
+} ExportJob;
+
+// Collects the compiler's log for one module so concurrent exports don't
+// interleave their output.
+class CStringLog : public CCompilerLog
+{
+public:
+   void WriteLog(LPCTSTR text)
+   {
+      m_text += QString::fromLatin1(text).remove('\r');
+   }
+   void Clear()
+   {
+      m_text.clear();
+   }
+   const QString& text() const
+   {
+      return m_text;
+   }
+
+protected:
+   QString m_text;
+};
+
+class CExportTask : public QRunnable
+{
+public:
+   CExportTask(ExportJob* job,int format,int machine)
+      : m_job(job),
+        m_format(format),
+        m_machine(machine)
+   {
+   }
+
+   void run();
+
+protected:
+   ExportJob* m_job;
+   int        m_format;
+   int        m_machine;
+};
+
+void CExportTask::run()
+{
+   QElapsedTimer    timer;
+   CStringLog       log;
+   CFamiTrackerDoc* pDoc;
+   QString          samples;
+   bool             pal;
+   int              machine;
+
+   timer.start();
+
+   m_job->ok = false;
+
+   pDoc = CFamiTrackerDoc::LoadImportFile(CString(m_job->module));
+   if ( !pDoc )
+   {
+      m_job->error = "cannot load module";
+      m_job->nsecs = timer.nsecsElapsed();
+      return;
+   }
+
+   machine = m_machine;
+   if ( machine == MACHINE_MODULE )
+   {
+      machine = (pDoc->GetMachine() == PAL)?MACHINE_PAL_NSF:MACHINE_NTSC_NSF;
+   }
+   pal = (machine == MACHINE_PAL_NSF);
+
+   // Each compiler object may only be used once.
+   CCompiler compiler(pDoc,&log);
+
+   switch ( m_format )
+   {
+   case FORMAT_NSF:
+      m_job->ok = compiler.ExportNSF(CString(m_job->output),machine);
+      break;
+   case FORMAT_NES:
+      m_job->ok = compiler.ExportNES(CString(m_job->output),pal);
+      break;
+   case FORMAT_BIN:
+      if ( pDoc->GetSampleCount() > 0 )
+      {
+         QFileInfo fileInfo(m_job->output);
+         samples = QFileInfo(fileInfo.dir(),fileInfo.completeBaseName()+"_samples.bin").filePath();
+      }
+      m_job->ok = compiler.ExportBIN(CString(m_job->output),CString(samples));
+      break;
+   case FORMAT_PRG:
+      m_job->ok = compiler.ExportPRG(CString(m_job->output),pal);
+      break;
+   case FORMAT_ASM:
+      m_job->ok = compiler.ExportASM(CString(m_job->output));
+      break;
+   }
+
+   delete pDoc;
+
+   m_job->log = log.text();
+   if ( !m_job->ok )
+   {
+      m_job->error = "export failed";
+   }
+   m_job->nsecs = timer.nsecsElapsed();
+}
+
+static void usage()
+{
+   fprintf(stderr,"usage: ftmexport [-f nsf|nes|bin|prg|asm] [-ntsc|-pal|-dual] [-o DIR] [-j N] [-v] module.ftm ...\n");
+}
+
+int main(int argc, char* argv[])
+{
+   QCoreApplication app(argc, argv);
+   QStringList      args = app.arguments();
+   QStringList      modules;
+   QList<ExportJob> jobs;
+   QString          outDir;
+   QElapsedTimer    timer;
+   int              format = FORMAT_NSF;
+   int              machine = MACHINE_MODULE;
+   int              threads = 0;
+   bool             verbose = false;
+   int              failed = 0;
+   int              idx;
+   int              fmt;
+
+   for ( idx = 1; idx < args.count(); idx++ )
+   {
+      if ( (args.at(idx) == "-f") && (idx+1 < args.count()) )
+      {
+         idx++;
+         for ( fmt = FORMAT_NSF; fmt <= FORMAT_ASM; fmt++ )
+         {
+            if ( args.at(idx) == FORMAT_NAMES[fmt] )
+            {
+               break;
+            }
+         }
+         if ( fmt > FORMAT_ASM )
+         {
+            usage();
+            return 1;
+         }
+         format = fmt;
+      }
+      else if ( args.at(idx) == "-ntsc" )
+      {
+         machine = MACHINE_NTSC_NSF;
+      }
+      else if ( args.at(idx) == "-pal" )
+      {
+         machine = MACHINE_PAL_NSF;
+      }
+      else if ( args.at(idx) == "-dual" )
+      {
+         machine = MACHINE_DUAL_NSF;
+      }
+      else if ( (args.at(idx) == "-o") && (idx+1 < args.count()) )
+      {
+         outDir = args.at(++idx);
+      }
+      else if ( (args.at(idx) == "-j") && (idx+1 < args.count()) )
+      {
+         threads = args.at(++idx).toInt();
+      }
+      else if ( args.at(idx) == "-v" )
+      {
+         verbose = true;
+      }
+      else if ( args.at(idx).startsWith("-") )
+      {
+         usage();
+         return 1;
+      }
+      else
+      {
+         modules.append(args.at(idx));
+      }
+   }
+
+   if ( modules.isEmpty() )
+   {
+      usage();
+      return 1;
+   }
+   if ( (machine == MACHINE_DUAL_NSF) && (format != FORMAT_NSF) )
+   {
+      fprintf(stderr,"ftmexport: -dual is only available for NSF files\n");
+      return 1;
+   }
+   if ( (!outDir.isEmpty()) && (!QDir().mkpath(outDir)) )
+   {
+      fprintf(stderr,"ftmexport: cannot create %s\n",outDir.toLatin1().constData());
+      return 1;
+   }
+
+   // Loading reports errors through the string table.
+   qtMfcInitStringResources();
+
+   for ( idx = 0; idx < modules.count(); idx++ )
+   {
+      QFileInfo fileInfo(modules.at(idx));
+      ExportJob job;
+
+      job.module = modules.at(idx);
+      job.output = QFileInfo(outDir.isEmpty()?fileInfo.dir():QDir(outDir),
+                             fileInfo.completeBaseName()+"."+FORMAT_NAMES[format]).filePath();
+      job.nsecs = 0;
+      job.ok = false;
+      jobs.append(job);
+   }
+
+   // The job list is not resized from here on so the tasks can hold
+   // pointers into it.
+   QThreadPool pool;
+   if ( threads > 0 )
+   {
+      pool.setMaxThreadCount(threads);
+   }
+
+   timer.start();
+   for ( idx = 0; idx < jobs.count(); idx++ )
+   {
+      pool.start(new CExportTask(&jobs[idx],format,machine));
+   }
+   pool.waitForDone();
+
+   // Report in command line order.
+   for ( idx = 0; idx < jobs.count(); idx++ )
+   {
+      const ExportJob& job = jobs.at(idx);
+
+      if ( verbose )
+      {
+         fprintf(stdout,"%s",job.log.toLatin1().constData());
+      }
+      if ( job.ok )
+      {
+         fprintf(stdout,"%s -> %s (%.3f ms)\n",
+                 job.module.toLatin1().constData(),
+                 job.output.toLatin1().constData(),
+                 job.nsecs/1000000.0);
+      }
+      else
+      {
+         fprintf(stderr,"ftmexport: %s: %s\n",
+                 job.module.toLatin1().constData(),
+                 job.error.toLatin1().constData());
+         failed++;
+      }
+   }
+   fprintf(stdout,"%d of %d modules exported in %.3f ms using %d threads\n",
+           jobs.count()-failed,jobs.count(),
+           timer.nsecsElapsed()/1000000.0,pool.maxThreadCount());
+
+   return failed?1:0;
+}
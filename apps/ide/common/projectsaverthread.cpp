@@ -0,0 +1,33 @@
+#include "projectsaverthread.h"
+
+#include "main.h"
+
+ProjectSaverThread::ProjectSaverThread(QObject*)
+{
+   qRegisterMetaType<QDomDocument>("QDomDocument");
+
+   pThread = new QThread();
+
+   moveToThread(pThread);
+
+   pThread->start();
+}
+
+ProjectSaverThread::~ProjectSaverThread()
+{
+   pThread->terminate();
+   pThread->wait();
+   delete pThread;
+}
+
+void ProjectSaverThread::save(QString fileName, QDomDocument doc)
+{
+   CProjectArchive* pArchive = nesicideProject->getProjectArchive();
+   QString errors;
+   bool ok;
+
+   ok = pArchive->write(fileName,doc,errors);
+   pArchive->endSave();
+
+   emit saveDone(ok,errors);
+}
@@ -0,0 +1,26 @@
+#ifndef PROJECTSAVERTHREAD_H
+#define PROJECTSAVERTHREAD_H
+
+#include <QThread>
+#include <QDomDocument>
+
+class ProjectSaverThread : public QObject
+{
+   Q_OBJECT
+public:
+   ProjectSaverThread ( QObject* parent = 0 );
+   virtual ~ProjectSaverThread ();
+
+public slots:
+   void save(QString fileName, QDomDocument doc);
+
+signals:
+   void saveDone(bool ok, QString errors);
+
+protected:
+   QThread* pThread;
+};
+
+Q_DECLARE_METATYPE(QDomDocument)
+
+#endif // PROJECTSAVERTHREAD_H
@@ -1,27 +1,52 @@
 #include "ccc65interface.h"
 
+#include <QCryptographicHash>
+#include <QSet>
+#include <QTextStream>
+
 #include "cnesicideproject.h"
 #include "iprojecttreeviewitem.h"
 
 #include "dbg_cnes6502.h"
 
+#include "compilerthread.h"
+#include "cobjectregistry.h"
+
 #include "main.h"
 
 cc65_dbginfo        CCC65Interface::dbgInfo = NULL;
 QStringList         CCC65Interface::errors;
 QString             CCC65Interface::targetMachine = "none";
+int                 CCC65Interface::targetMachineType = CCC65Interface::Target_None;
+volatile bool       CCC65Interface::cancelRequested = false;
+QTime               CCC65Interface::buildTime;
+QHash<QString,int>  CCC65Interface::compileStartTimes;
+CCC65Interface::BuildFileState CCC65Interface::dbgInfoState;
+int                 CCC65Interface::dbgInfoRevision = 0;
+QReadWriteLock      CCC65Interface::addressIndexLock;
+QVector<CCC65Interface::SpanIndexEntry> CCC65Interface::spanIndex;
+int                 CCC65Interface::spanIndexRootLevel = -1;
+QVector<QPair<uint32_t,int> > CCC65Interface::spanIndexByAbsStart;
+QHash<QString,QHash<int,CCC65Interface::LineIndexEntry> > CCC65Interface::lineIndex;
+
+static const char* compileStartMarker = "nesicide-compile-start ";
+static const char* compileDoneMarker = "nesicide-compile-done ";
 
 static const char* clangTargetRuleFmt =
       "vpath %<!extension!> $(foreach <!extension!>,$(SOURCES),$(dir $<!extension!>))\r\n\r\n"
-      "$(OBJDIR)/%.o: %.<!extension!>\r\n"
+      "$(OBJDIR)/%.o: %.<!extension!> | $(OBJDIR)\r\n"
+      "\t@echo nesicide-compile-start $<\r\n"
       "\t$(COMPILE) --create-dep $(@:.o=.d) -S $(CFLAGS) -o $(@:.o=.s) $<\r\n\r\n"
-      "\t$(ASSEMBLE) $(ASFLAGS) -o $@ $(@:.o=.s)\r\n\r\n"
+      "\t$(ASSEMBLE) $(ASFLAGS) -o $@ $(@:.o=.s)\r\n"
+      "\t@echo nesicide-compile-done $<\r\n\r\n"
       ;
 
 static const char* asmTargetRuleFmt =
       "vpath %<!extension!> $(foreach <!extension!>,$(SOURCES),$(dir $<!extension!>))\r\n\r\n"
-      "$(OBJDIR)/%.o: %.<!extension!>\r\n"
-      "\t$(ASSEMBLE) --create-dep $(@:.o=.d) $(ASFLAGS) -o $@ $<\r\n\r\n"
+      "$(OBJDIR)/%.o: %.<!extension!> | $(OBJDIR)\r\n"
+      "\t@echo nesicide-compile-start $<\r\n"
+      "\t$(ASSEMBLE) --create-dep $(@:.o=.d) $(ASFLAGS) -o $@ $<\r\n"
+      "\t@echo nesicide-compile-done $<\r\n\r\n"
       ;
 
 CCC65Interface::CCC65Interface()
@@ -36,12 +61,322 @@ CCC65Interface::~CCC65Interface()
 void CCC65Interface::updateTargetMachine(QString target)
 {
    targetMachine = target;
+   if ( !target.compare("nes",Qt::CaseInsensitive) )
+   {
+      targetMachineType = Target_NES;
+   }
+   else if ( !target.compare("c64",Qt::CaseInsensitive) )
+   {
+      targetMachineType = Target_C64;
+   }
+   else
+   {
+      targetMachineType = Target_None;
+   }
 }
 
 void CCC65Interface::clear()
 {
    cc65_free_dbginfo(dbgInfo);
    dbgInfo = 0;
+   dbgInfoState = BuildFileState();
+   dbgInfoRevision++;
+
+   buildAddressIndex();
+}
+
+bool CCC65Interface::spanIndexLessThan(const SpanIndexEntry& left,const SpanIndexEntry& right)
+{
+   if ( left.start != right.start )
+   {
+      return left.start < right.start;
+   }
+   return left.end < right.end;
+}
+
+void CCC65Interface::buildAddressIndex()
+{
+   QWriteLocker locker(&addressIndexLock);
+   const cc65_segmentinfo* dbgSegments;
+   const cc65_sourceinfo* dbgSources;
+   const cc65_spaninfo* dbgSpans;
+   const cc65_spaninfo* dbgLineSpans;
+   const cc65_lineinfo* dbgLines;
+   const cc65_segmentdata* segment;
+   QHash<unsigned,const cc65_segmentdata*> segments;
+   QHash<unsigned,QString> sourceNames;
+   QHash<unsigned,uint32_t> spanAbsStarts;
+   SpanIndexEntry entry;
+   uint32_t segmentAbsStart;
+   uint32_t last = 0;
+   int      lastIdx = 0;
+   int      step;
+   int      idx;
+   int      span;
+   int      line;
+   int      x;
+   int      k;
+   int      n;
+
+   spanIndex.clear();
+   spanIndexByAbsStart.clear();
+   lineIndex.clear();
+   spanIndexRootLevel = -1;
+
+   // The offsets are only meaningful for the NES lookups.
+   if ( (!dbgInfo) || (targetMachineType != Target_NES) )
+   {
+      return;
+   }
+
+   dbgSegments = cc65_get_segmentlist(dbgInfo);
+   dbgSources = cc65_get_sourcelist(dbgInfo);
+   dbgSpans = cc65_get_spanlist(dbgInfo);
+
+   if ( dbgSegments )
+   {
+      for ( idx = 0; idx < (int)dbgSegments->count; idx++ )
+      {
+         segments.insert(dbgSegments->data[idx].segment_id,&dbgSegments->data[idx]);
+      }
+   }
+   if ( dbgSources )
+   {
+      for ( idx = 0; idx < (int)dbgSources->count; idx++ )
+      {
+         sourceNames.insert(dbgSources->data[idx].source_id,dbgSources->data[idx].source_name);
+      }
+   }
+
+   // Flatten the spans, keeping the highest type line of each, which is
+   // what the lookups prefer (MACRO expansions over C over assembly).
+   if ( dbgSpans )
+   {
+      spanIndex.reserve(dbgSpans->count);
+      for ( span = 0; span < (int)dbgSpans->count; span++ )
+      {
+         segment = segments.value(dbgSpans->data[span].segment_id);
+         if ( !segment )
+         {
+            continue;
+         }
+         segmentAbsStart = segment->output_offs;
+         if ( segment->output_name )
+         {
+            segmentAbsStart -= 0x10;
+         }
+
+         entry.start = dbgSpans->data[span].span_start;
+         entry.end = dbgSpans->data[span].span_end;
+         entry.absStart = segmentAbsStart+(dbgSpans->data[span].span_start-segment->segment_start);
+         entry.absEnd = segmentAbsStart+(dbgSpans->data[span].span_end-segment->segment_start);
+         entry.segmentAbsStart = segmentAbsStart;
+         entry.segmentSize = segment->segment_size;
+         entry.lineType = -1;
+         entry.sourceLine = -1;
+         entry.sourceFile = "";
+
+         if ( dbgSpans->data[span].line_count )
+         {
+            dbgLines = cc65_line_byspan(dbgInfo,dbgSpans->data[span].span_id);
+            if ( dbgLines )
+            {
+               for ( line = 0; line < (int)dbgLines->count; line++ )
+               {
+                  if ( (int)dbgLines->data[line].line_type >= entry.lineType )
+                  {
+                     entry.lineType = dbgLines->data[line].line_type;
+                     entry.sourceLine = dbgLines->data[line].source_line;
+                     entry.sourceFile = sourceNames.value(dbgLines->data[line].source_id);
+                  }
+               }
+               cc65_free_lineinfo(dbgInfo,dbgLines);
+            }
+         }
+
+         spanAbsStarts.insert(dbgSpans->data[span].span_id,entry.absStart);
+         spanIndex.append(entry);
+      }
+   }
+
+   // Sort by address, the same order cc65_span_byaddr returns spans in.
+   qStableSort(spanIndex.begin(),spanIndex.end(),spanIndexLessThan);
+
+   n = spanIndex.count();
+   spanIndexByAbsStart.reserve(n);
+   for ( idx = 0; idx < n; idx++ )
+   {
+      spanIndexByAbsStart.append(qMakePair(spanIndex.at(idx).absStart,idx));
+   }
+   qSort(spanIndexByAbsStart.begin(),spanIndexByAbsStart.end());
+
+   // Set up the implicit interval tree.  Even entries are leaves, the
+   // entry at level k has 2^k-1 entries on either side in its subtree.
+   if ( n )
+   {
+      for ( idx = 0; idx < n; idx += 2 )
+      {
+         lastIdx = idx;
+         last = spanIndex[idx].maxEnd = spanIndex[idx].end;
+      }
+      for ( k = 1; (1<<k) <= n; k++ )
+      {
+         x = 1<<(k-1);
+         step = x<<2;
+         for ( idx = (x<<1)-1; idx < n; idx += step )
+         {
+            spanIndex[idx].maxEnd = qMax(spanIndex[idx].end,
+                                         qMax(spanIndex[idx-x].maxEnd,
+                                              (idx+x < n) ? spanIndex[idx+x].maxEnd : last));
+         }
+         lastIdx = ((lastIdx>>k)&1) ? lastIdx-x : lastIdx+x;
+         if ( (lastIdx < n) && (spanIndex[lastIdx].maxEnd > last) )
+         {
+            last = spanIndex[lastIdx].maxEnd;
+         }
+      }
+      spanIndexRootLevel = k-1;
+   }
+
+   // Map source lines to the PRG-ROM offsets of their spans.
+   if ( dbgSources )
+   {
+      for ( idx = 0; idx < (int)dbgSources->count; idx++ )
+      {
+         // Lookups by name find the first source of that name.
+         if ( lineIndex.contains(dbgSources->data[idx].source_name) )
+         {
+            continue;
+         }
+         QHash<int,LineIndexEntry>& lines = lineIndex[dbgSources->data[idx].source_name];
+
+         dbgLines = cc65_line_bysource(dbgInfo,dbgSources->data[idx].source_id);
+         if ( dbgLines )
+         {
+            for ( line = 0; line < (int)dbgLines->count; line++ )
+            {
+               LineIndexEntry& lineEntry = lines[dbgLines->data[line].source_line];
+
+               if ( lineEntry.lineCount++ == 0 )
+               {
+                  dbgLineSpans = cc65_span_byline(dbgInfo,dbgLines->data[line].line_id);
+                  if ( dbgLineSpans )
+                  {
+                     for ( span = 0; span < (int)dbgLineSpans->count; span++ )
+                     {
+                        lineEntry.starts.append(dbgLineSpans->data[span].span_start);
+                        lineEntry.absStarts.append(spanAbsStarts.value(dbgLineSpans->data[span].span_id,-1));
+                     }
+                     cc65_free_spaninfo(dbgInfo,dbgLineSpans);
+                  }
+               }
+            }
+            cc65_free_lineinfo(dbgInfo,dbgLines);
+         }
+      }
+   }
+
+   if ( dbgSpans )
+   {
+      cc65_free_spaninfo(dbgInfo,dbgSpans);
+   }
+   if ( dbgSources )
+   {
+      cc65_free_sourceinfo(dbgInfo,dbgSources);
+   }
+   if ( dbgSegments )
+   {
+      cc65_free_segmentinfo(dbgInfo,dbgSegments);
+   }
+}
+
+bool CCC65Interface::spanIndexEntryMatches(const SpanIndexEntry& span,uint32_t addr,uint32_t absAddr,bool absInSpan)
+{
+   // Only spans with source lines, containing the address, and either
+   // the span or its segment containing the PRG-ROM offset.
+   if ( (span.lineType < 0) || (span.start > addr) || (span.end < addr) )
+   {
+      return false;
+   }
+   if ( absInSpan )
+   {
+      return (absAddr >= span.absStart) && (absAddr <= span.absEnd);
+   }
+   return (absAddr >= span.segmentAbsStart) && (absAddr < span.segmentAbsStart+span.segmentSize);
+}
+
+int CCC65Interface::findSpanIndexEntry(uint32_t addr,uint32_t absAddr,bool absInSpan)
+{
+   // Caller holds addressIndexLock.
+   struct
+   {
+      int  idx;
+      int  level;
+      bool leftDone;
+   } stack[64], node;
+   int  depth = 0;
+   int  n = spanIndex.count();
+   int  first;
+   int  end;
+   int  idx;
+   int  highestTypeMatch = -1;
+   int  indexOfHighestTypeMatch = -1;
+
+   if ( spanIndexRootLevel < 0 )
+   {
+      return -1;
+   }
+
+   // Walk the spans containing addr in address order, the last one with
+   // the highest line type wins like in the cc65 span list.
+   stack[depth].idx = (1<<spanIndexRootLevel)-1;
+   stack[depth].level = spanIndexRootLevel;
+   stack[depth++].leftDone = false;
+   while ( depth )
+   {
+      node = stack[--depth];
+      if ( node.level <= 3 )
+      {
+         // Small subtree, scan it.
+         first = node.idx>>node.level<<node.level;
+         end = qMin(n,first+(1<<(node.level+1))-1);
+         for ( idx = first; (idx < end) && (spanIndex.at(idx).start <= addr); idx++ )
+         {
+            if ( (spanIndex.at(idx).lineType >= highestTypeMatch) &&
+                 spanIndexEntryMatches(spanIndex.at(idx),addr,absAddr,absInSpan) )
+            {
+               highestTypeMatch = spanIndex.at(idx).lineType;
+               indexOfHighestTypeMatch = idx;
+            }
+         }
+      }
+      else if ( !node.leftDone )
+      {
+         idx = node.idx-(1<<(node.level-1));
+         stack[depth] = node;
+         stack[depth++].leftDone = true;
+         if ( (idx >= n) || (spanIndex.at(idx).maxEnd >= addr) )
+         {
+            stack[depth].idx = idx;
+            stack[depth].level = node.level-1;
+            stack[depth++].leftDone = false;
+         }
+      }
+      else if ( (node.idx < n) && (spanIndex.at(node.idx).start <= addr) )
+      {
+         if ( (spanIndex.at(node.idx).lineType >= highestTypeMatch) &&
+              spanIndexEntryMatches(spanIndex.at(node.idx),addr,absAddr,absInSpan) )
+         {
+            highestTypeMatch = spanIndex.at(node.idx).lineType;
+            indexOfHighestTypeMatch = node.idx;
+         }
+         stack[depth].idx = node.idx+(1<<(node.level-1));
+         stack[depth].level = node.level-1;
+         stack[depth++].leftDone = false;
+      }
+   }
+
+   return indexOfHighestTypeMatch;
 }
 
 QStringList CCC65Interface::getAssemblerSourcesFromProject()
@@ -139,12 +474,10 @@ bool CCC65Interface::createMakefile()
       targetRules += targetRule;
    }
 
-   // Create the project's makefile...
-   makeFile.open(QIODevice::ReadWrite|QIODevice::Truncate);
-
-   if ( res.isOpen() && makeFile.isOpen() )
+   if ( res.isOpen() )
    {
       QString makeFileContent;
+      QByteArray makeFileBytes;
 
       // Read the embedded Makefile resource.
       makeFileContent = res.readAll();
@@ -178,119 +511,422 @@ bool CCC65Interface::createMakefile()
          makeFileContent.replace("<!custom-rules!>","");
       }
 
-      // Write the file to disk.
-      makeFile.write(makeFileContent.toAscii());
-
-      makeFile.close();
       res.close();
 
-      return true;
+      // Leave an unchanged makefile alone, it is part of the build state.
+      makeFileBytes = makeFileContent.toAscii();
+      if ( makeFile.open(QIODevice::ReadOnly) )
+      {
+         if ( makeFile.readAll() == makeFileBytes )
+         {
+            makeFile.close();
+            return true;
+         }
+         makeFile.close();
+      }
+
+      // Create the project's makefile...
+      makeFile.open(QIODevice::WriteOnly|QIODevice::Truncate);
+
+      if ( makeFile.isOpen() )
+      {
+         // Write the file to disk.
+         makeFile.write(makeFileBytes);
+
+         makeFile.close();
+
+         return true;
+      }
    }
 
    return false;
 }
 
-void CCC65Interface::clean()
+QString CCC65Interface::getProgramFileName()
+{
+   QDir outputDir(nesicideProject->getProjectLinkerOutputBasePath());
+
+   if ( nesicideProject->getProjectLinkerOutputName().isEmpty() )
+   {
+      return outputDir.fromNativeSeparators(outputDir.filePath(nesicideProject->getProjectOutputName()+".prg"));
+   }
+   return outputDir.fromNativeSeparators(outputDir.filePath(nesicideProject->getProjectLinkerOutputName()));
+}
+
+QString CCC65Interface::getDebugInfoFileName()
+{
+   QDir dir(QDir::currentPath());
+
+   if ( nesicideProject->getProjectDebugInfoName().isEmpty() )
+   {
+      return dir.fromNativeSeparators(dir.relativeFilePath(nesicideProject->getProjectOutputName()+".dbg"));
+   }
+   return dir.fromNativeSeparators(dir.relativeFilePath(nesicideProject->getProjectDebugInfoName()));
+}
+
+QString CCC65Interface::getBuildStateFileName()
+{
+   QDir objDir(nesicideProject->getProjectOutputBasePath());
+
+   return objDir.fromNativeSeparators(objDir.filePath("nesicide.state"));
+}
+
+CCC65Interface::BuildFileState CCC65Interface::getFileState(QString fileName,const BuildFileState* previous)
+{
+   QFileInfo      fileInfo(fileName);
+   QFile          file(fileName);
+   BuildFileState state;
+
+   state.size = -1;
+   state.modified = 0;
+
+   if ( !fileInfo.exists() )
+   {
+      return state;
+   }
+   state.size = fileInfo.size();
+   state.modified = fileInfo.lastModified().toTime_t();
+
+   // Only hash the file if it was touched since it was last hashed.
+   if ( previous &&
+        (previous->size == state.size) &&
+        (previous->modified == state.modified) )
+   {
+      state.hash = previous->hash;
+   }
+   else if ( file.open(QIODevice::ReadOnly) )
+   {
+      state.hash = QCryptographicHash::hash(file.readAll(),QCryptographicHash::Md5);
+      file.close();
+   }
+
+   return state;
+}
+
+QHash<QString,CCC65Interface::BuildFileState> CCC65Interface::readBuildState()
+{
+   QHash<QString,BuildFileState> buildState;
+   QFile                         stateFile(getBuildStateFileName());
+   BuildFileState                state;
+   QString                       str;
+
+   // One line per file: hash size modified name
+   if ( stateFile.open(QIODevice::ReadOnly|QIODevice::Text) )
+   {
+      QTextStream stream(&stateFile);
+
+      while ( !stream.atEnd() )
+      {
+         str = stream.readLine();
+         state.hash = QByteArray::fromHex(str.section(' ',0,0).toAscii());
+         state.size = str.section(' ',1,1).toLongLong();
+         state.modified = str.section(' ',2,2).toUInt();
+         buildState.insert(str.section(' ',3),state);
+      }
+      stateFile.close();
+   }
+
+   return buildState;
+}
+
+void CCC65Interface::saveBuildState()
+{
+   QHash<QString,BuildFileState> buildState;
+   QStringList                   fileNames;
+   QStringList                   sources;
+   QDir                          objDir(nesicideProject->getProjectOutputBasePath());
+   QFile                         stateFile(getBuildStateFileName());
+   QFile                         depFile;
+   QString                       deps;
+
+   sources = getCLanguageSourcesFromProject();
+   sources += getAssemblerSourcesFromProject();
+
+   fileNames = sources;
+   fileNames.append("nesicide.mk");
+   fileNames.append(nesicideProject->getLinkerConfigFile());
+   fileNames += nesicideProject->getLinkerAdditionalDependencies().split(" ",QString::SkipEmptyParts);
+   if ( !nesicideProject->getMakefileCustomRulesFile().isEmpty() )
+   {
+      fileNames.append(nesicideProject->getMakefileCustomRulesFile());
+   }
+
+   // Pick up the headers each source depends on from the dependency files
+   // the compiler and assembler write next to the objects.
+   foreach ( const QString& source, sources )
+   {
+      depFile.setFileName(objDir.filePath(QFileInfo(source).completeBaseName()+".d"));
+      if ( depFile.open(QIODevice::ReadOnly|QIODevice::Text) )
+      {
+         deps = QString(depFile.readAll());
+         deps.replace("\\\n"," ");
+         foreach ( const QString& rule, deps.split('\n',QString::SkipEmptyParts) )
+         {
+            fileNames += rule.section(QRegExp(":\\s"),1).split(QRegExp("\\s+"),QString::SkipEmptyParts);
+         }
+         depFile.close();
+      }
+   }
+
+   fileNames.append(getProgramFileName());
+   fileNames.append(getDebugInfoFileName());
+
+   foreach ( const QString& fileName, fileNames )
+   {
+      if ( !buildState.contains(fileName) )
+      {
+         buildState.insert(fileName,getFileState(fileName));
+      }
+   }
+
+   if ( stateFile.open(QIODevice::WriteOnly|QIODevice::Truncate|QIODevice::Text) )
+   {
+      QTextStream stream(&stateFile);
+      QHash<QString,BuildFileState>::const_iterator iter;
+
+      for ( iter = buildState.constBegin(); iter != buildState.constEnd(); ++iter )
+      {
+         stream << iter.value().hash.toHex() << ' ' << iter.value().size << ' ' << iter.value().modified << ' ' << iter.key() << '\n';
+      }
+      stateFile.close();
+   }
+}
+
+bool CCC65Interface::isBuildStateCurrent()
+{
+   QHash<QString,BuildFileState> buildState = readBuildState();
+   QHash<QString,BuildFileState>::const_iterator iter;
+   QStringList                   sources;
+   BuildFileState                state;
+
+   if ( buildState.isEmpty() )
+   {
+      return false;
+   }
+
+   // A source added to the project changes the makefile, but check anyway.
+   sources = getCLanguageSourcesFromProject();
+   sources += getAssemblerSourcesFromProject();
+   foreach ( const QString& source, sources )
+   {
+      if ( !buildState.contains(source) )
+      {
+         return false;
+      }
+   }
+
+   for ( iter = buildState.constBegin(); iter != buildState.constEnd(); ++iter )
+   {
+      state = getFileState(iter.key(),&iter.value());
+      if ( (state.size != iter.value().size) ||
+           (state.hash != iter.value().hash) )
+      {
+         return false;
+      }
+   }
+
+   return true;
+}
+
+void CCC65Interface::clean()
+{
+   QString                      invocationStr;
+
+   // Clear the error storage.
+   errors.clear();
+   cancelRequested = false;
+
+   createMakefile();
+
+   QFile::remove(getBuildStateFileName());
+
+   invocationStr = "make -f nesicide.mk clean";
+
+   runMake(invocationStr);
+
+   return;
+}
+
+bool CCC65Interface::assemble()
+{
+   QString                      invocationStr;
+   QString                      outputName = getProgramFileName();
+   int                          jobs = EnvironmentSettingsDialog::makeJobs();
+   int                          exitCode;
+   bool                         ok = true;
+
+   buildTextLogger->write("<b>Building: "+outputName+"</b>");
+
+   // Clear the error storage.
+   errors.clear();
+   cancelRequested = false;
+
+   createMakefile();
+
+   // Nothing the build depends on changed since the last successful
+   // build, so there is no need to ask make.
+   if ( isBuildStateCurrent() )
+   {
+      buildTextLogger->write("<font color='black'>"+outputName+" is up to date.</font>");
+      return true;
+   }
+
+   // The state is rewritten once make succeeds.
+   QFile::remove(getBuildStateFileName());
+
+   invocationStr = "make -f nesicide.mk";
+   if ( jobs > 1 )
+   {
+      invocationStr += " -j "+QString::number(jobs);
+   }
+   invocationStr += " all";
+
+   exitCode = runMake(invocationStr);
+   if ( exitCode )
+   {
+      ok = false;
+   }
+   else
+   {
+      buildTextLogger->write("<font color='black'>Compiled in "+QString::number(buildTime.elapsed())+" ms.</font>");
+      saveBuildState();
+   }
+
+   return ok;
+}
+
+int CCC65Interface::runMake(QString invocationStr)
 {
    QProcess                     make;
    QProcessEnvironment          env = QProcessEnvironment::systemEnvironment();
-   QString                      invocationStr;
-   QString                      stdioStr;
-   QStringList                  stdioList;
-   int                          exitCode;
 
    // Copy the system environment to the child process.
    make.setProcessEnvironment(env);
    make.setWorkingDirectory(QDir::currentPath());
 
-   // Clear the error storage.
-   errors.clear();
-
-   createMakefile();
-
-   invocationStr = "make -f nesicide.mk clean";
-
    buildTextLogger->write(invocationStr);
 
+   compileStartTimes.clear();
+   buildTime.start();
+
    make.start(invocationStr);
-   make.waitForFinished();
-   make.waitForReadyRead();
-   exitCode = make.exitCode();
-   stdioStr = QString(make.readAllStandardOutput());
-   stdioList = stdioStr.split(QRegExp("[\r\n]"),QString::SkipEmptyParts);
-   foreach ( const QString& str, stdioList )
+   if ( !make.waitForStarted() )
    {
-      buildTextLogger->write("<font color='blue'>"+str+"</font>");
+      buildTextLogger->write("<font color='red'>Unable to start make.</font>");
+      return -1;
    }
-   stdioStr = QString(make.readAllStandardError());
-   stdioList = stdioStr.split(QRegExp("[\r\n]"),QString::SkipEmptyParts);
-   errors.append(stdioList);
-   foreach ( const QString& str, stdioList )
+
+   // Pass make's output on as it arrives rather than after make exits,
+   // so the output pane and error markers follow the build.
+   while ( make.state() != QProcess::NotRunning )
    {
-      buildTextLogger->write("<font color='red'>"+str+"</font>");
+      make.waitForFinished(50);
+      readMakeOutput(&make,false);
+
+      if ( cancelRequested )
+      {
+         make.terminate();
+         if ( !make.waitForFinished(2000) )
+         {
+            make.kill();
+            make.waitForFinished();
+         }
+      }
    }
+   readMakeOutput(&make,true);
 
-   return;
+   if ( cancelRequested )
+   {
+      buildTextLogger->write("<font color='red'><b>Build canceled.</b></font>");
+      return -1;
+   }
+   if ( make.exitStatus() != QProcess::NormalExit )
+   {
+      return -1;
+   }
+   return make.exitCode();
 }
 
-bool CCC65Interface::assemble()
+void CCC65Interface::readMakeOutput(QProcess* make,bool flush)
 {
-   QProcess                     make;
-   QProcessEnvironment          env = QProcessEnvironment::systemEnvironment();
-   QString                      invocationStr;
-   QString                      stdioStr;
-   QStringList                  stdioList;
-   QDir                         outputDir(nesicideProject->getProjectLinkerOutputBasePath());
-   QString                      outputName;
-   int                          exitCode;
-   bool                         ok = true;
+   QStringList stdioList;
 
-   if ( nesicideProject->getProjectLinkerOutputName().isEmpty() )
+   make->setReadChannel(QProcess::StandardOutput);
+   while ( make->canReadLine() )
    {
-      outputName = outputDir.fromNativeSeparators(outputDir.filePath(nesicideProject->getProjectOutputName()+".prg"));
+      processMakeLine(QString(make->readLine()),QProcess::StandardOutput);
    }
-   else
+   make->setReadChannel(QProcess::StandardError);
+   while ( make->canReadLine() )
    {
-      outputName = outputDir.fromNativeSeparators(outputDir.filePath(nesicideProject->getProjectLinkerOutputName()));
+      processMakeLine(QString(make->readLine()),QProcess::StandardError);
    }
-   buildTextLogger->write("<b>Building: "+outputName+"</b>");
 
-   // Copy the system environment to the child process.
-   make.setProcessEnvironment(env);
-   make.setWorkingDirectory(QDir::currentPath());
-
-   // Clear the error storage.
-   errors.clear();
-
-   createMakefile();
-
-   invocationStr = "make -f nesicide.mk all";
+   // Anything left over once make exits is an unterminated last line.
+   if ( flush )
+   {
+      stdioList = QString(make->readAllStandardOutput()).split(QRegExp("[\r\n]"),QString::SkipEmptyParts);
+      foreach ( const QString& str, stdioList )
+      {
+         processMakeLine(str,QProcess::StandardOutput);
+      }
+      stdioList = QString(make->readAllStandardError()).split(QRegExp("[\r\n]"),QString::SkipEmptyParts);
+      foreach ( const QString& str, stdioList )
+      {
+         processMakeLine(str,QProcess::StandardError);
+      }
+   }
+}
 
-   buildTextLogger->write(invocationStr);
+void CCC65Interface::processMakeLine(QString str,QProcess::ProcessChannel channel)
+{
+   static QRegExp errorRegex("^(.+)\\((\\d+)\\):");
+   CompilerThread* compiler;
+   QString         file;
 
-   make.start(invocationStr);
-   make.waitForFinished();
-   make.waitForReadyRead();
-   exitCode = make.exitCode();
-   stdioStr = QString(make.readAllStandardOutput());
-   stdioList = stdioStr.split(QRegExp("[\r\n]"),QString::SkipEmptyParts);
-   foreach ( const QString& str, stdioList )
+   str.remove(QRegExp("[\r\n]"));
+   if ( str.isEmpty() )
    {
-      buildTextLogger->write("<font color='blue'>"+str+"</font>");
+      return;
    }
-   stdioStr = QString(make.readAllStandardError());
-   stdioList = stdioStr.split(QRegExp("[\r\n]"),QString::SkipEmptyParts);
-   errors.append(stdioList);
-   foreach ( const QString& str, stdioList )
+
+   if ( channel == QProcess::StandardOutput )
    {
-      buildTextLogger->write("<font color='red'>"+str+"</font>");
+      // The target rules bracket each source file with markers so the
+      // time spent on each file can be reported.
+      if ( str.startsWith(compileStartMarker) )
+      {
+         file = str.mid(qstrlen(compileStartMarker)).trimmed();
+         compileStartTimes.insert(file,buildTime.elapsed());
+      }
+      else if ( str.startsWith(compileDoneMarker) )
+      {
+         file = str.mid(qstrlen(compileDoneMarker)).trimmed();
+         if ( compileStartTimes.contains(file) )
+         {
+            buildTextLogger->write("<font color='gray'>"+file+": "+QString::number(buildTime.elapsed()-compileStartTimes.take(file))+" ms</font>");
+         }
+      }
+      else
+      {
+         buildTextLogger->write("<font color='blue'>"+str+"</font>");
+      }
    }
-   if ( exitCode )
+   else
    {
-      ok = false;
-   }
+      errors.append(str);
+      buildTextLogger->write("<font color='red'>"+str+"</font>");
 
-   return ok;
+      // Let open editors mark the line right away.
+      if ( errorRegex.indexIn(str) >= 0 )
+      {
+         compiler = dynamic_cast<CompilerThread*>(CObjectRegistry::getObject("Compiler"));
+         if ( compiler )
+         {
+            compiler->reportError(errorRegex.cap(1),errorRegex.cap(2).toInt());
+         }
+      }
+   }
 }
 
 static void ErrorFunc (const struct cc65_parseerror* E)
@@ -308,17 +944,21 @@ static void ErrorFunc (const struct cc65_parseerror* E)
 
 bool CCC65Interface::captureDebugInfo()
 {
-   QDir dir(QDir::currentPath());
-   QString dbgInfoFile;
-
-   if ( nesicideProject->getProjectDebugInfoName().isEmpty() )
+   QString dbgInfoFile = getDebugInfoFileName();
+   BuildFileState state;
+
+   // Skip parsing the debug information again if the linker didn't
+   // rewrite it, as is the case when the build was up to date.
+   state = getFileState(dbgInfoFile,&dbgInfoState);
+   if ( dbgInfo &&
+        (state.size == dbgInfoState.size) &&
+        (state.hash == dbgInfoState.hash) )
    {
-      dbgInfoFile = dir.fromNativeSeparators(dir.relativeFilePath(nesicideProject->getProjectOutputName()+".dbg"));
-   }
-   else
-   {
-      dbgInfoFile = dir.fromNativeSeparators(dir.relativeFilePath(nesicideProject->getProjectDebugInfoName()));
+      buildTextLogger->write("<font color='black'><b>Debug information in "+dbgInfoFile+" is unchanged.</b></font>");
+      dbgInfoState = state;
+      return true;
    }
+
    buildTextLogger->write("<font color='black'><b>Reading debug information from: "+dbgInfoFile+"</b></font>");
 
    CCC65Interface::clear();
@@ -329,6 +969,10 @@ bool CCC65Interface::captureDebugInfo()
    {
       return false;
    }
+   dbgInfoState = state;
+   dbgInfoRevision++;
+
+   buildAddressIndex();
 
    // Check consistency of debug information when it's loaded.
    CCC65Interface::isBuildUpToDate();
@@ -338,12 +982,8 @@ bool CCC65Interface::captureDebugInfo()
 
 bool CCC65Interface::isBuildUpToDate()
 {
-   QProcess                     make;
-   QProcessEnvironment          env = QProcessEnvironment::systemEnvironment();
-   QString                      invocationStr;
-   QString                      stdioStr;
-   QStringList                  stdioList;
-   int                          exitCode;
+   QFileInfo                    programInfo(getProgramFileName());
+   QStringList                  sources;
    QString outdated = "The NES ROM image is older than one or more of its source files.\n"
                       "Debuggers may not display correct information unless the NES ROM\n"
                       "is rebuilt.\n\n";
@@ -353,25 +993,33 @@ bool CCC65Interface::isBuildUpToDate()
    if ( (getCLanguageSourcesFromProject().count() ||
         (getAssemblerSourcesFromProject().count())) )
    {
-      // Copy the system environment to the child process.
-      make.setProcessEnvironment(env);
-      make.setWorkingDirectory(QDir::currentPath());
-
-      // Clear the error storage.
-      errors.clear();
-
       createMakefile();
 
-      invocationStr = "make -f nesicide.mk -q all";
+      if ( QFile::exists(getBuildStateFileName()) )
+      {
+         ok = isBuildStateCurrent();
+      }
+      else
+      {
+         // Not built by the IDE yet, compare timestamps like make would.
+         sources = getCLanguageSourcesFromProject();
+         sources += getAssemblerSourcesFromProject();
+         sources.append(nesicideProject->getLinkerConfigFile());
 
-      make.start(invocationStr);
-      make.waitForFinished();
-      exitCode = make.exitCode();
+         ok = programInfo.exists();
+         foreach ( const QString& source, sources )
+         {
+            if ( !ok )
+            {
+               break;
+            }
+            ok = (QFileInfo(source).lastModified() <= programInfo.lastModified());
+         }
+      }
 
-      if ( exitCode == 1 )
+      if ( !ok )
       {
          QMessageBox::warning(NULL,"Consistency problem!",outdated);
-         ok = false;
       }
    }
 
@@ -561,11 +1209,11 @@ unsigned int CCC65Interface::getSymbolAddress(QString symbol, int index)
 unsigned int CCC65Interface::getSymbolAbsoluteAddress(QString symbol, int index)
 {
    // Dispatch to appropriate target machine handler.
-   if ( !targetMachine.compare("nes",Qt::CaseInsensitive) )
+   if ( targetMachineType == Target_NES )
    {
       return nesGetSymbolAbsoluteAddress(symbol,index);
    }
-   else if ( !targetMachine.compare("c64",Qt::CaseInsensitive) )
+   else if ( targetMachineType == Target_C64 )
    {
       return c64GetSymbolAbsoluteAddress(symbol,index);
    }
@@ -863,207 +1511,40 @@ int CCC65Interface::getSymbolMatchCount(QString symbol)
 QString CCC65Interface::getSourceFileFromAbsoluteAddress(uint32_t addr,uint32_t absAddr)
 {
    // Dispatch to appropriate target machine handler.
-   if ( !targetMachine.compare("nes",Qt::CaseInsensitive) )
+   if ( targetMachineType == Target_NES )
    {
       return nesGetSourceFileFromAbsoluteAddress(addr,absAddr);
    }
-   else if ( !targetMachine.compare("c64",Qt::CaseInsensitive) )
+   else if ( targetMachineType == Target_C64 )
    {
       return c64GetSourceFileFromAbsoluteAddress(addr,absAddr);
    }
 }
-
-QString CCC65Interface::nesGetSourceFileFromAbsoluteAddress(uint32_t addr,uint32_t absAddr)
-{
-   const cc65_spaninfo* dbgSpans;
-   const cc65_segmentinfo* dbgSegments;
-   const cc65_lineinfo* dbgLines;
-   const cc65_sourceinfo* dbgSources;
-   int span;
-   int line;
-   int highestTypeMatch = 0;
-   int indexOfHighestTypeMatch = -1;
-   QString file = "";
-
-   if ( dbgInfo )
-   {
-      // Get the span containing this virtual address.
-      dbgSpans = cc65_span_byaddr(dbgInfo,addr);
-
-      if ( dbgSpans )
-      {
-         for ( span = 0; span < dbgSpans->count; span++ )
-         {
-            if ( dbgSpans->data[span].line_count )
-            {
-               // Get the segment potentially containing this absolute address.
-               dbgSegments = cc65_segment_byid(dbgInfo,dbgSpans->data[span].segment_id);
-
-               // Get the line potentially containing this absolute address.
-               dbgLines = cc65_line_byspan(dbgInfo,dbgSpans->data[span].span_id);
-
-               if ( dbgSegments && (dbgSegments->count == 1) &&
-                    dbgLines && (dbgLines->count > 0) )
-               {
-                  if ( dbgSegments->data[0].output_name )
-                  {
-                     if ( (absAddr >= dbgSegments->data[0].output_offs-0x10) &&
-                          (absAddr < (dbgSegments->data[0].output_offs-0x10+dbgSegments->data[0].segment_size)) )
-                     {
-                        for ( line = 0; line < dbgLines->count; line++ )
-                        {
-                           if ( dbgLines->data[line].line_type >= highestTypeMatch )
-                           {
-                              highestTypeMatch = dbgLines->data[line].line_type;
-                              indexOfHighestTypeMatch = dbgLines->data[line].line_id;
-                           }
-                        }
-                     }
-                  }
-                  else
-                  {
-                     if ( (absAddr >= dbgSegments->data[0].output_offs) &&
-                          (absAddr < (dbgSegments->data[0].output_offs+dbgSegments->data[0].segment_size)) )
-                     {
-                        for ( line = 0; line < dbgLines->count; line++ )
-                        {
-                           if ( dbgLines->data[line].line_type >= highestTypeMatch )
-                           {
-                              highestTypeMatch = dbgLines->data[line].line_type;
-                              indexOfHighestTypeMatch = dbgLines->data[line].line_id;
-                           }
-                        }
-                     }
-                  }
-               }
-               if ( dbgSegments )
-               {
-                  cc65_free_segmentinfo(dbgInfo,dbgSegments);
-               }
-               if ( dbgLines )
-               {
-                  cc65_free_lineinfo(dbgInfo,dbgLines);
-               }
-            }
-         }
-
-         cc65_free_spaninfo(dbgInfo,dbgSpans);
-
-         if ( indexOfHighestTypeMatch >= 0 )
-         {
-            // Get the picked line.
-            dbgLines = cc65_line_byid(dbgInfo,indexOfHighestTypeMatch);
-
-            // Get the source file of the picked line.
-            dbgSources = cc65_source_byid(dbgInfo,dbgLines->data[0].source_id);
-            file = dbgSources->data[0].source_name;
-
-            cc65_free_sourceinfo(dbgInfo,dbgSources);
-            cc65_free_lineinfo(dbgInfo,dbgLines);
-         }
-      }
-   }
-   return file;
-}
-
-QString CCC65Interface::c64GetSourceFileFromAbsoluteAddress(uint32_t addr,uint32_t absAddr)
-{
-   const cc65_spaninfo* dbgSpans;
-   const cc65_segmentinfo* dbgSegments;
-   const cc65_lineinfo* dbgLines;
-   const cc65_sourceinfo* dbgSources;
-   int span;
-   int line;
-   int highestTypeMatch = 0;
-   int indexOfHighestTypeMatch = -1;
-   QString file = "";
-
-   if ( dbgInfo )
-   {
-      // Get the span containing this virtual address.
-      dbgSpans = cc65_span_byaddr(dbgInfo,addr);
-
-      if ( dbgSpans )
-      {
-         for ( span = 0; span < dbgSpans->count; span++ )
-         {
-            if ( dbgSpans->data[span].line_count )
-            {
-               // Get the segment potentially containing this absolute address.
-               dbgSegments = cc65_segment_byid(dbgInfo,dbgSpans->data[span].segment_id);
-
-               // Get the line potentially containing this absolute address.
-               dbgLines = cc65_line_byspan(dbgInfo,dbgSpans->data[span].span_id);
-
-               if ( dbgSegments && (dbgSegments->count == 1) &&
-                    dbgLines && (dbgLines->count > 0) )
-               {
-                  if ( (absAddr >= dbgSegments->data[0].segment_start) &&
-                       (absAddr < (dbgSegments->data[0].segment_start+dbgSegments->data[0].segment_size)) )
-                  {
-                     for ( line = 0; line < dbgLines->count; line++ )
-                     {
-                        if ( dbgLines->data[line].line_type >= highestTypeMatch )
-                        {
-                           highestTypeMatch = dbgLines->data[line].line_type;
-                           indexOfHighestTypeMatch = dbgLines->data[line].line_id;
-                        }
-                     }
-                  }
-               }
-               if ( dbgSegments )
-               {
-                  cc65_free_segmentinfo(dbgInfo,dbgSegments);
-               }
-               if ( dbgLines )
-               {
-                  cc65_free_lineinfo(dbgInfo,dbgLines);
-               }
-            }
-         }
-
-         cc65_free_spaninfo(dbgInfo,dbgSpans);
-
-         if ( indexOfHighestTypeMatch >= 0 )
-         {
-            // Get the picked line.
-            dbgLines = cc65_line_byid(dbgInfo,indexOfHighestTypeMatch);
-
-            // Get the source file of the picked line.
-            dbgSources = cc65_source_byid(dbgInfo,dbgLines->data[0].source_id);
-            file = dbgSources->data[0].source_name;
-
-            cc65_free_sourceinfo(dbgInfo,dbgSources);
-            cc65_free_lineinfo(dbgInfo,dbgLines);
-         }
-      }
-   }
-   return file;
-}
-
-int CCC65Interface::getSourceLineFromAbsoluteAddress(uint32_t addr,uint32_t absAddr)
-{
-   // Dispatch to appropriate target machine handler.
-   if ( !targetMachine.compare("nes",Qt::CaseInsensitive) )
-   {
-      return nesGetSourceLineFromAbsoluteAddress(addr,absAddr);
-   }
-   else if ( !targetMachine.compare("c64",Qt::CaseInsensitive) )
+
+QString CCC65Interface::nesGetSourceFileFromAbsoluteAddress(uint32_t addr,uint32_t absAddr)
+{
+   QReadLocker locker(&addressIndexLock);
+   int idx;
+
+   idx = findSpanIndexEntry(addr,absAddr,false);
+   if ( idx >= 0 )
    {
-      return c64GetSourceLineFromAbsoluteAddress(addr,absAddr);
+      return spanIndex.at(idx).sourceFile;
    }
+   return "";
 }
 
-int CCC65Interface::nesGetSourceLineFromAbsoluteAddress(uint32_t addr,uint32_t absAddr)
+QString CCC65Interface::c64GetSourceFileFromAbsoluteAddress(uint32_t addr,uint32_t absAddr)
 {
    const cc65_spaninfo* dbgSpans;
-   const cc65_lineinfo* dbgLines;
    const cc65_segmentinfo* dbgSegments;
+   const cc65_lineinfo* dbgLines;
+   const cc65_sourceinfo* dbgSources;
    int span;
    int line;
    int highestTypeMatch = 0;
    int indexOfHighestTypeMatch = -1;
-   int source_line = -1;
+   QString file = "";
 
    if ( dbgInfo )
    {
@@ -1085,33 +1566,15 @@ int CCC65Interface::nesGetSourceLineFromAbsoluteAddress(uint32_t addr,uint32_t a
                if ( dbgSegments && (dbgSegments->count == 1) &&
                     dbgLines && (dbgLines->count > 0) )
                {
-                  if ( dbgSegments->data[0].output_name )
-                  {
-                     if ( (absAddr >= dbgSegments->data[0].output_offs-0x10) &&
-                          (absAddr < (dbgSegments->data[0].output_offs-0x10+dbgSegments->data[0].segment_size)) )
-                     {
-                        for ( line = 0; line < dbgLines->count; line++ )
-                        {
-                           if ( dbgLines->data[line].line_type >= highestTypeMatch )
-                           {
-                              highestTypeMatch = dbgLines->data[line].line_type;
-                              indexOfHighestTypeMatch = dbgLines->data[line].line_id;
-                           }
-                        }
-                     }
-                  }
-                  else
+                  if ( (absAddr >= dbgSegments->data[0].segment_start) &&
+                       (absAddr < (dbgSegments->data[0].segment_start+dbgSegments->data[0].segment_size)) )
                   {
-                     if ( (absAddr >= dbgSegments->data[0].output_offs) &&
-                          (absAddr < (dbgSegments->data[0].output_offs+dbgSegments->data[0].segment_size)) )
+                     for ( line = 0; line < dbgLines->count; line++ )
                      {
-                        for ( line = 0; line < dbgLines->count; line++ )
+                        if ( dbgLines->data[line].line_type >= highestTypeMatch )
                         {
-                           if ( dbgLines->data[line].line_type >= highestTypeMatch )
-                           {
-                              highestTypeMatch = dbgLines->data[line].line_type;
-                              indexOfHighestTypeMatch = dbgLines->data[line].line_id;
-                           }
+                           highestTypeMatch = dbgLines->data[line].line_type;
+                           indexOfHighestTypeMatch = dbgLines->data[line].line_id;
                         }
                      }
                   }
@@ -1126,18 +1589,50 @@ int CCC65Interface::nesGetSourceLineFromAbsoluteAddress(uint32_t addr,uint32_t a
                }
             }
          }
+
+         cc65_free_spaninfo(dbgInfo,dbgSpans);
+
          if ( indexOfHighestTypeMatch >= 0 )
          {
             // Get the picked line.
             dbgLines = cc65_line_byid(dbgInfo,indexOfHighestTypeMatch);
-            source_line = dbgLines->data[0].source_line;
+
+            // Get the source file of the picked line.
+            dbgSources = cc65_source_byid(dbgInfo,dbgLines->data[0].source_id);
+            file = dbgSources->data[0].source_name;
+
+            cc65_free_sourceinfo(dbgInfo,dbgSources);
             cc65_free_lineinfo(dbgInfo,dbgLines);
          }
-
-         cc65_free_spaninfo(dbgInfo,dbgSpans);
       }
    }
-   return source_line;
+   return file;
+}
+
+int CCC65Interface::getSourceLineFromAbsoluteAddress(uint32_t addr,uint32_t absAddr)
+{
+   // Dispatch to appropriate target machine handler.
+   if ( targetMachineType == Target_NES )
+   {
+      return nesGetSourceLineFromAbsoluteAddress(addr,absAddr);
+   }
+   else if ( targetMachineType == Target_C64 )
+   {
+      return c64GetSourceLineFromAbsoluteAddress(addr,absAddr);
+   }
+}
+
+int CCC65Interface::nesGetSourceLineFromAbsoluteAddress(uint32_t addr,uint32_t absAddr)
+{
+   QReadLocker locker(&addressIndexLock);
+   int idx;
+
+   idx = findSpanIndexEntry(addr,absAddr,false);
+   if ( idx >= 0 )
+   {
+      return spanIndex.at(idx).sourceLine;
+   }
+   return -1;
 }
 
 int CCC65Interface::c64GetSourceLineFromAbsoluteAddress(uint32_t addr,uint32_t absAddr)
@@ -1455,17 +1950,44 @@ unsigned int CCC65Interface::getAddressFromFileAndLine(QString file,int source_l
 unsigned int CCC65Interface::getAbsoluteAddressFromFileAndLine(QString file,int source_line,int entry)
 {
    // Dispatch to appropriate target machine handler.
-   if ( !targetMachine.compare("nes",Qt::CaseInsensitive) )
+   if ( targetMachineType == Target_NES )
    {
       return nesGetAbsoluteAddressFromFileAndLine(file,source_line,entry);
    }
-   else if ( !targetMachine.compare("c64",Qt::CaseInsensitive) )
+   else if ( targetMachineType == Target_C64 )
    {
       return c64GetAbsoluteAddressFromFileAndLine(file,source_line,entry);
    }
 }
 
 unsigned int CCC65Interface::nesGetAbsoluteAddressFromFileAndLine(QString file,int source_line,int entry)
+{
+   QReadLocker locker(&addressIndexLock);
+   QHash<QString,QHash<int,LineIndexEntry> >::const_iterator fileIter;
+   QHash<int,LineIndexEntry>::const_iterator lineIter;
+
+   fileIter = lineIndex.constFind(file);
+   if ( fileIter != lineIndex.constEnd() )
+   {
+      lineIter = fileIter.value().constFind(source_line);
+
+      // Only lines with a single line record have an address.
+      if ( (lineIter != fileIter.value().constEnd()) &&
+           (lineIter.value().lineCount == 1) &&
+           (lineIter.value().absStarts.count()) )
+      {
+         // Pick the requested span, or the last one if there aren't that many.
+         if ( (entry >= 0) && (entry < lineIter.value().absStarts.count()) )
+         {
+            return lineIter.value().absStarts.at(entry);
+         }
+         return lineIter.value().absStarts.last();
+      }
+   }
+   return -1;
+}
+
+unsigned int CCC65Interface::c64GetAbsoluteAddressFromFileAndLine(QString file,int source_line,int entry)
 {
    const cc65_sourceinfo* dbgSources;
    const cc65_lineinfo* dbgLines;
@@ -1541,14 +2063,7 @@ unsigned int CCC65Interface::nesGetAbsoluteAddressFromFileAndLine(QString file,i
 
             // Get segment information from span.
             dbgSegments = cc65_segment_byid(dbgInfo,dbgSpans->data[0].segment_id);
-            if ( dbgSegments->data[0].output_name )
-            {
-               absAddr = dbgSegments->data[0].output_offs+(dbgSpans->data[0].span_start-dbgSegments->data[0].segment_start)-0x10;
-            }
-            else
-            {
-               absAddr = dbgSegments->data[0].output_offs+(dbgSpans->data[0].span_start-dbgSegments->data[0].segment_start);
-            }
+            absAddr = dbgSegments->data[0].segment_start+(dbgSpans->data[0].span_start-dbgSegments->data[0].segment_start);
 
             cc65_free_spaninfo(dbgInfo,dbgSpans);
             cc65_free_segmentinfo(dbgInfo,dbgSegments);
@@ -1558,18 +2073,58 @@ unsigned int CCC65Interface::nesGetAbsoluteAddressFromFileAndLine(QString file,i
    return absAddr;
 }
 
-unsigned int CCC65Interface::c64GetAbsoluteAddressFromFileAndLine(QString file,int source_line,int entry)
+QHash<int,CCC65Interface::LineAddressList> CCC65Interface::getLineAddressesFromFile(QString file)
+{
+   // Dispatch to appropriate target machine handler.
+   if ( targetMachineType == Target_NES )
+   {
+      return nesGetLineAddressesFromFile(file);
+   }
+   else if ( targetMachineType == Target_C64 )
+   {
+      return c64GetLineAddressesFromFile(file);
+   }
+   return QHash<int,LineAddressList>();
+}
+
+QHash<int,CCC65Interface::LineAddressList> CCC65Interface::nesGetLineAddressesFromFile(QString file)
+{
+   QReadLocker locker(&addressIndexLock);
+   QHash<int,LineAddressList> lines;
+   QHash<QString,QHash<int,LineIndexEntry> >::const_iterator fileIter;
+   QHash<int,LineIndexEntry>::const_iterator lineIter;
+   int span;
+
+   fileIter = lineIndex.constFind(file);
+   if ( fileIter != lineIndex.constEnd() )
+   {
+      for ( lineIter = fileIter.value().constBegin(); lineIter != fileIter.value().constEnd(); ++lineIter )
+      {
+         // Only lines with a single line record have an address.
+         if ( lineIter.value().lineCount == 1 )
+         {
+            LineAddressList& addresses = lines[lineIter.key()];
+
+            for ( span = 0; span < lineIter.value().starts.count(); span++ )
+            {
+               addresses.append(qMakePair(lineIter.value().starts.at(span),lineIter.value().absStarts.at(span)));
+            }
+         }
+      }
+   }
+   return lines;
+}
+
+QHash<int,CCC65Interface::LineAddressList> CCC65Interface::c64GetLineAddressesFromFile(QString file)
 {
    const cc65_sourceinfo* dbgSources;
    const cc65_lineinfo* dbgLines;
-   const cc65_spaninfo* dbgSpans;
-   const cc65_segmentinfo* dbgSegments;
-   int highestTypeMatch = 0;
-   int indexOfHighestTypeMatch = -1;
-   int span;
+   QHash<int,LineAddressList> lines;
+   QSet<int> sourceLines;
+   int asmcount;
+   int asmline;
+   int line;
    int fidx;
-   int count = 0;
-   int absAddr = -1;
 
    if ( dbgInfo )
    {
@@ -1586,72 +2141,44 @@ unsigned int CCC65Interface::c64GetAbsoluteAddressFromFileAndLine(QString file,i
             }
          }
 
-         // Get line information from source file.
-         dbgLines = cc65_line_bynumber(dbgInfo,dbgSources->data[fidx].source_id,source_line);
-
-         if ( dbgLines && (dbgLines->count == 1) )
+         // Only visit the lines that have line information.
+         if ( fidx < dbgSources->count )
          {
-            // Get the spans for this line.
-            dbgSpans = cc65_span_byline(dbgInfo,dbgLines->data[0].line_id);
-
-            if ( dbgSpans )
+            dbgLines = cc65_line_bysource(dbgInfo,dbgSources->data[fidx].source_id);
+            if ( dbgLines )
             {
-               for ( span = 0; span < dbgSpans->count; span++ )
+               for ( line = 0; line < (int)dbgLines->count; line++ )
                {
-                  // Inject preference for MACRO expansions over C language over assembly...
-                  if ( dbgLines->data[0].line_type >= highestTypeMatch )
-                  {
-                     highestTypeMatch = dbgLines->data[0].line_type;
-                     indexOfHighestTypeMatch = dbgSpans->data[span].span_id;
-                  }
-
-                  if ( count == entry )
-                  {
-                     highestTypeMatch = dbgLines->data[0].line_type;
-                     indexOfHighestTypeMatch = dbgSpans->data[span].span_id;
-                     break;
-                  }
-
-                  // Keep track of when to return data if asked to break early.
-                  count++;
+                  sourceLines.insert(dbgLines->data[line].source_line);
                }
-
-               cc65_free_spaninfo(dbgInfo,dbgSpans);
+               cc65_free_lineinfo(dbgInfo,dbgLines);
             }
          }
 
-         if ( dbgLines )
-         {
-            cc65_free_lineinfo(dbgInfo,dbgLines);
-         }
-
          cc65_free_sourceinfo(dbgInfo,dbgSources);
+      }
 
-         if ( indexOfHighestTypeMatch >= 0 )
+      foreach ( line, sourceLines )
+      {
+         asmcount = getLineMatchCount(file,line);
+         for ( asmline = 0; asmline < asmcount; asmline++ )
          {
-            // Get span information.
-            dbgSpans = cc65_span_byid(dbgInfo,indexOfHighestTypeMatch);
-
-            // Get segment information from span.
-            dbgSegments = cc65_segment_byid(dbgInfo,dbgSpans->data[0].segment_id);
-            absAddr = dbgSegments->data[0].segment_start+(dbgSpans->data[0].span_start-dbgSegments->data[0].segment_start);
-
-            cc65_free_spaninfo(dbgInfo,dbgSpans);
-            cc65_free_segmentinfo(dbgInfo,dbgSegments);
+            lines[line].append(qMakePair((uint32_t)getAddressFromFileAndLine(file,line,asmline),
+                                         (uint32_t)c64GetAbsoluteAddressFromFileAndLine(file,line,asmline)));
          }
       }
    }
-   return absAddr;
+   return lines;
 }
 
 unsigned int CCC65Interface::getEndAddressFromAbsoluteAddress(uint32_t addr,uint32_t absAddr)
 {
    // Dispatch to appropriate target machine handler.
-   if ( !targetMachine.compare("nes",Qt::CaseInsensitive) )
+   if ( targetMachineType == Target_NES )
    {
       return nesGetEndAddressFromAbsoluteAddress(addr,absAddr);
    }
-   else if ( !targetMachine.compare("c64",Qt::CaseInsensitive) )
+   else if ( targetMachineType == Target_C64 )
    {
       return c64GetEndAddressFromAbsoluteAddress(addr,absAddr);
    }
@@ -1659,86 +2186,15 @@ unsigned int CCC65Interface::getEndAddressFromAbsoluteAddress(uint32_t addr,uint
 
 unsigned int CCC65Interface::nesGetEndAddressFromAbsoluteAddress(uint32_t addr,uint32_t absAddr)
 {
-   const cc65_lineinfo* dbgLines;
-   const cc65_spaninfo* dbgSpans;
-   const cc65_segmentinfo* dbgSegments;
-   int      span;
-   int      line;
-   int highestTypeMatch = 0;
-   int indexOfHighestTypeMatch = -1;
-   int endAddr = -1;
+   QReadLocker locker(&addressIndexLock);
+   int idx;
 
-   if ( dbgInfo )
+   idx = findSpanIndexEntry(addr,absAddr,true);
+   if ( idx >= 0 )
    {
-      dbgSpans = cc65_span_byaddr(dbgInfo,addr);
-
-      if ( dbgSpans )
-      {
-         for ( span = 0; span < dbgSpans->count; span++ )
-         {
-            dbgSegments = cc65_segment_byid(dbgInfo,dbgSpans->data[span].segment_id);
-
-            dbgLines = cc65_line_byspan(dbgInfo,dbgSpans->data[span].span_id);
-
-            if ( dbgSegments && (dbgSegments->count == 1) &&
-                 dbgLines && (dbgLines->count > 0) )
-            {
-               if ( dbgSegments->data[0].output_name )
-               {
-                  if ( (absAddr >= dbgSegments->data[0].output_offs+(dbgSpans->data[span].span_start-dbgSegments->data[0].segment_start)-0x10) &&
-                       (absAddr <= dbgSegments->data[0].output_offs+(dbgSpans->data[span].span_end-dbgSegments->data[0].segment_start)-0x10) )
-                  {
-                     for ( line = 0; line < dbgLines->count; line++ )
-                     {
-                        if ( dbgLines->data[line].line_type >= highestTypeMatch )
-                        {
-                           highestTypeMatch = dbgLines->data[line].line_type;
-                           indexOfHighestTypeMatch = dbgSpans->data[span].span_id;
-                        }
-                     }
-                  }
-               }
-               else
-               {
-                  if ( (absAddr >= dbgSegments->data[0].output_offs+(dbgSpans->data[span].span_start-dbgSegments->data[0].segment_start)) &&
-                       (absAddr <= dbgSegments->data[0].output_offs+(dbgSpans->data[span].span_end-dbgSegments->data[0].segment_start)) )
-                  {
-                     for ( line = 0; line < dbgLines->count; line++ )
-                     {
-                        if ( dbgLines->data[line].line_type >= highestTypeMatch )
-                        {
-                           highestTypeMatch = dbgLines->data[line].line_type;
-                           indexOfHighestTypeMatch = dbgSpans->data[span].span_id;
-                        }
-                     }
-                  }
-               }
-            }
-
-            if ( dbgLines )
-            {
-               cc65_free_lineinfo(dbgInfo,dbgLines);
-            }
-            if ( dbgSegments )
-            {
-               cc65_free_segmentinfo(dbgInfo,dbgSegments);
-            }
-         }
-
-         cc65_free_spaninfo(dbgInfo,dbgSpans);
-
-         if ( indexOfHighestTypeMatch >= 0 )
-         {
-            dbgSpans = cc65_span_byid(dbgInfo,indexOfHighestTypeMatch);
-
-            endAddr = dbgSpans->data[0].span_end;
-
-            cc65_free_spaninfo(dbgInfo,dbgSpans);
-         }
-      }
+      return spanIndex.at(idx).end;
    }
-
-   return endAddr;
+   return -1;
 }
 
 unsigned int CCC65Interface::c64GetEndAddressFromAbsoluteAddress(uint32_t addr,uint32_t absAddr)
@@ -1810,11 +2266,11 @@ unsigned int CCC65Interface::c64GetEndAddressFromAbsoluteAddress(uint32_t addr,u
 bool CCC65Interface::isAbsoluteAddressAnOpcode(uint32_t absAddr)
 {
    // Dispatch to appropriate target machine handler.
-   if ( !targetMachine.compare("nes",Qt::CaseInsensitive) )
+   if ( targetMachineType == Target_NES )
    {
       return nesIsAbsoluteAddressAnOpcode(absAddr);
    }
-   else if ( !targetMachine.compare("c64",Qt::CaseInsensitive) )
+   else if ( targetMachineType == Target_C64 )
    {
       return c64IsAbsoluteAddressAnOpcode(absAddr);
    }
@@ -1823,56 +2279,30 @@ bool CCC65Interface::isAbsoluteAddressAnOpcode(uint32_t absAddr)
 
 bool CCC65Interface::nesIsAbsoluteAddressAnOpcode(uint32_t absAddr)
 {
-   const cc65_spaninfo* dbgSpans;
-   const cc65_segmentinfo* dbgSegments;
+   QReadLocker locker(&addressIndexLock);
+   QVector<QPair<uint32_t,int> >::const_iterator iter;
    uint32_t addr;
-   int      span;
-   bool     opcode = false;
 
-   if ( dbgInfo )
+   // Look at the spans starting at this PRG-ROM offset.
+   iter = qLowerBound(spanIndexByAbsStart.constBegin(),spanIndexByAbsStart.constEnd(),qMakePair(absAddr,-1));
+   for ( ; (iter != spanIndexByAbsStart.constEnd()) && (iter->first == absAddr); ++iter )
    {
-      // Make addresses for where code might be in PRG-ROM space.
+      const SpanIndexEntry& span = spanIndex.at(iter->second);
+
+      // The span must cover one of the addresses in PRG-ROM space the
+      // offset can be banked in at.
       addr = (absAddr&MASK_8KB);
-      for ( ; addr < MEM_64KB; addr += MEM_8KB )
+      if ( span.start > addr )
       {
-         dbgSpans = cc65_span_byaddr(dbgInfo,addr);
-
-         if ( dbgSpans )
-         {
-            for ( span = 0; span < dbgSpans->count; span++ )
-            {
-               dbgSegments = cc65_segment_byid(dbgInfo,dbgSpans->data[span].segment_id);
-
-               if ( dbgSegments && (dbgSegments->count == 1) )
-               {
-                  if ( dbgSegments->data[0].output_name )
-                  {
-                     if ( absAddr == dbgSegments->data[0].output_offs+(dbgSpans->data[span].span_start-dbgSegments->data[0].segment_start)-0x10 )
-                     {
-                        opcode = true;
-                     }
-                  }
-                  else
-                  {
-                     if ( absAddr == dbgSegments->data[0].output_offs+(dbgSpans->data[span].span_start-dbgSegments->data[0].segment_start) )
-                     {
-                        opcode = true;
-                     }
-                  }
-               }
-
-               if ( dbgSegments )
-               {
-                  cc65_free_segmentinfo(dbgInfo,dbgSegments);
-               }
-            }
-
-            cc65_free_spaninfo(dbgInfo,dbgSpans);
-         }
+         addr += ((span.start-addr+MASK_8KB)/MEM_8KB)*MEM_8KB;
+      }
+      if ( (addr < MEM_64KB) && (addr <= span.end) )
+      {
+         return true;
       }
    }
 
-   return opcode;
+   return false;
 }
 
 bool CCC65Interface::c64IsAbsoluteAddressAnOpcode(uint32_t absAddr)
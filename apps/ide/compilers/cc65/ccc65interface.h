@@ -2,6 +2,11 @@
 #define CCC65INTERFACE_H
 
 #include <QProcess>
+#include <QHash>
+#include <QTime>
+#include <QVector>
+#include <QPair>
+#include <QReadWriteLock>
 
 #include "stdint.h"
 
@@ -11,6 +16,9 @@ class CCC65Interface : public QObject
 {
    Q_OBJECT
 public:
+   // Address and absolute address of each span of a source line.
+   typedef QList<QPair<uint32_t,uint32_t> > LineAddressList;
+
    // Class maintenance.
    CCC65Interface();
    virtual ~CCC65Interface();
@@ -20,8 +28,10 @@ public:
    static bool createMakefile();
    static void clean();
    static bool assemble();
+   static void cancel() { cancelRequested = true; }
    static bool captureDebugInfo();
    static bool isBuildUpToDate();
+   static bool isBuildStateCurrent();
    static bool captureINESImage();
    static QStringList getCLanguageSourcesFromProject();
    static QStringList getAssemblerSourcesFromProject();
@@ -46,6 +56,7 @@ public:
    static QStringList getErrors() { return errors; }
    static bool isErrorOnLineOfFile(QString file,int source_line);
    static bool isStringASymbol(QString string);
+   static int getDebugInfoRevision() { return dbgInfoRevision; }
 
    // Target-dependent launchpads.
    static QString getSourceFileFromAbsoluteAddress(uint32_t addr,uint32_t absAddr);
@@ -54,6 +65,7 @@ public:
    static unsigned int getEndAddressFromAbsoluteAddress(uint32_t addr,uint32_t absAddr);
    static bool isAbsoluteAddressAnOpcode(uint32_t absAddr);
    static unsigned int getSymbolAbsoluteAddress(QString symbol,int index = 0);
+   static QHash<int,LineAddressList> getLineAddressesFromFile(QString file);
 
    // NES target-dependent APIs.
    static QString nesGetSourceFileFromAbsoluteAddress(uint32_t addr,uint32_t absAddr);
@@ -62,6 +74,7 @@ public:
    static unsigned int nesGetEndAddressFromAbsoluteAddress(uint32_t addr,uint32_t absAddr);
    static bool nesIsAbsoluteAddressAnOpcode(uint32_t absAddr);
    static unsigned int nesGetSymbolAbsoluteAddress(QString symbol,int index = 0);
+   static QHash<int,LineAddressList> nesGetLineAddressesFromFile(QString file);
 
    // C64 target-dependent APIs.
    static QString c64GetSourceFileFromAbsoluteAddress(uint32_t addr,uint32_t absAddr);
@@ -70,11 +83,79 @@ public:
    static unsigned int c64GetEndAddressFromAbsoluteAddress(uint32_t addr,uint32_t absAddr);
    static bool c64IsAbsoluteAddressAnOpcode(uint32_t absAddr);
    static unsigned int c64GetSymbolAbsoluteAddress(QString symbol,int index = 0);
+   static QHash<int,LineAddressList> c64GetLineAddressesFromFile(QString file);
 
 protected:
+   enum
+   {
+      Target_None,
+      Target_NES,
+      Target_C64
+   };
+
+   // One span of the debug information, flattened for the NES address
+   // lookups.  The spans are kept sorted by start address and laid out
+   // as an implicit interval tree, maxEnd is the largest end address in
+   // the subtree of the entry.
+   typedef struct
+   {
+      uint32_t start;
+      uint32_t end;
+      uint32_t maxEnd;
+      uint32_t absStart;
+      uint32_t absEnd;
+      uint32_t segmentAbsStart;
+      uint32_t segmentSize;
+      int      lineType;     // Highest line type of the span's lines, -1 if none.
+      int      sourceLine;
+      QString  sourceFile;
+   } SpanIndexEntry;
+
+   // Spans of a source line, in debug information order.
+   typedef struct
+   {
+      int               lineCount;
+      QVector<uint32_t> starts;
+      QVector<uint32_t> absStarts;
+   } LineIndexEntry;
+
+   static void buildAddressIndex();
+   static bool spanIndexLessThan(const SpanIndexEntry& left,const SpanIndexEntry& right);
+   static bool spanIndexEntryMatches(const SpanIndexEntry& span,uint32_t addr,uint32_t absAddr,bool absInSpan);
+   static int findSpanIndexEntry(uint32_t addr,uint32_t absAddr,bool absInSpan);
+
+   // Size, modification time and content hash of a build input or output.
+   typedef struct
+   {
+      qint64     size;
+      uint       modified;
+      QByteArray hash;
+   } BuildFileState;
+
+   static QString getProgramFileName();
+   static QString getDebugInfoFileName();
+   static QString getBuildStateFileName();
+   static BuildFileState getFileState(QString fileName,const BuildFileState* previous = NULL);
+   static QHash<QString,BuildFileState> readBuildState();
+   static void saveBuildState();
+   static int runMake(QString invocationStr);
+   static void readMakeOutput(QProcess* make,bool flush);
+   static void processMakeLine(QString str,QProcess::ProcessChannel channel);
+
    static cc65_dbginfo        dbgInfo;
    static QStringList         errors;
    static QString             targetMachine;
+   static int                 targetMachineType;
+   static volatile bool       cancelRequested;
+   static QTime               buildTime;
+   static QHash<QString,int>  compileStartTimes;
+   static BuildFileState      dbgInfoState;
+   static int                 dbgInfoRevision;
+   static QReadWriteLock      addressIndexLock;
+   static QVector<SpanIndexEntry> spanIndex;
+   static int                 spanIndexRootLevel;
+   static QVector<QPair<uint32_t,int> > spanIndexByAbsStart;
+   static QHash<QString,QHash<int,LineIndexEntry> > lineIndex;
 };
 
 #endif // CCC65INTERFACE_H
@@ -2,6 +2,7 @@
 
 #include "ccartridgebuilder.h"
 #include "cmachineimagebuilder.h"
+#include "ccc65interface.h"
 
 #include "main.h"
 
@@ -23,6 +24,11 @@ CompilerThread::~CompilerThread()
    delete pThread;
 }
 
+void CompilerThread::cancel()
+{
+   CCC65Interface::cancel();
+}
+
 void CompilerThread::compile()
 {
    CCartridgeBuilder cartridgeBuilder;
@@ -20,6 +20,10 @@ public:
    bool assembledOk() { return m_assembledOk; }
    void reset() { m_assembledOk = false; }
 
+   // Called directly from the UI thread, the build loop polls for it.
+   void cancel();
+   void reportError(QString file,int line) { emit compileError(file,line); }
+
 public slots:
    void compile();
    void clean();
@@ -27,6 +31,7 @@ public slots:
 signals:
    void compileStarted();
    void compileDone(bool bOk);
+   void compileError(QString file,int line);
    void cleanStarted();
    void cleanDone(bool bOk);
 
@@ -360,11 +360,9 @@ int CCodeBrowserDisplayModel::columnCount(const QModelIndex& parent) const
 void CCodeBrowserDisplayModel::update()
 {
    // Update display...
-   if ( !nesicideProject->getProjectTarget().compare("nes",Qt::CaseInsensitive) )
-   {
-      nesDisassemble();
-   }
-   else if ( !nesicideProject->getProjectTarget().compare("c64",Qt::CaseInsensitive) )
+   // The NES emulator thread disassembles the visible banks before it signals
+   // a pause so there's no need to do it again on the GUI thread.
+   if ( !nesicideProject->getProjectTarget().compare("c64",Qt::CaseInsensitive) )
    {
       c64Disassemble();
    }
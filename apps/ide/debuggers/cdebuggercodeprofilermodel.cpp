@@ -1,5 +1,7 @@
 #include <QFileInfo>
 
+#include <algorithm>
+
 #include "cdebuggercodeprofilermodel.h"
 
 #include "ccc65interface.h"
@@ -9,12 +11,61 @@
 
 static char modelStringBuffer [ 2048 ];
 
+// Orders profiled items by a column.  Ties are broken by symbol so rows
+// with equal values don't move around between updates.
+class ProfiledItemLessThan
+{
+public:
+   ProfiledItemLessThan(int column,Qt::SortOrder order) : m_column(column), m_order(order) {}
+
+   bool operator()(const ProfiledItem& left,const ProfiledItem& right) const
+   {
+      const ProfiledItem& first = (m_order == Qt::AscendingOrder) ? left : right;
+      const ProfiledItem& second = (m_order == Qt::AscendingOrder) ? right : left;
+
+      switch ( m_column )
+      {
+      case CodeProfilerCol_Symbol:
+         return first.symbol < second.symbol;
+      case CodeProfilerCol_Address:
+         if ( first.address != second.address )
+         {
+            return first.address < second.address;
+         }
+         break;
+      case CodeProfilerCol_Size:
+         if ( first.size != second.size )
+         {
+            return first.size < second.size;
+         }
+         break;
+      case CodeProfilerCol_Calls:
+         if ( first.count != second.count )
+         {
+            return first.count < second.count;
+         }
+         break;
+      case CodeProfilerCol_File:
+         if ( first.file != second.file )
+         {
+            return first.file < second.file;
+         }
+         break;
+      }
+      return left.symbol < right.symbol;
+   }
+
+private:
+   int m_column;
+   Qt::SortOrder m_order;
+};
+
 CDebuggerCodeProfilerModel::CDebuggerCodeProfilerModel(QObject *parent) :
     QAbstractTableModel(parent)
 {
    m_currentSortColumn = CodeProfilerCol_Symbol;
    m_currentSortOrder = Qt::DescendingOrder;
-   m_currentItemCount = 0;
+   m_symbolsRevision = -1;
 }
 
 CDebuggerCodeProfilerModel::~CDebuggerCodeProfilerModel()
@@ -35,17 +86,9 @@ QModelIndex CDebuggerCodeProfilerModel::index(int row, int column, const QModelI
 {
    if ( (row >= 0) && (row < m_items.count()) )
    {
-      CCodeDataLogger* pLogger;
-      unsigned int addr;
-      unsigned int absAddr;
-
-      addr = CCC65Interface::getSymbolAddress(m_items.at(row).symbol);
-      absAddr = CCC65Interface::getSymbolAbsoluteAddress(m_items.at(row).symbol);
-
-      if ( addr >= MEM_32KB )
+      if ( m_items.at(row).addr >= MEM_32KB )
       {
-         pLogger = nesGetPhysicalPRGROMCodeDataLoggerDatabase(absAddr);
-         return createIndex(row,column,pLogger);
+         return createIndex(row,column,m_items.at(row).pLogger);
       }
       return QModelIndex();
    }
@@ -126,142 +169,120 @@ int CDebuggerCodeProfilerModel::columnCount(const QModelIndex&) const
    return CodeProfilerCol_MAX;
 }
 
-void CDebuggerCodeProfilerModel::update()
+void CDebuggerCodeProfilerModel::clear()
+{
+   m_items.clear();
+   m_itemRows.clear();
+
+   // The loggers belong to the loaded cartridge, look them up again.
+   m_symbolsRevision = -1;
+}
+
+void CDebuggerCodeProfilerModel::updateSymbols()
 {
    QStringList symbols = CCC65Interface::getSymbolsForSourceFile(""); // CPTODO: File doesn't matter (yet).
-   CCodeDataLogger* pLogger;
-   unsigned int addr;
    unsigned int absAddr;
    ProfiledItem item;
-   QFileInfo fileInfo;
-   unsigned int mask;
+
+   m_symbols.clear();
+   m_symbolsRevision = CCC65Interface::getDebugInfoRevision();
 
    foreach ( QString symbol, symbols )
    {
       // CPTODO: Temporary hack to get around temporary labels.
       if ( !symbol.startsWith('@') )
       {
-         addr = CCC65Interface::getSymbolAddress(symbol);
+         item.addr = CCC65Interface::getSymbolAddress(symbol);
          absAddr = CCC65Interface::getSymbolAbsoluteAddress(symbol);
 
          if ( absAddr != -1 )
          {
-            pLogger = NULL;
-            if ( addr >= 0x8000 )
+            item.pLogger = NULL;
+            if ( item.addr >= 0x8000 )
             {
-               pLogger = nesGetPhysicalPRGROMCodeDataLoggerDatabase(absAddr);
+               item.pLogger = nesGetPhysicalPRGROMCodeDataLoggerDatabase(absAddr);
             }
-            else if ( addr >= 0x6000 )
+            else if ( item.addr >= 0x6000 )
             {
-               pLogger = nesGetPhysicalSRAMCodeDataLoggerDatabase(absAddr);
+               item.pLogger = nesGetPhysicalSRAMCodeDataLoggerDatabase(absAddr);
             }
-            else if ( addr >= 0x5C00 )
+            else if ( item.addr >= 0x5C00 )
             {
-               pLogger = nesGetEXRAMCodeDataLoggerDatabase();
+               item.pLogger = nesGetEXRAMCodeDataLoggerDatabase();
             }
-            else if ( addr < 0x800 )
+            else if ( item.addr < 0x800 )
             {
-               pLogger = nesGetCpuCodeDataLoggerDatabase();
+               item.pLogger = nesGetCpuCodeDataLoggerDatabase();
             }
-            if ( pLogger )
+            if ( item.pLogger )
             {
-               mask = pLogger->GetMask();
-               if ( (pLogger->GetCount(addr&mask)) &&
-                    (pLogger->GetType(addr&mask) == eLogger_InstructionFetch) )
-               {
-                  item.symbol = symbol;
-                  item.size = CCC65Interface::getSymbolSize(symbol);
-                  item.file = CCC65Interface::getSourceFileFromSymbol(symbol);
-                  fileInfo.setFile(item.file);
-
-                  nesGetPrintableAddressWithAbsolute(modelStringBuffer,addr,absAddr);
-                  item.address = modelStringBuffer;
-                  item.count = pLogger->GetCount(addr&mask);
-                  if ( !m_items.contains(item) )
-                  {
-                     m_items.append(item);
-                  }
-                  else
-                  {
-                     m_items.replace(m_items.indexOf(item),item);
-                  }
-               }
+               item.symbol = symbol;
+               item.size = CCC65Interface::getSymbolSize(symbol);
+               item.file = CCC65Interface::getSourceFileFromSymbol(symbol);
+
+               nesGetPrintableAddressWithAbsolute(modelStringBuffer,item.addr,absAddr);
+               item.address = modelStringBuffer;
+               item.count = 0;
+               m_symbols.append(item);
             }
          }
       }
    }
-
-   sort(m_currentSortColumn,m_currentSortOrder);
 }
 
-void CDebuggerCodeProfilerModel::sort(int column, Qt::SortOrder order)
+void CDebuggerCodeProfilerModel::update()
 {
-   int idx1;
-   int idx2;
-   QString strData1;
-   QString strData2;
-   unsigned int uiData1;
-   unsigned int uiData2;
-
-   if ( (column != m_currentSortColumn) ||
-        (order != m_currentSortOrder) ||
-        (m_items.count() != m_currentItemCount) )
+   unsigned int mask;
+   unsigned int count;
+   int row;
+
+   // Symbols are only resolved again when the debug information changes.
+   if ( m_symbolsRevision != CCC65Interface::getDebugInfoRevision() )
+   {
+      updateSymbols();
+   }
+
+   foreach ( const ProfiledItem& symbol, m_symbols )
    {
-      for ( idx1 = 0; idx1 < m_items.count(); idx1++ )
+      mask = symbol.pLogger->GetMask();
+      count = symbol.pLogger->GetCount(symbol.addr&mask);
+      if ( (count) &&
+           (symbol.pLogger->GetType(symbol.addr&mask) == eLogger_InstructionFetch) )
       {
-         for ( idx2 = idx1; idx2 < m_items.count(); idx2++ )
+         row = m_itemRows.value(symbol.symbol,-1);
+         if ( row < 0 )
          {
-            switch ( column )
-            {
-            case CodeProfilerCol_Size:
-            case CodeProfilerCol_Calls:
-               // These columns require integer sorting.
-               uiData1 = data(index(idx1,column),Qt::DisplayRole).toInt();
-               uiData2 = data(index(idx2,column),Qt::DisplayRole).toInt();
-               switch ( order )
-               {
-               case Qt::AscendingOrder:
-                  if ( uiData1 > uiData2 )
-                  {
-                     m_items.swap(idx1,idx2);
-                  }
-                  break;
-               case Qt::DescendingOrder:
-                  if ( uiData2 > uiData1 )
-                  {
-                     m_items.swap(idx1,idx2);
-                  }
-                  break;
-               }
-               break;
-            default:
-               // Every other column can use string sorting.
-               strData1 = data(index(idx1,column),Qt::DisplayRole).toString();
-               strData2 = data(index(idx2,column),Qt::DisplayRole).toString();
-               switch ( order )
-               {
-               case Qt::AscendingOrder:
-                  if ( strData1 > strData2 )
-                  {
-                     m_items.swap(idx1,idx2);
-                  }
-                  break;
-               case Qt::DescendingOrder:
-                  if ( strData2 > strData1 )
-                  {
-                     m_items.swap(idx1,idx2);
-                  }
-                  break;
-               }
-               break;
-            }
+            m_itemRows.insert(symbol.symbol,m_items.count());
+            m_items.append(symbol);
+            m_items.last().count = count;
+         }
+         else
+         {
+            m_items[row] = symbol;
+            m_items[row].count = count;
          }
       }
    }
 
+   sort(m_currentSortColumn,m_currentSortOrder);
+}
+
+void CDebuggerCodeProfilerModel::sort(int column, Qt::SortOrder order)
+{
+   int row;
+
+   emit layoutAboutToBeChanged();
+
+   std::sort(m_items.begin(),m_items.end(),ProfiledItemLessThan(column,order));
+
+   m_itemRows.clear();
+   for ( row = 0; row < m_items.count(); row++ )
+   {
+      m_itemRows.insert(m_items.at(row).symbol,row);
+   }
+
    m_currentSortColumn = column;
    m_currentSortOrder = order;
-   m_currentItemCount = m_items.count();
 
    emit layoutChanged();
 }
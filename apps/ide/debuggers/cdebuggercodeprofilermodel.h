@@ -3,6 +3,9 @@
 
 #include <QAbstractTableModel>
 #include <QList>
+#include <QHash>
+
+class CCodeDataLogger;
 
 enum
 {
@@ -21,6 +24,8 @@ struct ProfiledItem
    QString address;
    unsigned int size;
    unsigned int count;
+   unsigned int addr;
+   CCodeDataLogger* pLogger;
    bool operator==(const ProfiledItem& rI)
    {
       if ( (rI.file == file) &&
@@ -48,7 +53,7 @@ public:
    int rowCount(const QModelIndex& parent = QModelIndex()) const;
 
    QList<ProfiledItem> getItems() { return m_items; }
-   void clear() { m_items.clear(); }
+   void clear();
 
 signals:
 
@@ -57,10 +62,14 @@ public slots:
    void sort(int column, Qt::SortOrder order);
 
 private:
+   void updateSymbols();
+
    QList<ProfiledItem> m_items;
+   QHash<QString,int> m_itemRows;
+   QList<ProfiledItem> m_symbols;
+   int m_symbolsRevision;
    int m_currentSortColumn;
    Qt::SortOrder m_currentSortOrder;
-   int m_currentItemCount;
 };
 
 #endif // CDEBUGGERCODEPROFILERMODEL_H
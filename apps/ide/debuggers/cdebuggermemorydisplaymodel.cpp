@@ -2,12 +2,21 @@
 
 #include <QColor>
 #include <QBrush>
+#include <QFont>
 
 static char modelStringBuffer [ 2048 ];
 
+// Updates are coalesced to the display refresh rate.
+#define REFRESH_INTERVAL_MS (1000/60)
+
 CDebuggerMemoryDisplayModel::CDebuggerMemoryDisplayModel(memDBFunc memDB,QObject*)
 {
    m_memDB = memDB;
+   m_snapshotMemDB = NULL;
+
+   m_refreshTimer.setSingleShot(true);
+   m_refreshTimer.setInterval(REFRESH_INTERVAL_MS);
+   QObject::connect(&m_refreshTimer,SIGNAL(timeout()),this,SLOT(refresh()));
 }
 
 CDebuggerMemoryDisplayModel::~CDebuggerMemoryDisplayModel()
@@ -47,9 +56,20 @@ int CDebuggerMemoryDisplayModel::memoryTop() const
    return 0;
 }
 
+uint32_t CDebuggerMemoryDisplayModel::cell(CMemoryDatabase* memDB,int idx) const
+{
+   // Serve the byte from the snapshot when it covers this memory.
+   if ( (memDB == m_snapshotMemDB) && (idx < m_snapshot.count()) )
+   {
+      return m_snapshot.at(idx);
+   }
+   return memDB->Get(idx);
+}
+
 QVariant CDebuggerMemoryDisplayModel::data(const QModelIndex& index, int role) const
 {
    CMemoryDatabase* memDB = m_memDB();
+   int idx;
 
    if (!index.isValid())
    {
@@ -58,18 +78,20 @@ QVariant CDebuggerMemoryDisplayModel::data(const QModelIndex& index, int role) c
 
    if ( memDB )
    {
+      idx = (index.row()*memDB->GetNumColumns())+index.column();
+
       if (role == Qt::BackgroundRole)
       {
-         return QBrush(QColor(memDB->GetCellRedComponent(memDB->Get((index.row()*memDB->GetNumColumns())+index.column())),
-                              memDB->GetCellGreenComponent(memDB->Get((index.row()*memDB->GetNumColumns())+index.column())),
-                              memDB->GetCellBlueComponent(memDB->Get((index.row()*memDB->GetNumColumns())+index.column()))));
+         return QBrush(QColor(memDB->GetCellRedComponent(cell(memDB,idx)),
+                              memDB->GetCellGreenComponent(cell(memDB,idx)),
+                              memDB->GetCellBlueComponent(cell(memDB,idx))));
       }
 
       if (role == Qt::ForegroundRole)
       {
-         QColor col = QColor(memDB->GetCellRedComponent(memDB->Get((index.row()*memDB->GetNumColumns())+index.column())),
-                             memDB->GetCellGreenComponent(memDB->Get((index.row()*memDB->GetNumColumns())+index.column())),
-                             memDB->GetCellBlueComponent(memDB->Get((index.row()*memDB->GetNumColumns())+index.column())));
+         QColor col = QColor(memDB->GetCellRedComponent(cell(memDB,idx)),
+                             memDB->GetCellGreenComponent(cell(memDB,idx)),
+                             memDB->GetCellBlueComponent(cell(memDB,idx)));
 
          if ((((double)col.red() +
                (double)col.green() +
@@ -82,6 +104,18 @@ QVariant CDebuggerMemoryDisplayModel::data(const QModelIndex& index, int role) c
             return QBrush(QColor(0, 0, 0));
          }
       }
+
+      // Highlight the bytes that changed in the last refresh.
+      if (role == Qt::FontRole)
+      {
+         if ( (memDB == m_snapshotMemDB) && (idx < m_changed.count()) && (m_changed.testBit(idx)) )
+         {
+            QFont font;
+            font.setBold(true);
+            return font;
+         }
+         return QVariant();
+      }
    }
 
    if (role != Qt::DisplayRole)
@@ -91,7 +125,7 @@ QVariant CDebuggerMemoryDisplayModel::data(const QModelIndex& index, int role) c
 
    if ( memDB )
    {
-      sprintf(modelStringBuffer,"%02X",memDB->Get((index.row()*memDB->GetNumColumns())+index.column()));
+      sprintf(modelStringBuffer,"%02X",cell(memDB,(index.row()*memDB->GetNumColumns())+index.column()));
    }
 
    return QVariant(modelStringBuffer);
@@ -141,6 +175,7 @@ QVariant CDebuggerMemoryDisplayModel::headerData(int section, Qt::Orientation or
 bool CDebuggerMemoryDisplayModel::setData ( const QModelIndex& index, const QVariant& value, int )
 {
    unsigned int data;
+   int idx;
    bool ok = false;
 
    if ( m_memDB() )
@@ -149,7 +184,14 @@ bool CDebuggerMemoryDisplayModel::setData ( const QModelIndex& index, const QVar
 
       if ( ok )
       {
-         m_memDB()->Set((index.row()*m_memDB()->GetNumColumns())+index.column(),data);
+         idx = (index.row()*m_memDB()->GetNumColumns())+index.column();
+         m_memDB()->Set(idx,data);
+
+         // Keep the snapshot in step so the edit isn't seen as a change.
+         if ( (m_memDB() == m_snapshotMemDB) && (idx < m_snapshot.count()) )
+         {
+            m_snapshot[idx] = m_memDB()->Get(idx);
+         }
          emit dataChanged(index,index);
       }
    }
@@ -192,5 +234,99 @@ int CDebuggerMemoryDisplayModel::columnCount(const QModelIndex& /*parent*/) cons
 
 void CDebuggerMemoryDisplayModel::update()
 {
-   emit dataChanged(QModelIndex(),QModelIndex());
+   // Several updates in one display refresh only refresh once.
+   if ( !m_refreshTimer.isActive() )
+   {
+      m_refreshTimer.start();
+   }
+}
+
+void CDebuggerMemoryDisplayModel::refresh()
+{
+   CMemoryDatabase* memDB = m_memDB();
+   QBitArray changed;
+   QList<QPair<int,int> > rows;
+   uint32_t value;
+   bool rowChanged;
+   int firstRow = -1;
+   int columns;
+   int size;
+   int row;
+   int col;
+   int idx;
+
+   if ( !memDB )
+   {
+      if ( m_snapshotMemDB )
+      {
+         m_snapshotMemDB = NULL;
+         m_snapshot.clear();
+         m_changed.clear();
+         reset();
+      }
+      return;
+   }
+
+   columns = memDB->GetNumColumns();
+   size = memDB->GetSize();
+
+   // Different memory to look at, start over without highlights.
+   if ( (memDB != m_snapshotMemDB) || (size != m_snapshot.count()) )
+   {
+      m_snapshotMemDB = memDB;
+      m_snapshot.resize(size);
+      for ( idx = 0; idx < size; idx++ )
+      {
+         m_snapshot[idx] = memDB->Get(idx);
+      }
+      m_changed.fill(false,size);
+      reset();
+      return;
+   }
+
+   // Compare against the snapshot and tell the view about runs of rows
+   // that changed, or that need their highlight removed.
+   changed.fill(false,size);
+   for ( row = 0; row < memDB->GetNumRows(); row++ )
+   {
+      rowChanged = false;
+      for ( col = 0; col < columns; col++ )
+      {
+         idx = (row*columns)+col;
+         value = memDB->Get(idx);
+         if ( value != m_snapshot.at(idx) )
+         {
+            m_snapshot[idx] = value;
+            changed.setBit(idx);
+            rowChanged = true;
+         }
+         else if ( m_changed.testBit(idx) )
+         {
+            rowChanged = true;
+         }
+      }
+
+      if ( rowChanged )
+      {
+         if ( firstRow < 0 )
+         {
+            firstRow = row;
+         }
+      }
+      else if ( firstRow >= 0 )
+      {
+         rows.append(qMakePair(firstRow,row-1));
+         firstRow = -1;
+      }
+   }
+   if ( firstRow >= 0 )
+   {
+      rows.append(qMakePair(firstRow,row-1));
+   }
+
+   m_changed = changed;
+   for ( idx = 0; idx < rows.count(); idx++ )
+   {
+      emit dataChanged(index(rows.at(idx).first,0),index(rows.at(idx).second,columns-1));
+   }
 }
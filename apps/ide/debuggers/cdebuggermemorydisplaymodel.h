@@ -2,6 +2,9 @@
 #define CDEBUGGERMEMORYDISPLAYMODEL_H
 
 #include <QAbstractTableModel>
+#include <QBitArray>
+#include <QTimer>
+#include <QVector>
 
 #include "cmemorydata.h"
 
@@ -28,8 +31,19 @@ public:
 public slots:
    void update(void);
 
+private slots:
+   void refresh(void);
+
 private:
+   uint32_t cell(CMemoryDatabase* memDB,int idx) const;
+
    memDBFunc m_memDB;
+
+   // Memory as of the last refresh, and the bytes that changed in it.
+   CMemoryDatabase* m_snapshotMemDB;
+   QVector<uint32_t> m_snapshot;
+   QBitArray m_changed;
+   QTimer m_refreshTimer;
 };
 
 #endif // CDEBUGGERMEMORYDISPLAYMODEL_H
@@ -1,4 +1,7 @@
 #include <QInputDialog>
+#include <QVector>
+
+#include <algorithm>
 
 #include "csymbolwatchmodel.h"
 
@@ -9,6 +12,82 @@ static char modelStringBuffer [ 2048 ];
 
 static const char* CLICK_TO_ADD_OR_EDIT = "<click to add or edit>";
 
+// Orders rows of watched items by a column.  Ties are broken by row so
+// equal rows keep their order.
+class WatchedRowLessThan
+{
+public:
+   WatchedRowLessThan(const QList<WatchedItem>& items,const QList<WatchedSymbol>& symbols,int column,Qt::SortOrder order)
+      : m_items(items), m_symbols(symbols), m_column(column), m_order(order) {}
+
+   bool operator()(int left,int right) const
+   {
+      int first = (m_order == Qt::AscendingOrder) ? left : right;
+      int second = (m_order == Qt::AscendingOrder) ? right : left;
+
+      switch ( m_column )
+      {
+      case SymbolWatchCol_Symbol:
+         if ( m_items.at(first).symbol != m_items.at(second).symbol )
+         {
+            return m_items.at(first).symbol < m_items.at(second).symbol;
+         }
+         break;
+      case SymbolWatchCol_Address:
+         if ( m_symbols.at(first).address != m_symbols.at(second).address )
+         {
+            return m_symbols.at(first).address < m_symbols.at(second).address;
+         }
+         break;
+      case SymbolWatchCol_Size:
+         if ( m_symbols.at(first).size != m_symbols.at(second).size )
+         {
+            return m_symbols.at(first).size < m_symbols.at(second).size;
+         }
+         break;
+      case SymbolWatchCol_Value:
+         if ( value(first) != value(second) )
+         {
+            return value(first) < value(second);
+         }
+         break;
+      case SymbolWatchCol_Segment:
+         if ( m_symbols.at(first).segmentName != m_symbols.at(second).segmentName )
+         {
+            return m_symbols.at(first).segmentName < m_symbols.at(second).segmentName;
+         }
+         break;
+      case SymbolWatchCol_File:
+         if ( m_symbols.at(first).file != m_symbols.at(second).file )
+         {
+            return m_symbols.at(first).file < m_symbols.at(second).file;
+         }
+         break;
+      }
+      return left < right;
+   }
+
+private:
+   // Little-endian value of the first eight bytes of a row.
+   quint64 value(int row) const
+   {
+      const QByteArray& bytes = m_symbols.at(row).value;
+      quint64 data = 0;
+      int idx;
+
+      for ( idx = qMin(bytes.count(),8)-1; idx >= 0; idx-- )
+      {
+         data = (data<<8)|(unsigned char)bytes.at(idx);
+      }
+      return data;
+   }
+
+   const QList<WatchedItem>& m_items;
+   const QList<WatchedSymbol>& m_symbols;
+   int m_column;
+   Qt::SortOrder m_order;
+};
+
 CSymbolWatchModel::CSymbolWatchModel(bool editable,QObject *parent) :
     QAbstractTableModel(parent)
 {
@@ -16,6 +95,7 @@ CSymbolWatchModel::CSymbolWatchModel(bool editable,QObject *parent) :
    m_currentSortOrder = Qt::DescendingOrder;
    m_currentItemCount = 0;
    m_editable = editable;
+   m_symbolsRevision = CCC65Interface::getDebugInfoRevision();
 }
 
 CSymbolWatchModel::~CSymbolWatchModel()
@@ -41,12 +121,6 @@ Qt::ItemFlags CSymbolWatchModel::flags(const QModelIndex& index) const
 
 QVariant CSymbolWatchModel::data(const QModelIndex& index, int role) const
 {
-   int addr;
-   int absAddr;
-   QString data;
-   int symbolIdx;
-   int size;
-
    if (role != Qt::DisplayRole)
    {
       return QVariant();
@@ -55,8 +129,7 @@ QVariant CSymbolWatchModel::data(const QModelIndex& index, int role) const
    // Get data for columns...
    if ( index.row() < m_items.count() )
    {
-      // Get symbol's index in debug information from its segment.
-      symbolIdx = CCC65Interface::getSymbolIndexFromSegment(m_items.at(index.row()).symbol,m_items.at(index.row()).segment);
+      const WatchedSymbol& symbol = m_symbols.at(index.row());
 
       switch ( index.column() )
       {
@@ -64,24 +137,12 @@ QVariant CSymbolWatchModel::data(const QModelIndex& index, int role) const
             return m_items.at(index.row()).symbol;
             break;
          case SymbolWatchCol_Address:
-            // Get symbol's information based on its name and index.
-            addr = CCC65Interface::getSymbolAddress(m_items.at(index.row()).symbol,symbolIdx);
-            absAddr = CCC65Interface::getSymbolAbsoluteAddress(m_items.at(index.row()).symbol,symbolIdx);
-            if ( addr != -1 )
-            {
-               nesGetPrintableAddressWithAbsolute(modelStringBuffer,addr,absAddr);
-               return QVariant(modelStringBuffer);
-            }
-            else
-            {
-               return QVariant("ERROR: Unresolved");
-            }
+            return symbol.address;
             break;
          case SymbolWatchCol_Size:
-            size = CCC65Interface::getSymbolSize(m_items.at(index.row()).symbol,symbolIdx);
-            if ( size )
+            if ( symbol.size )
             {
-               return QVariant(size);
+               return QVariant(symbol.size);
             }
             else
             {
@@ -89,51 +150,13 @@ QVariant CSymbolWatchModel::data(const QModelIndex& index, int role) const
             }
             break;
          case SymbolWatchCol_Value:
-            addr = CCC65Interface::getSymbolAddress(m_items.at(index.row()).symbol,symbolIdx);
-            if ( addr != -1 )
-            {
-               char* bufferPtr = modelStringBuffer;
-               unsigned int symbolSize = CCC65Interface::getSymbolSize(m_items.at(index.row()).symbol,symbolIdx);
-
-               // If symbol size <= 10 print values as an array, seperated by commas
-               if ((symbolSize > 0) && (symbolSize <= 10))
-               {
-                  unsigned int i=0;
-                  for( ; i < symbolSize; ++i)
-                  {
-                     bufferPtr += sprintf(bufferPtr, "%02X", nesGetMemory(addr + i));
-                     if ( i < (symbolSize-1) )
-                     {
-                        bufferPtr += sprintf(bufferPtr, ",");
-                     }
-                  }
-
-                  // If symbol is 2 bytes, print 16bit value in parentheses.
-                  if (symbolSize == 2)
-                  {
-                     sprintf(bufferPtr, " ($%02X%02X)",  nesGetMemory(addr + 1),  nesGetMemory(addr + 0));
-                  }
-                  else if (symbolSize == 3) // Same for 24 bit values.
-                  {
-                     sprintf(bufferPtr, " ($%02X%02X%02X)",  nesGetMemory(addr + 2), nesGetMemory(addr + 1),  nesGetMemory(addr + 0));
-                  }
-               }
-               else
-               {
-                  return QVariant("?");
-               }
-               return QVariant(modelStringBuffer);
-            }
-            else
-            {
-               return QVariant("ERROR: Unresolved");
-            }
+            return symbol.valueText;
             break;
          case SymbolWatchCol_Segment:
-            return CCC65Interface::getSymbolSegmentName(m_items.at(index.row()).symbol,symbolIdx);
+            return symbol.segmentName;
             break;
          case SymbolWatchCol_File:
-            return CCC65Interface::getSourceFileFromSymbol(m_items.at(index.row()).symbol);
+            return symbol.file;
             break;
       }
    }
@@ -170,6 +193,7 @@ bool CSymbolWatchModel::setData(const QModelIndex &index, const QVariant &value,
                item.symbol = value.toString();
                item.segment = resolveSymbol(value.toString());
                m_items.replace(index.row(),item);
+               m_symbols.replace(index.row(),compileSymbol(item));
                emit layoutChanged();
                ok = true;
             }
@@ -182,6 +206,7 @@ bool CSymbolWatchModel::setData(const QModelIndex &index, const QVariant &value,
                   item.symbol = value.toString();
                   item.segment = resolveSymbol(value.toString());
                   m_items.append(item);
+                  m_symbols.append(compileSymbol(item));
                   endInsertRows();
 
                   ok = true;
@@ -195,11 +220,12 @@ bool CSymbolWatchModel::setData(const QModelIndex &index, const QVariant &value,
       case SymbolWatchCol_Value:
          if ( index.row() < m_items.count() )
          {
-            addr = CCC65Interface::getSymbolAddress(m_items.at(index.row()).symbol,CCC65Interface::getSymbolIndexFromSegment(value.toString(),m_items.at(index.row()).segment));
+            addr = m_symbols.at(index.row()).addr;
             if ( addr != 0xFFFFFFFF )
             {
                nesSetCPUMemory(addr,value.toString().toInt(&ok,16));
             }
+            readSymbolValue(m_symbols[index.row()]);
             emit dataChanged(index,index);
          }
          break;
@@ -259,9 +285,140 @@ int CSymbolWatchModel::columnCount(const QModelIndex&) const
    return SymbolWatchCol_MAX;
 }
 
+void CSymbolWatchModel::setItems(QList<WatchedItem> items)
+{
+   int row;
+
+   // The whole list is replaced, views must drop their indexes into it.
+   beginResetModel();
+   m_items = items;
+   m_symbols.clear();
+   for ( row = 0; row < m_items.count(); row++ )
+   {
+      m_symbols.append(compileSymbol(m_items.at(row)));
+   }
+   m_symbolsRevision = CCC65Interface::getDebugInfoRevision();
+   endResetModel();
+}
+
+WatchedSymbol CSymbolWatchModel::compileSymbol(const WatchedItem& item)
+{
+   WatchedSymbol symbol;
+   int symbolIdx;
+
+   // Get symbol's index in debug information from its segment.
+   symbolIdx = CCC65Interface::getSymbolIndexFromSegment(item.symbol,item.segment);
+
+   symbol.addr = CCC65Interface::getSymbolAddress(item.symbol,symbolIdx);
+   symbol.absAddr = CCC65Interface::getSymbolAbsoluteAddress(item.symbol,symbolIdx);
+   symbol.size = CCC65Interface::getSymbolSize(item.symbol,symbolIdx);
+   symbol.segmentName = CCC65Interface::getSymbolSegmentName(item.symbol,symbolIdx);
+   symbol.file = CCC65Interface::getSourceFileFromSymbol(item.symbol);
+   if ( symbol.addr != 0xFFFFFFFF )
+   {
+      nesGetPrintableAddressWithAbsolute(modelStringBuffer,symbol.addr,symbol.absAddr);
+      symbol.address = modelStringBuffer;
+   }
+   else
+   {
+      symbol.address = "ERROR: Unresolved";
+   }
+
+   readSymbolValue(symbol);
+
+   return symbol;
+}
+
+bool CSymbolWatchModel::readSymbolValue(WatchedSymbol& symbol)
+{
+   QByteArray value;
+   char* bufferPtr = modelStringBuffer;
+   unsigned int i;
+
+   // Values of symbols up to 10 bytes are shown.
+   if ( (symbol.addr != 0xFFFFFFFF) &&
+        (symbol.size > 0) && (symbol.size <= 10) )
+   {
+      value.resize(symbol.size);
+      for ( i = 0; i < symbol.size; i++ )
+      {
+         value[i] = nesGetMemory(symbol.addr+i);
+      }
+   }
+
+   if ( (!symbol.valueText.isEmpty()) && (value == symbol.value) )
+   {
+      return false;
+   }
+   symbol.value = value;
+
+   if ( symbol.addr == 0xFFFFFFFF )
+   {
+      symbol.valueText = "ERROR: Unresolved";
+   }
+   else if ( value.isEmpty() )
+   {
+      symbol.valueText = "?";
+   }
+   else
+   {
+      // Print values as an array, seperated by commas
+      for ( i = 0; i < symbol.size; i++ )
+      {
+         bufferPtr += sprintf(bufferPtr, "%02X", (unsigned char)value.at(i));
+         if ( i < (symbol.size-1) )
+         {
+            bufferPtr += sprintf(bufferPtr, ",");
+         }
+      }
+
+      // If symbol is 2 bytes, print 16bit value in parentheses.
+      if (symbol.size == 2)
+      {
+         sprintf(bufferPtr, " ($%02X%02X)", (unsigned char)value.at(1), (unsigned char)value.at(0));
+      }
+      else if (symbol.size == 3) // Same for 24 bit values.
+      {
+         sprintf(bufferPtr, " ($%02X%02X%02X)", (unsigned char)value.at(2), (unsigned char)value.at(1), (unsigned char)value.at(0));
+      }
+      symbol.valueText = modelStringBuffer;
+   }
+   return true;
+}
+
 void CSymbolWatchModel::update()
 {
+   int firstRow = -1;
+   int row;
+
+   // Resolve the watched items again if the debug information changed.
+   if ( m_symbolsRevision != CCC65Interface::getDebugInfoRevision() )
+   {
+      setItems(m_items);
+   }
+
    sort(m_currentSortColumn,m_currentSortOrder);
+
+   // Read all values and repaint the runs of rows whose values changed.
+   for ( row = 0; row < m_symbols.count(); row++ )
+   {
+      if ( readSymbolValue(m_symbols[row]) )
+      {
+         if ( firstRow < 0 )
+         {
+            firstRow = row;
+         }
+      }
+      else if ( firstRow >= 0 )
+      {
+         emit dataChanged(index(firstRow,SymbolWatchCol_Value),index(row-1,SymbolWatchCol_Value));
+         firstRow = -1;
+      }
+   }
+   if ( firstRow >= 0 )
+   {
+      emit dataChanged(index(firstRow,SymbolWatchCol_Value),index(row-1,SymbolWatchCol_Value));
+   }
 }
 
 void CSymbolWatchModel::removeRow(int row, const QModelIndex &parent)
@@ -270,6 +427,7 @@ void CSymbolWatchModel::removeRow(int row, const QModelIndex &parent)
    {
       beginRemoveRows(parent,row,row);
       m_items.removeAt(row);
+      m_symbols.removeAt(row);
       endRemoveRows();
    }
 }
@@ -284,6 +442,7 @@ bool CSymbolWatchModel::removeRows(int row, int count, const QModelIndex &parent
       for ( idx = row+count-1; idx >= row; idx-- )
       {
          m_items.removeAt(idx);
+         m_symbols.removeAt(idx);
       }
       endRemoveRows();
       return true;
@@ -299,6 +458,7 @@ void CSymbolWatchModel::insertRow(QString text, int addr, const QModelIndex& par
    item.symbol = text;
    item.segment = resolveSymbol(text,addr);
    m_items.append(item);
+   m_symbols.append(compileSymbol(item));
    endInsertRows();
 }
 
@@ -361,72 +521,36 @@ int CSymbolWatchModel::resolveSymbol(QString text,int addr)
 
 void CSymbolWatchModel::sort(int column, Qt::SortOrder order)
 {
-   int idx1;
-   int idx2;
-   QString strData1;
-   QString strData2;
-   unsigned int uiData1;
-   unsigned int uiData2;
+   QList<WatchedItem> items;
+   QList<WatchedSymbol> symbols;
+   QVector<int> rows;
+   int row;
 
    if ( (m_currentSortColumn != column) ||
         (m_currentSortOrder != order) ||
         (m_currentItemCount != m_items.count()) )
    {
-      for ( idx1 = 0; idx1 < m_items.count(); idx1++ )
+      emit layoutAboutToBeChanged();
+
+      rows.resize(m_items.count());
+      for ( row = 0; row < rows.count(); row++ )
       {
-         for ( idx2 = idx1; idx2 < m_items.count(); idx2++ )
-         {
-            switch ( column )
-            {
-            case SymbolWatchCol_Size:
-            case SymbolWatchCol_Value:
-               // These columns require integer sort.
-               uiData1 = data(index(idx1,column),Qt::DisplayRole).toString().toInt(NULL,16);
-               uiData2 = data(index(idx2,column),Qt::DisplayRole).toString().toInt(NULL,16);
-               switch ( order )
-               {
-               case Qt::AscendingOrder:
-                  if ( uiData1 > uiData2 )
-                  {
-                     m_items.swap(idx1,idx2);
-                  }
-                  break;
-               case Qt::DescendingOrder:
-                  if ( uiData2 > uiData1 )
-                  {
-                     m_items.swap(idx1,idx2);
-                  }
-                  break;
-               }
-               break;
-            default:
-               // Every other column can use string sorting.
-               strData1 = data(index(idx1,column),Qt::DisplayRole).toString();
-               strData2 = data(index(idx2,column),Qt::DisplayRole).toString();
-               switch ( order )
-               {
-               case Qt::AscendingOrder:
-                  if ( strData1 > strData2 )
-                  {
-                     m_items.swap(idx1,idx2);
-                  }
-                  break;
-               case Qt::DescendingOrder:
-                  if ( strData2 > strData1 )
-                  {
-                     m_items.swap(idx1,idx2);
-                  }
-                  break;
-               }
-               break;
-            }
-         }
+         rows[row] = row;
       }
-   }
+      std::sort(rows.begin(),rows.end(),WatchedRowLessThan(m_items,m_symbols,column,order));
 
-   m_currentSortColumn = column;
-   m_currentSortOrder = order;
-   m_currentItemCount = m_items.count();
+      foreach ( row, rows )
+      {
+         items.append(m_items.at(row));
+         symbols.append(m_symbols.at(row));
+      }
+      m_items = items;
+      m_symbols = symbols;
 
-   emit layoutChanged();
+      m_currentSortColumn = column;
+      m_currentSortOrder = order;
+      m_currentItemCount = m_items.count();
+
+      emit layoutChanged();
+   }
 }
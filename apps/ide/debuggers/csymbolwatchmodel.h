@@ -22,6 +22,20 @@ struct WatchedItem
    int     segment;
 };
 
+// A watched item resolved against the debug information, and its value
+// as of the last update.
+struct WatchedSymbol
+{
+   unsigned int addr;
+   unsigned int absAddr;
+   unsigned int size;
+   QString      address;
+   QString      segmentName;
+   QString      file;
+   QByteArray   value;
+   QString      valueText;
+};
+
 class CSymbolWatchModel : public QAbstractTableModel
 {
    Q_OBJECT
@@ -39,7 +53,7 @@ public:
    void insertRow(QString text, int addr = -1, const QModelIndex &parent = QModelIndex());
 
    QList<WatchedItem> getItems() { return m_items; }
-   void setItems(QList<WatchedItem> items) { m_items = items; }
+   void setItems(QList<WatchedItem> items);
 
    int resolveSymbol(QString text,int addr = -1);
 
@@ -48,7 +62,12 @@ public slots:
    void sort(int column, Qt::SortOrder order);
 
 private:
+   WatchedSymbol compileSymbol(const WatchedItem& item);
+   bool readSymbolValue(WatchedSymbol& symbol);
+
    QList<WatchedItem> m_items;
+   QList<WatchedSymbol> m_symbols;
+   int m_symbolsRevision;
    int m_currentSortColumn;
    Qt::SortOrder m_currentSortOrder;
    int m_currentItemCount;
@@ -131,6 +131,7 @@ CodeEditorForm::CodeEditorForm(QString fileName,QString sourceCode,IProjectTreeV
 
    QObject::connect ( compiler, SIGNAL(compileStarted()), this, SLOT(compiler_compileStarted()) );
    QObject::connect ( compiler, SIGNAL(compileDone(bool)), this, SLOT(compiler_compileDone(bool)) );
+   QObject::connect ( compiler, SIGNAL(compileError(QString,int)), this, SLOT(compiler_compileError(QString,int)) );
    QObject::connect ( breakpointWatcher, SIGNAL(breakpointHit()), this,SLOT(breakpointHit()) );
    if ( emulator )
    {
@@ -384,10 +385,21 @@ void CodeEditorForm::compiler_compileStarted()
    m_scintilla->clearAnnotations();
 }
 
+void CodeEditorForm::compiler_compileError(QString file,int line)
+{
+   // Same match as CCC65Interface::isErrorOnLineOfFile.
+   if ( file.endsWith(m_fileName) )
+   {
+      m_scintilla->markerAdd(line-1,Marker_Error);
+   }
+}
+
 void CodeEditorForm::compiler_compileDone(bool ok)
 {
    int line;
 
+   // Errors were marked as they came in, mark them again from the full list.
+   m_scintilla->markerDeleteAll(Marker_Error);
    for ( line = 0; line < m_scintilla->lines(); line++ )
    {
       if ( CCC65Interface::isErrorOnLineOfFile(m_fileName,line+1) )
@@ -412,12 +424,26 @@ void CodeEditorForm::external_breakpointsChanged()
 {
    CMarker* markers = nesGetExecutionMarkerDatabase();
    MarkerSetInfo* pMarker;
+   BreakpointInfo* pBreakpoint;
+   QHash<int,CCC65Interface::LineAddressList> lineAddresses;
+   QHash<int,CCC65Interface::LineAddressList>::const_iterator lineIter;
+   QHash<uint32_t,uint32_t> breakpointsEnabled;
+   QHash<uint32_t,uint32_t> breakpointsDisabled;
+   QHash<uint32_t,uint32_t>* breakpoints;
+   QHash<int,unsigned int> linesWanted;
+   QHash<int,unsigned int> linesMarked;
+   QHash<int,unsigned int>::const_iterator markIter;
+   QList<int> markersActive;
+   uint32_t breakpointEnabledLowest = 0xFFFFFFFF;
+   uint32_t breakpointDisabledLowest = 0xFFFFFFFF;
+   unsigned int markerMask;
+   unsigned int wanted;
+   unsigned int marked;
    unsigned int addr;
    unsigned int absAddr;
+   int lines = m_scintilla->lines();
    int line;
-   int index;
    int idx;
-   int asmcount;
    int asmline;
 
    if ( !nesicideProject->getProjectTarget().compare("nes",Qt::CaseInsensitive) )
@@ -429,62 +455,140 @@ void CodeEditorForm::external_breakpointsChanged()
       m_pBreakpoints = c64GetBreakpointDatabase();
    }
 
-   m_scintilla->getCursorPosition(&line,&index);
-
-   m_scintilla->markerDeleteAll(Marker_Breakpoint);
-   m_scintilla->markerDeleteAll(Marker_BreakpointDisabled);
+   // Markers this function owns in the margin.
+   markerMask = (1<<Marker_Breakpoint)|(1<<Marker_BreakpointDisabled);
    for ( idx = 0; idx < markers->GetNumMarkers(); idx++ )
    {
-      m_scintilla->markerDeleteAll(Marker_Marker1+idx);
+      markerMask |= (1<<(Marker_Marker1+idx));
+
+      pMarker = markers->GetMarker(idx);
+      if ( (pMarker->state == eMarkerSet_Started) ||
+           (pMarker->state == eMarkerSet_Complete) )
+      {
+         markersActive.append(idx);
+      }
    }
 
-   for ( line = 0; line < m_scintilla->lines(); line++ )
+   // Group the CPU execution breakpoints by absolute address, keeping the
+   // lowest address of each.  A line without an absolute address matches
+   // any breakpoint at or below its address.
+   if ( m_pBreakpoints )
    {
-      asmcount = CCC65Interface::getLineMatchCount(m_fileName,line+1);
-      for ( asmline = 0; asmline < asmcount; asmline++ )
+      for ( idx = 0; idx < m_pBreakpoints->GetNumBreakpoints(); idx++ )
       {
-         addr = CCC65Interface::getAddressFromFileAndLine(m_fileName,line+1,asmline);
-         absAddr = CCC65Interface::getAbsoluteAddressFromFileAndLine(m_fileName,line+1,asmline);
+         pBreakpoint = m_pBreakpoints->GetBreakpoint(idx);
+
+         if ( pBreakpoint->type == eBreakOnCPUExecution )
+         {
+            breakpoints = pBreakpoint->enabled ? &breakpointsEnabled : &breakpointsDisabled;
+            if ( (!breakpoints->contains(pBreakpoint->item1Absolute)) ||
+                 (pBreakpoint->item1 < breakpoints->value(pBreakpoint->item1Absolute)) )
+            {
+               breakpoints->insert(pBreakpoint->item1Absolute,pBreakpoint->item1);
+            }
+            if ( pBreakpoint->enabled )
+            {
+               breakpointEnabledLowest = qMin(breakpointEnabledLowest,pBreakpoint->item1);
+            }
+            else
+            {
+               breakpointDisabledLowest = qMin(breakpointDisabledLowest,pBreakpoint->item1);
+            }
+         }
+      }
+   }
+
+   // Work out the markers every line with code should have.
+   lineAddresses = CCC65Interface::getLineAddressesFromFile(m_fileName);
+   for ( lineIter = lineAddresses.constBegin(); lineIter != lineAddresses.constEnd(); ++lineIter )
+   {
+      line = lineIter.key()-1;
+      if ( (line < 0) || (line >= lines) )
+      {
+         continue;
+      }
+
+      wanted = 0;
+      for ( asmline = 0; asmline < lineIter.value().count(); asmline++ )
+      {
+         addr = lineIter.value().at(asmline).first;
+         absAddr = lineIter.value().at(asmline).second;
 
          if ( addr != (unsigned int)-1 )
          {
-            for ( idx = 0; idx < markers->GetNumMarkers(); idx++ )
+            foreach ( idx, markersActive )
             {
                pMarker = markers->GetMarker(idx);
 
-               if ( (pMarker->state == eMarkerSet_Started) ||
-                    (pMarker->state == eMarkerSet_Complete) )
+               if ( (absAddr >= pMarker->startAbsAddr) &&
+                    (absAddr <= pMarker->endAbsAddr) )
                {
-                  if ( (absAddr >= pMarker->startAbsAddr) &&
-                       (absAddr <= pMarker->endAbsAddr) )
-                  {
-                     m_scintilla->markerAdd(line,Marker_Marker1+idx);
-                  }
+                  wanted |= (1<<(Marker_Marker1+idx));
                }
             }
 
-            if ( m_pBreakpoints )
+            if ( absAddr == (unsigned int)-1 )
             {
-               for ( idx = 0; idx < m_pBreakpoints->GetNumBreakpoints(); idx++ )
+               if ( breakpointEnabledLowest <= addr )
                {
-                  BreakpointInfo* pBreakpoint = m_pBreakpoints->GetBreakpoint(idx);
-
-                  if ( (pBreakpoint->enabled) &&
-                       (pBreakpoint->type == eBreakOnCPUExecution) &&
-                       (pBreakpoint->item1 <= addr) &&
-                       ((absAddr == (unsigned int)-1) || (absAddr == pBreakpoint->item1Absolute)) )
-                  {
-                     m_scintilla->markerAdd(line,Marker_Breakpoint);
-                  }
-                  else if ( (!pBreakpoint->enabled) &&
-                            (pBreakpoint->type == eBreakOnCPUExecution) &&
-                            (pBreakpoint->item1 <= addr) &&
-                            ((absAddr == (unsigned int)-1) || (absAddr == pBreakpoint->item1Absolute)) )
-                  {
-                     m_scintilla->markerAdd(line,Marker_BreakpointDisabled);
-                  }
+                  wanted |= (1<<Marker_Breakpoint);
+               }
+               if ( breakpointDisabledLowest <= addr )
+               {
+                  wanted |= (1<<Marker_BreakpointDisabled);
                }
             }
+            else
+            {
+               if ( breakpointsEnabled.contains(absAddr) &&
+                    (breakpointsEnabled.value(absAddr) <= addr) )
+               {
+                  wanted |= (1<<Marker_Breakpoint);
+               }
+               if ( breakpointsDisabled.contains(absAddr) &&
+                    (breakpointsDisabled.value(absAddr) <= addr) )
+               {
+                  wanted |= (1<<Marker_BreakpointDisabled);
+               }
+            }
+         }
+      }
+
+      if ( wanted )
+      {
+         linesWanted.insert(line,wanted);
+      }
+   }
+
+   // Find the lines that are marked now; the markers move with the text
+   // so the margin itself is the previous state.
+   line = m_scintilla->markerFindNext(0,markerMask);
+   while ( line >= 0 )
+   {
+      linesMarked.insert(line,m_scintilla->markersAtLine(line)&markerMask);
+      line = m_scintilla->markerFindNext(line+1,markerMask);
+   }
+
+   // Only touch the lines whose markers change.
+   for ( markIter = linesMarked.constBegin(); markIter != linesMarked.constEnd(); ++markIter )
+   {
+      wanted = linesWanted.value(markIter.key(),0);
+      for ( idx = 0; idx < Marker_MarkerMAX; idx++ )
+      {
+         if ( (markIter.value()&(~wanted))&(1<<idx) )
+         {
+            m_scintilla->markerDelete(markIter.key(),idx);
+         }
+      }
+   }
+   for ( markIter = linesWanted.constBegin(); markIter != linesWanted.constEnd(); ++markIter )
+   {
+      marked = linesMarked.value(markIter.key(),0);
+      for ( idx = 0; idx < Marker_MarkerMAX; idx++ )
+      {
+         if ( (markIter.value()&(~marked))&(1<<idx) )
+         {
+            m_scintilla->markerAdd(markIter.key(),idx);
          }
       }
    }
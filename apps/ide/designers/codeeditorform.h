@@ -120,6 +120,7 @@ private slots:
    void external_breakpointsChanged();
    void compiler_compileStarted();
    void compiler_compileDone(bool ok);
+   void compiler_compileError(QString file,int line);
    void emulator_emulatorStarted();
    void breakpointHit();
    void on_actionClear_marker_triggered();
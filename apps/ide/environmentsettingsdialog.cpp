@@ -6,6 +6,7 @@
 #include "Qsci/qsciscintilla.h"
 
 #include <QSettings>
+#include <QThread>
 
 // Settings data structures.
 //QModelIndex EnvironmentSettingsDialog::m_lastActiveTab;
@@ -15,6 +16,7 @@ bool EnvironmentSettingsDialog::m_showWelcomeOnStart;
 bool EnvironmentSettingsDialog::m_saveAllOnCompile;
 bool EnvironmentSettingsDialog::m_rememberWindowSettings;
 bool EnvironmentSettingsDialog::m_trackRecentProjects;
+bool EnvironmentSettingsDialog::m_binaryProjectFiles;
 QString EnvironmentSettingsDialog::m_romPath;
 bool EnvironmentSettingsDialog::m_runRomOnLoad;
 bool EnvironmentSettingsDialog::m_followExecution;
@@ -35,6 +37,7 @@ bool EnvironmentSettingsDialog::m_foldSource;
 QString EnvironmentSettingsDialog::m_cSourceExtensions;
 QString EnvironmentSettingsDialog::m_asmSourceExtensions;
 QString EnvironmentSettingsDialog::m_headerExtensions;
+int EnvironmentSettingsDialog::m_makeJobs;
 QString EnvironmentSettingsDialog::m_highlightAsC;
 QString EnvironmentSettingsDialog::m_highlightAsASM;
 int EnvironmentSettingsDialog::m_eolMode;
@@ -102,6 +105,7 @@ EnvironmentSettingsDialog::EnvironmentSettingsDialog(QWidget* parent) :
    ui->saveAllOnCompile->setChecked(m_saveAllOnCompile);
    ui->rememberWindowSettings->setChecked(m_rememberWindowSettings);
    ui->trackRecentProjects->setChecked(m_trackRecentProjects);
+   ui->binaryProjectFiles->setChecked(m_binaryProjectFiles);
 
    ui->useInternalDB->setChecked(m_useInternalGameDatabase);
    ui->GameDatabasePathEdit->setText(m_gameDatabase);
@@ -151,6 +155,7 @@ EnvironmentSettingsDialog::EnvironmentSettingsDialog(QWidget* parent) :
    ui->sourceExtensionsC->setText(m_cSourceExtensions);
    ui->sourceExtensionsAsm->setText(m_asmSourceExtensions);
    ui->headerExtensions->setText(m_headerExtensions);
+   ui->makeJobs->setValue(m_makeJobs);
    ui->highlightAsC->setText(m_highlightAsC);
    ui->highlightAsASM->setText(m_highlightAsASM);
 
@@ -199,6 +204,7 @@ void EnvironmentSettingsDialog::readSettings()
    m_saveAllOnCompile = settings.value("saveAllOnCompile",QVariant(true)).toBool();
    m_rememberWindowSettings = settings.value("rememberWindowSettings",QVariant(true)).toBool();
    m_trackRecentProjects = settings.value("trackRecentProjects",QVariant(true)).toBool();
+   m_binaryProjectFiles = settings.value("binaryProjectFiles",QVariant(false)).toBool();
    m_romPath = settings.value("romPath").toString();
    m_runRomOnLoad = settings.value("runRomOnLoad",QVariant(false)).toBool();
    m_followExecution = settings.value("followExecution",QVariant(true)).toBool();
@@ -240,6 +246,7 @@ void EnvironmentSettingsDialog::readSettings()
    m_cSourceExtensions = settings.value("SourceExtensionsC",QVariant(sourceExtensionListC)).toString();
    m_asmSourceExtensions = settings.value("SourceExtensionsAsm",QVariant(sourceExtensionListAsm)).toString();
    m_headerExtensions = settings.value("HeaderExtensions",QVariant(headerExtensionList)).toString();
+   m_makeJobs = settings.value("MakeJobs",QVariant(qMax(1,QThread::idealThreadCount()))).toInt();
    m_highlightAsC = settings.value("HighlightAsC",QVariant(highlightAsCList)).toString();
    m_highlightAsASM = settings.value("HighlightAsASM",QVariant(highlightAsASMList)).toString();
 
@@ -269,6 +276,7 @@ void EnvironmentSettingsDialog::writeSettings()
    m_saveAllOnCompile = ui->saveAllOnCompile->isChecked();
    m_rememberWindowSettings = ui->rememberWindowSettings->isChecked();
    m_trackRecentProjects = ui->trackRecentProjects->isChecked();
+   m_binaryProjectFiles = ui->binaryProjectFiles->isChecked();
    m_romPath = ui->ROMPath->text();
    m_runRomOnLoad = ui->runRom->isChecked();
    m_followExecution = ui->followExecution->isChecked();
@@ -297,6 +305,7 @@ void EnvironmentSettingsDialog::writeSettings()
    m_cSourceExtensions = ui->sourceExtensionsC->text();
    m_asmSourceExtensions = ui->sourceExtensionsAsm->text();
    m_headerExtensions = ui->headerExtensions->text();
+   m_makeJobs = ui->makeJobs->value();
    m_highlightAsC = ui->highlightAsC->text();
    m_highlightAsASM = ui->highlightAsASM->text();
    m_eolMode = ui->eolMode->currentIndex();
@@ -310,6 +319,7 @@ void EnvironmentSettingsDialog::writeSettings()
    settings.setValue("saveAllOnCompile",m_saveAllOnCompile);
    settings.setValue("rememberWindowSettings",m_rememberWindowSettings);
    settings.setValue("trackRecentProjects",m_trackRecentProjects);
+   settings.setValue("binaryProjectFiles",m_binaryProjectFiles);
 
    settings.setValue("useInternalGameDB",m_useInternalGameDatabase);
    settings.setValue("GameDatabase",m_gameDatabase);
@@ -339,6 +349,7 @@ void EnvironmentSettingsDialog::writeSettings()
    settings.setValue("SourceExtensionsC",m_cSourceExtensions);
    settings.setValue("SourceExtensionsAsm",m_asmSourceExtensions);
    settings.setValue("HeaderExtensions",m_headerExtensions);
+   settings.setValue("MakeJobs",m_makeJobs);
    settings.setValue("HighlightAsC",m_highlightAsC);
    settings.setValue("HighlightAsASM",m_highlightAsASM);
    settings.setValue("EOLMode",m_eolMode);
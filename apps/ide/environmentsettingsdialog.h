@@ -32,6 +32,7 @@ public:
    static bool saveAllOnCompile() { return m_saveAllOnCompile; }
    static bool rememberWindowSettings() { return m_rememberWindowSettings; }
    static bool trackRecentProjects() { return m_trackRecentProjects; }
+   static bool binaryProjectFiles() { return m_binaryProjectFiles; }
    static QString romPath() { return m_romPath; }
    static bool runRomOnLoad() { return m_runRomOnLoad; }
    static bool followExecution() { return m_followExecution; }
@@ -52,6 +53,7 @@ public:
    static QString sourceExtensionsForC() { return m_cSourceExtensions; }
    static QString sourceExtensionsForAssembly() { return m_asmSourceExtensions; }
    static QString headerExtensions() { return m_headerExtensions; }
+   static int makeJobs() { return m_makeJobs; }
    static QString highlightAsC() { return m_highlightAsC; }
    static QString highlightAsASM() { return m_highlightAsASM; }
    static int eolMode() { return m_eolMode; }
@@ -85,6 +87,7 @@ private:
    static bool m_saveAllOnCompile;
    static bool m_rememberWindowSettings;
    static bool m_trackRecentProjects;
+   static bool m_binaryProjectFiles;
    static QString m_romPath;
    static bool m_runRomOnLoad;
    static bool m_followExecution;
@@ -105,6 +108,7 @@ private:
    static QString m_cSourceExtensions;
    static QString m_asmSourceExtensions;
    static QString m_headerExtensions;
+   static int m_makeJobs;
    static QString m_highlightAsC;
    static QString m_highlightAsASM;
    static int m_eolMode;
@@ -10,12 +10,25 @@
 #include <QObject>
 #include <QTableView>
 #include <QUuid>
+#include <QHash>
+#include <QPair>
 
 #include "cprojecttabwidget.h"
 
+class IProjectTreeViewItemIndex;
+
 class IProjectTreeViewItem
 {
 public:
+   IProjectTreeViewItem()
+   {
+      parentItem = 0;
+      ident = 0;
+      treeIndex = 0;
+   }
+
+   virtual ~IProjectTreeViewItem();
+
    void InitTreeItem(QString iconResource,IProjectTreeViewItem* parent = 0)
    {
       parentItem = parent;
@@ -41,25 +54,22 @@ public:
       return ident->toString();
    }
 
-   void setUuid(QString uuid)
-   {
-      if ( ident ) delete ident;
-      ident = new QUuid(uuid);
-   }
+   void setUuid(QString uuid);
 
    void FreeTreeItem()
    {
       qDeleteAll(childItems);
    }
 
-   void appendChild(IProjectTreeViewItem* child)
-   {
-      childItems.append(child);
-   }
+   void appendChild(IProjectTreeViewItem* child);
+   void removeChild(IProjectTreeViewItem* child);
 
-   void removeChild(IProjectTreeViewItem* child)
+   // Makes this item the root of a tree that keeps an index of its items.
+   void setTreeIndex(IProjectTreeViewItemIndex* index);
+
+   IProjectTreeViewItemIndex* getTreeIndex()
    {
-      childItems.removeAll(child);
+      return treeIndex;
    }
 
    IProjectTreeViewItem* child(int row)
@@ -106,12 +116,142 @@ public:
    virtual bool exportData() = 0;
 
 private:
+   void attachTreeIndex(IProjectTreeViewItemIndex* index);
+   void detachTreeIndex();
+
    QList<IProjectTreeViewItem*> childItems;
    IProjectTreeViewItem* parentItem;
    QUuid* ident;
    QIcon _icon;
+   IProjectTreeViewItemIndex* treeIndex;
+};
+
+// Index of the items in a project tree by UUID and by class name, kept up
+// to date as items are added to or removed from the tree and as their UUIDs
+// change.  Items of a class are kept in the order they were added.
+class IProjectTreeViewItemIndex
+{
+public:
+   IProjectTreeViewItem* findItemByUuid(const QString& uuid) const
+   {
+      return m_items.value(uuid);
+   }
+
+   QList<IProjectTreeViewItem*> findItemsOfType(const char* className) const
+   {
+      return m_types.value(className);
+   }
+
+   void insert(IProjectTreeViewItem* item)
+   {
+      QObject* object = dynamic_cast<QObject*>(item);
+      QByteArray className;
+
+      if ( m_keys.contains(item) )
+      {
+         remove(item);
+      }
+      if ( object )
+      {
+         className = object->metaObject()->className();
+      }
+      m_keys.insert(item,qMakePair(item->uuid(),className));
+      m_items.insert(item->uuid(),item);
+      m_types[className].append(item);
+   }
+
+   void remove(IProjectTreeViewItem* item)
+   {
+      QPair<QString,QByteArray> key = m_keys.take(item);
+
+      // Another item may have taken over the UUID.
+      if ( m_items.value(key.first) == item )
+      {
+         m_items.remove(key.first);
+      }
+      m_types[key.second].removeOne(item);
+   }
+
+private:
+   QHash<QString,IProjectTreeViewItem*> m_items;
+   QHash<QByteArray,QList<IProjectTreeViewItem*> > m_types;
+   QHash<IProjectTreeViewItem*,QPair<QString,QByteArray> > m_keys;
 };
 
+inline IProjectTreeViewItem::~IProjectTreeViewItem()
+{
+   // Items deleted without being removed from the tree first.
+   if ( treeIndex )
+   {
+      treeIndex->remove(this);
+   }
+}
+
+inline void IProjectTreeViewItem::setUuid(QString uuid)
+{
+   if ( ident ) delete ident;
+   ident = new QUuid(uuid);
+
+   if ( treeIndex )
+   {
+      treeIndex->insert(this);
+   }
+}
+
+inline void IProjectTreeViewItem::appendChild(IProjectTreeViewItem* child)
+{
+   childItems.append(child);
+
+   if ( treeIndex )
+   {
+      child->attachTreeIndex(treeIndex);
+   }
+}
+
+inline void IProjectTreeViewItem::removeChild(IProjectTreeViewItem* child)
+{
+   if ( childItems.removeAll(child) && treeIndex )
+   {
+      child->detachTreeIndex();
+   }
+}
+
+inline void IProjectTreeViewItem::setTreeIndex(IProjectTreeViewItemIndex* index)
+{
+   if ( treeIndex )
+   {
+      detachTreeIndex();
+   }
+   if ( index )
+   {
+      attachTreeIndex(index);
+   }
+}
+
+inline void IProjectTreeViewItem::attachTreeIndex(IProjectTreeViewItemIndex* index)
+{
+   int i;
+
+   treeIndex = index;
+   treeIndex->insert(this);
+   for ( i = 0; i < childItems.count(); i++ )
+   {
+      childItems.at(i)->attachTreeIndex(index);
+   }
+}
+
+inline void IProjectTreeViewItem::detachTreeIndex()
+{
+   int i;
+
+   for ( i = 0; i < childItems.count(); i++ )
+   {
+      childItems.at(i)->detachTreeIndex();
+   }
+   treeIndex->remove(this);
+   treeIndex = 0;
+}
+
 // Iterator class for walking through a project, starting from either a specific trunk
 // node or from the project root node.
 // Example usages:
@@ -15,6 +15,7 @@
 #include "ccc65interface.h"
 
 #include "searcherthread.h"
+#include "projectsaverthread.h"
 #include "breakpointwatcherthread.h"
 
 #include "nes_emulator_core.h"
@@ -109,6 +110,12 @@ MainWindow::MainWindow(CProjectModel *projectModel, QWidget* parent) :
    QObject::connect(this,SIGNAL(clean()),compiler,SLOT(clean()));
    CObjectRegistry::addObject ( "Compiler", compiler );
 
+   // Create the project saver thread...
+   ProjectSaverThread* projectSaver = new ProjectSaverThread();
+   QObject::connect(this,SIGNAL(saveProjectArchive(QString,QDomDocument)),projectSaver,SLOT(save(QString,QDomDocument)));
+   QObject::connect(projectSaver,SIGNAL(saveDone(bool,QString)),this,SLOT(projectSaver_saveDone(bool,QString)));
+   CObjectRegistry::addObject ( "Project Saver", projectSaver );
+
    // Create the Test Suite executive modeless dialog...
    testSuiteExecutive = new TestSuiteExecutiveDialog(this);
    QObject::connect(this,SIGNAL(updateTargetMachine(QString)),testSuiteExecutive,SLOT(updateTargetMachine(QString)));
@@ -351,6 +358,7 @@ MainWindow::~MainWindow()
    BreakpointWatcherThread* breakpointWatcher = dynamic_cast<BreakpointWatcherThread*>(CObjectRegistry::getObject("Breakpoint Watcher"));
    CompilerThread* compiler = dynamic_cast<CompilerThread*>(CObjectRegistry::getObject("Compiler"));
    SearcherThread* searcher = dynamic_cast<SearcherThread*>(CObjectRegistry::getObject("Searcher"));
+   ProjectSaverThread* projectSaver = dynamic_cast<ProjectSaverThread*>(CObjectRegistry::getObject("Project Saver"));
 
    killTimer(m_periodicTimer);
 
@@ -362,6 +370,9 @@ MainWindow::~MainWindow()
    compiler = NULL;
    delete searcher;
    searcher = NULL;
+   nesicideProject->getProjectArchive()->waitForSaves();
+   delete projectSaver;
+   projectSaver = NULL;
 
    delete testSuiteExecutive;
 
@@ -1648,36 +1659,62 @@ void MainWindow::saveEmulatorState(QString fileName)
 
 void MainWindow::saveProject(QString fileName)
 {
-   QFile file(fileName);
+   CProjectArchive* pArchive = nesicideProject->getProjectArchive();
+   bool binary = EnvironmentSettingsDialog::binaryProjectFiles();
+   bool ok;
 
    // Save the project file name in the project...
    nesicideProject->setProjectFileName(fileName);
 
-   if ( !file.open( QFile::WriteOnly) )
-   {
-      QMessageBox::critical(this, "Error", "An error occured while trying to open the project file for writing.");
-      return;
-   }
+   // Let a save that is still being written finish first.
+   pArchive->waitForSaves();
 
    QDomDocument doc;
    QDomProcessingInstruction instr = doc.createProcessingInstruction("xml", "version='1.0' encoding='UTF-8'");
    doc.appendChild(instr);
 
-   if (!nesicideProject->serialize(doc, doc))
+   // Data not loaded yet from the project archive is only referenced
+   // when saving to the archive again.
+   pArchive->setSerializing(binary);
+   ok = nesicideProject->serialize(doc, doc);
+   pArchive->setSerializing(false);
+
+   if (!ok)
    {
       QMessageBox::critical(this, "Error", "An error occured while trying to serialize the project data.");
-      file.close();
+      return;
    }
 
-   // Create a text stream so we can stream the XML data to the file easily.
-   QTextStream ts( &file );
+   if ( binary )
+   {
+      // The archive is written in the background, only the chunks that
+      // changed are written to it.
+      pArchive->beginSave();
+      emit saveProjectArchive(fileName,doc);
+   }
+   else
+   {
+      QFile file(fileName);
 
-   // Use the standard C++ stream function for streaming the string representation of our XML to
-   // our file stream.
-   ts << doc.toString();
+      if ( !file.open( QFile::WriteOnly) )
+      {
+         QMessageBox::critical(this, "Error", "An error occured while trying to open the project file for writing.");
+         return;
+      }
 
-   // And finally close the file.
-   file.close();
+      // Create a text stream so we can stream the XML data to the file easily.
+      QTextStream ts( &file );
+
+      // Use the standard C++ stream function for streaming the string representation of our XML to
+      // our file stream.
+      ts << doc.toString();
+
+      // And finally close the file.
+      file.close();
+
+      // Everything was loaded to write the XML, the archive isn't needed anymore.
+      pArchive->close();
+   }
 
    // Now save the emulator state if a save state file is specified.
    if ( !nesicideProject->getProjectTarget().compare("nes",Qt::CaseInsensitive) )
@@ -2134,6 +2171,42 @@ void MainWindow::timerEvent(QTimerEvent */*event*/)
 //   on_actionCompile_Project_triggered();
 }
 
+bool MainWindow::readProjectFile(QString fileName,QDomDocument& doc)
+{
+   QString errors;
+
+   // Binary project files are read through the project archive, which keeps
+   // the file open to load the remaining data on demand.
+   if ( CProjectArchive::isArchive(fileName) )
+   {
+      if (!nesicideProject->getProjectArchive()->open(fileName,doc,errors))
+      {
+         QMessageBox::critical(this, "Error", "Failed to open the project file.\n\n"+errors);
+         return false;
+      }
+      return true;
+   }
+
+   QFile file( fileName );
+
+   if (!file.open(QFile::ReadOnly))
+   {
+      QMessageBox::critical(this, "Error", "Failed to open the project file.");
+      return false;
+   }
+
+   if (!doc.setContent(file.readAll()))
+   {
+      QMessageBox::critical(this, "Error", "Failed to parse the project xml data.");
+      file.close();
+      return false;
+   }
+
+   file.close();
+
+   return true;
+}
+
 void MainWindow::openNesProject(QString fileName,bool runRom)
 {
    QSettings settings(QSettings::IniFormat, QSettings::UserScope, "CSPSoftware", "NESICIDE");
@@ -2143,23 +2216,12 @@ void MainWindow::openNesProject(QString fileName,bool runRom)
    if (QFile::exists(fileName))
    {
       QDomDocument doc;
-      QFile file( fileName );
 
-      if (!file.open(QFile::ReadOnly))
+      if (!readProjectFile(fileName,doc))
       {
-         QMessageBox::critical(this, "Error", "Failed to open the project file.");
          return;
       }
 
-      if (!doc.setContent(file.readAll()))
-      {
-         QMessageBox::critical(this, "Error", "Failed to parse the project xml data.");
-         file.close();
-         return;
-      }
-
-      file.close();
-
       m_pProjectBrowser->disableNavigation();
 
       // Set project target before initializing project.
@@ -2234,23 +2296,12 @@ void MainWindow::openC64Project(QString fileName,bool run)
    if (QFile::exists(fileName))
    {
       QDomDocument doc;
-      QFile file( fileName );
 
-      if (!file.open(QFile::ReadOnly))
+      if (!readProjectFile(fileName,doc))
       {
-         QMessageBox::critical(this, "Error", "Failed to open the project file.");
          return;
       }
 
-      if (!doc.setContent(file.readAll()))
-      {
-         QMessageBox::critical(this, "Error", "Failed to parse the project xml data.");
-         file.close();
-         return;
-      }
-
-      file.close();
-
       m_pProjectBrowser->disableNavigation();
 
       // Set project target before initializing project.
@@ -2385,16 +2436,29 @@ void MainWindow::compiler_compileStarted()
 {
    actionCompile_Project->setEnabled(false);
    actionLoad_In_Emulator->setEnabled(false);
+   actionCancel_Build->setEnabled(true);
 }
 
 void MainWindow::compiler_compileDone(bool /*bOk*/)
 {
    actionCompile_Project->setEnabled(true);
    actionLoad_In_Emulator->setEnabled(true);
+   actionCancel_Build->setEnabled(false);
 
    projectDataChangesEvent();
 }
 
+void MainWindow::projectSaver_saveDone(bool ok,QString errors)
+{
+   if ( !ok )
+   {
+      QMessageBox::critical(this, "Error", "An error occured while trying to write the project file.\n\n"+errors);
+
+      // Nothing of the project was saved.
+      markProjectDirty(true);
+   }
+}
+
 void MainWindow::on_actionExecution_Inspector_triggered()
 {
    m_pExecutionInspector->setVisible(true);
@@ -3242,6 +3306,14 @@ void MainWindow::on_actionClean_Project_triggered()
    emit clean();
 }
 
+void MainWindow::on_actionCancel_Build_triggered()
+{
+   CompilerThread* compiler = dynamic_cast<CompilerThread*>(CObjectRegistry::getObject("Compiler"));
+
+   // The compiler thread is busy in the build, so this can't be queued to it.
+   compiler->cancel();
+}
+
 void MainWindow::openFile(QString file)
 {
    QDir dir(QDir::currentPath());
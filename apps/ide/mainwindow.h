@@ -198,6 +198,7 @@ private:
    void openNesProject(QString fileName,bool runRom=true);
    void openC64Project(QString fileName,bool run=true);
    void saveProject(QString fileName);
+   bool readProjectFile(QString fileName,QDomDocument& doc);
    void saveEmulatorState(QString fileName);
    bool closeProject();
    void explodeTemplate(QString templateDirName,QString localDirName,QString* projectFileName);
@@ -220,6 +221,7 @@ signals:
    void updateTargetMachine(QString target);
    void compile();
    void clean();
+   void saveProjectArchive(QString fileName,QDomDocument doc);
 
 private slots:
    void applicationActivationChanged(bool activated);
@@ -239,6 +241,7 @@ private slots:
    void windowMenu_triggered();
    void markProjectDirty(bool dirty);
    void on_actionClean_Project_triggered();
+   void on_actionCancel_Build_triggered();
    void tabWidget_tabAdded(int tab);
    void tabWidget_tabModified(int tab,bool modified);
    void on_actionE_xit_triggered();
@@ -247,6 +250,7 @@ private slots:
    void projectDataChangesEvent();
    void compiler_compileStarted();
    void compiler_compileDone(bool bOk);
+   void projectSaver_saveDone(bool ok,QString errors);
    void on_action_Close_Project_triggered();
    void on_action_About_Nesicide_triggered();
    void on_actionEnvironment_Settings_triggered();
@@ -14,21 +14,11 @@ template<class T>
 QList<QUuid> findUuidsOfType(CNesicideProject* project)
 {
    QList<QUuid> items;
-   const char* targetName = T::staticMetaObject.className();
+   QList<IProjectTreeViewItem*> found = project->getTreeIndex()->findItemsOfType(T::staticMetaObject.className());
 
-   IProjectTreeViewItemIterator iter(project);
-   while ( iter.current() != NULL )
+   foreach ( IProjectTreeViewItem* item, found )
    {
-      CProjectBase* item = dynamic_cast<CProjectBase*>(iter.current());
-      if ( item != NULL )
-      {
-         const char* className = item->metaObject()->className();
-         if ( strcmp(className,targetName) == 0 )
-         {
-            items.append( item->uuid() );
-         }
-      }
-      iter.next();
+      items.append( item->uuid() );
    }
    return items;
 }
@@ -37,21 +27,11 @@ template<class T>
 QList<T*> findItemsOfType(CNesicideProject* project)
 {
    QList<T*> items;
-   const char* targetName = T::staticMetaObject.className();
+   QList<IProjectTreeViewItem*> found = project->getTreeIndex()->findItemsOfType(T::staticMetaObject.className());
 
-   IProjectTreeViewItemIterator iter(project);
-   while ( iter.current() != NULL )
+   foreach ( IProjectTreeViewItem* item, found )
    {
-      CProjectBase* item = dynamic_cast<CProjectBase*>(iter.current());
-      if ( item != NULL )
-      {
-         const char* className = item->metaObject()->className();
-         if ( strcmp(className,targetName) == 0 )
-         {
-            items.append( static_cast<T*>(item) );
-         }
-      }
-      iter.next();
+      items.append( static_cast<T*>(dynamic_cast<CProjectBase*>(item)) );
    }
    return items;
 }
@@ -60,29 +40,17 @@ QList<T*> findItemsOfType(CNesicideProject* project)
 template<class T>
 T* findItemByUuid(CNesicideProject* project, const QUuid& uuid)
 {
-   const char* targetName = T::staticMetaObject.className();
+   IProjectTreeViewItem* found = project->getTreeIndex()->findItemByUuid(uuid.toString());
+   CProjectBase* item = dynamic_cast<CProjectBase*>(found);
 
-   IProjectTreeViewItemIterator iter(project);
-   while ( iter.current() != NULL )
-   {
-      if (iter.current()->uuid() == uuid)
-      {
-         CProjectBase* item = dynamic_cast<CProjectBase*>(iter.current());
-         if ( item == NULL )
-            return NULL;
+   if ( item == NULL )
+      return NULL;
 
-         // Check if object has the correct class.
-         const char* className = item->metaObject()->className();
-         if ( strcmp(className,targetName) == 0 )
-         {
-            return static_cast<T*>( item );
-         }
-         else
-         {
-            return NULL;
-         }
-      }
-      iter.next();
+   // Check if object has the correct class.
+   const char* className = item->metaObject()->className();
+   if ( strcmp(className,T::staticMetaObject.className()) == 0 )
+   {
+      return static_cast<T*>( item );
    }
    return NULL;
 }
@@ -2,18 +2,64 @@
 
 #include <QResource>
 #include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QDir>
+#include <QCoreApplication>
+#include <QVector>
 #include <QCryptographicHash>
+#include <QXmlStreamReader>
+
+#if QT_VERSION >= 0x050000
+#include <QStandardPaths>
+#else
+#include <QDesktopServices>
+#endif
+
+#include <string.h>
+#include <algorithm>
 
 #include "nes_emulator_core.h"
 
+static bool entrySha1LessThan(const GameDBIndexEntry& a,const GameDBIndexEntry& b)
+{
+   return memcmp(a.sha1,b.sha1,GAMEDB_SHA1_SIZE) < 0;
+}
+
+class CrcLessThan
+{
+public:
+   CrcLessThan(const GameDBIndexEntry* entries) : m_entries(entries) {}
+   bool operator()(uint32_t a,uint32_t b) const
+   {
+      return m_entries[a].crc32 < m_entries[b].crc32;
+   }
+private:
+   const GameDBIndexEntry* m_entries;
+};
+
 CGameDatabaseHandler::CGameDatabaseHandler()
+   : m_index(NULL),
+     m_header(NULL),
+     m_entries(NULL),
+     m_crcOrder(NULL),
+     m_found(NULL)
+{
+}
+
+CGameDatabaseHandler::~CGameDatabaseHandler()
 {
+   closeIndex();
 }
 
 bool CGameDatabaseHandler::initialize(QString fileName)
 {
    QFile file(fileName);
    QFile res(":/GameDatabase");
+   QFileInfo sourceInfo;
+   QByteArray source;
+   QByteArray sourceKey;
+   QString cacheDir;
    bool openedFile = false;
 
    // First attempt to open the user-specified game database...
@@ -21,101 +67,432 @@ bool CGameDatabaseHandler::initialize(QString fileName)
 
    if ( file.isOpen() )
    {
-      m_db.clear();
-      m_db.setContent(&file);
-      file.close();
+      sourceInfo.setFile(fileName);
       openedFile = true;
    }
    else
    {
       // Couldn't open the user-specified game database, resort
-      // to using the internal resource...
+      // to using the internal resource.  It only changes along
+      // with the program.
       res.open(QIODevice::ReadOnly);
+      sourceInfo.setFile(QCoreApplication::applicationFilePath());
+   }
+
+   closeIndex();
+
+   // The compiled index is keyed by where the database came from, its
+   // size and when it was last changed, so switching databases or
+   // editing one rebuilds it without reading it on every run.
+   sourceKey = QCryptographicHash::hash((sourceInfo.absoluteFilePath()+"|"+
+                                         QString::number(openedFile?file.size():res.size())+"|"+
+                                         QString::number(sourceInfo.lastModified().toMSecsSinceEpoch())).toUtf8(),
+                                        QCryptographicHash::Sha1);
 
-      m_db.clear();
-      m_db.setContent(&res);
-      res.close();
+#if QT_VERSION >= 0x050000
+   cacheDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+#else
+   cacheDir = QDesktopServices::storageLocation(QDesktopServices::CacheLocation);
+#endif
+   QString indexFileName = cacheDir+"/"+sourceKey.toHex()+".gamedb";
+
+   if ( !openIndex(indexFileName,sourceKey) )
+   {
+      source = openedFile?file.readAll():res.readAll();
+
+      if ( buildIndex(source,sourceKey) )
+      {
+         // Save the compiled index so the next run can map it directly.
+         QDir().mkpath(cacheDir);
+         QFile indexFile(indexFileName);
+         if ( indexFile.open(QIODevice::WriteOnly) &&
+              (indexFile.write(m_indexData) == m_indexData.size()) )
+         {
+            indexFile.close();
+            if ( !openIndex(indexFileName,sourceKey) )
+            {
+               buildIndex(source,sourceKey);
+            }
+         }
+         else
+         {
+            indexFile.close();
+            indexFile.remove();
+         }
+      }
    }
+
+   file.close();
+   res.close();
+
    return openedFile;
 }
 
+bool CGameDatabaseHandler::validIndex(const uchar* index,qint64 size,const QByteArray& sourceKey)
+{
+   const GameDBIndexHeader* header = (const GameDBIndexHeader*)index;
+
+   if ( (!index) || (size < (qint64)sizeof(GameDBIndexHeader)) )
+   {
+      return false;
+   }
+   if ( (header->magic != GAMEDB_INDEX_MAGIC) ||
+        (header->version != GAMEDB_INDEX_VERSION) ||
+        (header->size != size) ||
+        (memcmp(header->sourceKey,sourceKey.constData(),GAMEDB_SHA1_SIZE)) )
+   {
+      return false;
+   }
+   if ( (header->entriesOffset+(header->numEntries*sizeof(GameDBIndexEntry)) > header->size) ||
+        (header->numCrcEntries > header->numEntries) ||
+        (header->crcOrderOffset+(header->numCrcEntries*sizeof(uint32_t)) > header->size) ||
+        (header->stringsOffset > header->size) )
+   {
+      return false;
+   }
+   return true;
+}
+
+bool CGameDatabaseHandler::openIndex(QString indexFileName,const QByteArray& sourceKey)
+{
+   const uchar* index;
+
+   closeIndex();
+
+   m_indexFile.setFileName(indexFileName);
+   if ( !m_indexFile.open(QIODevice::ReadOnly) )
+   {
+      return false;
+   }
+
+   index = m_indexFile.map(0,m_indexFile.size());
+   if ( !validIndex(index,m_indexFile.size(),sourceKey) )
+   {
+      closeIndex();
+      return false;
+   }
+
+   m_index = index;
+   m_header = (const GameDBIndexHeader*)m_index;
+   m_entries = (const GameDBIndexEntry*)(m_index+m_header->entriesOffset);
+   m_crcOrder = (const uint32_t*)(m_index+m_header->crcOrderOffset);
+   return true;
+}
+
+void CGameDatabaseHandler::closeIndex()
+{
+   if ( m_indexFile.isOpen() )
+   {
+      if ( m_index )
+      {
+         m_indexFile.unmap((uchar*)m_index);
+      }
+      m_indexFile.close();
+   }
+   m_indexData.clear();
+   m_index = NULL;
+   m_header = NULL;
+   m_entries = NULL;
+   m_crcOrder = NULL;
+   m_found = NULL;
+}
+
+bool CGameDatabaseHandler::buildIndex(const QByteArray& source,const QByteArray& sourceKey)
+{
+   QXmlStreamReader          xml(source);
+   QVector<GameDBIndexEntry> entries;
+   QVector<uint32_t>         crcOrder;
+   QByteArray                strings;
+   QByteArray                gameStrings;
+   GameDBIndexHeader         header;
+   GameDBIndexEntry          entry;
+   QByteArray                hex;
+   bool                      crcOk;
+   uint32_t                  authorOffset = 0;
+   uint32_t                  timestampOffset = 0;
+   int                       i;
+
+   // Offset zero is the empty string so missing attributes have a home.
+   strings.append('\0');
+
+   while ( !xml.atEnd() )
+   {
+      xml.readNext();
+
+      if ( !xml.isStartElement() )
+      {
+         continue;
+      }
+
+      if ( xml.name() == "database" )
+      {
+         authorOffset = strings.size();
+         strings.append(xml.attributes().value("author").toString().toUtf8());
+         strings.append('\0');
+         timestampOffset = strings.size();
+         strings.append(xml.attributes().value("timestamp").toString().toUtf8());
+         strings.append('\0');
+      }
+      else if ( xml.name() == "game" )
+      {
+         // Name, publisher and date are shared by every cartridge of the game.
+         gameStrings.clear();
+         gameStrings.append(xml.attributes().value("name").toString().toUtf8());
+         gameStrings.append('\0');
+         gameStrings.append(xml.attributes().value("publisher").toString().toUtf8());
+         gameStrings.append('\0');
+         gameStrings.append(xml.attributes().value("date").toString().toUtf8());
+         gameStrings.append('\0');
+      }
+      else if ( xml.name() == "cartridge" )
+      {
+         hex = QByteArray::fromHex(xml.attributes().value("sha1").toString().toLatin1());
+         entry.crc32 = xml.attributes().value("crc").toString().toUInt(&crcOk,16);
+         entry.flags = crcOk?GAMEDB_ENTRY_HAS_CRC32:0;
+
+         // Cartridges with only a CRC32 are found by the CRC32 fallback.
+         if ( hex.size() == GAMEDB_SHA1_SIZE )
+         {
+            memcpy(entry.sha1,hex.constData(),GAMEDB_SHA1_SIZE);
+         }
+         else if ( crcOk )
+         {
+            memset(entry.sha1,0,GAMEDB_SHA1_SIZE);
+         }
+         else
+         {
+            continue;
+         }
+         entry.recordOffset = strings.size();
+         strings.append(gameStrings);
+         strings.append(xml.attributes().value("system").toString().toUtf8());
+         strings.append('\0');
+         entries.append(entry);
+      }
+   }
+
+   if ( xml.hasError() && entries.isEmpty() )
+   {
+      return false;
+   }
+
+   std::sort(entries.begin(),entries.end(),entrySha1LessThan);
+
+   // Secondary ordering by CRC32 for dumps whose SHA1 isn't recorded.
+   // Cartridges without a CRC32 are left out, their zero would match
+   // any dump whose CRC32 happens to be zero.
+   for ( i = 0; i < entries.count(); i++ )
+   {
+      if ( entries.at(i).flags&GAMEDB_ENTRY_HAS_CRC32 )
+      {
+         crcOrder.append(i);
+      }
+   }
+   std::stable_sort(crcOrder.begin(),crcOrder.end(),
+                    CrcLessThan(entries.constData()));
+
+   memset(&header,0,sizeof(header));
+   header.magic = GAMEDB_INDEX_MAGIC;
+   header.version = GAMEDB_INDEX_VERSION;
+   memcpy(header.sourceKey,sourceKey.constData(),GAMEDB_SHA1_SIZE);
+   header.numEntries = entries.count();
+   header.numCrcEntries = crcOrder.count();
+   header.entriesOffset = sizeof(GameDBIndexHeader);
+   header.crcOrderOffset = header.entriesOffset+(entries.count()*sizeof(GameDBIndexEntry));
+   header.stringsOffset = header.crcOrderOffset+(crcOrder.count()*sizeof(uint32_t));
+   header.authorOffset = authorOffset;
+   header.timestampOffset = timestampOffset;
+   header.size = header.stringsOffset+strings.size();
+
+   closeIndex();
+
+   m_indexData.reserve(header.size);
+   m_indexData.append((const char*)&header,sizeof(header));
+   m_indexData.append((const char*)entries.constData(),entries.count()*sizeof(GameDBIndexEntry));
+   m_indexData.append((const char*)crcOrder.constData(),crcOrder.count()*sizeof(uint32_t));
+   m_indexData.append(strings);
+
+   m_index = (const uchar*)m_indexData.constData();
+   m_header = (const GameDBIndexHeader*)m_index;
+   m_entries = (const GameDBIndexEntry*)(m_index+m_header->entriesOffset);
+   m_crcOrder = (const uint32_t*)(m_index+m_header->crcOrderOffset);
+   return true;
+}
+
+QString CGameDatabaseHandler::getString(uint32_t offset)
+{
+   if ( (!m_header) || (m_header->stringsOffset+offset >= m_header->size) )
+   {
+      return QString();
+   }
+   return QString::fromUtf8((const char*)(m_index+m_header->stringsOffset+offset));
+}
+
+QString CGameDatabaseHandler::getField(int field)
+{
+   const char* str;
+   int         i;
+
+   if ( !m_found )
+   {
+      return QString();
+   }
+
+   // Fields follow one another in the string table.
+   str = (const char*)(m_index+m_header->stringsOffset+m_found->recordOffset);
+   for ( i = 0; i < field; i++ )
+   {
+      str += strlen(str)+1;
+   }
+   return QString::fromUtf8(str);
+}
+
 QString CGameDatabaseHandler::getGameDBTimestamp()
 {
-   QDomElement        docElem = m_db.documentElement();
-   return docElem.attribute("timestamp");
+   if ( !m_header )
+   {
+      return QString();
+   }
+   return getString(m_header->timestampOffset);
 }
 
 QString CGameDatabaseHandler::getGameDBAuthor()
 {
-   QDomElement        docElem = m_db.documentElement();
-   return docElem.attribute("author");
+   if ( !m_header )
+   {
+      return QString();
+   }
+   return getString(m_header->authorOffset);
+}
+
+uint32_t CGameDatabaseHandler::crc32(uint32_t crc,const uint8_t* data,uint32_t length)
+{
+   static uint32_t table[256];
+   static bool     tableBuilt = false;
+   uint32_t        i;
+   int             bit;
+
+   if ( !tableBuilt )
+   {
+      for ( i = 0; i < 256; i++ )
+      {
+         uint32_t c = i;
+         for ( bit = 0; bit < 8; bit++ )
+         {
+            c = (c&1)?(0xEDB88320^(c>>1)):(c>>1);
+         }
+         table[i] = c;
+      }
+      tableBuilt = true;
+   }
+
+   crc = ~crc;
+   for ( i = 0; i < length; i++ )
+   {
+      crc = table[(crc^data[i])&0xFF]^(crc>>8);
+   }
+   return ~crc;
 }
 
 bool CGameDatabaseHandler::find(CCartridge* pCartridge)
 {
-   QDomElement        docElem = m_db.documentElement();
    QCryptographicHash sha1alg(QCryptographicHash::Sha1);
    QByteArray         sha1key;
+   uint32_t           crc = 0;
+   int                lo;
+   int                hi;
+   int                mid;
+   int                cmp;
    int                i;
 
    // Reset the crypto...
    sha1alg.reset();
 
-   // Clear the found elements...
-   m_game.clear();
-   m_cartridge.clear();
+   // Clear the found entry...
+   m_found = NULL;
 
-   // Pump ROM data into crypto to get SHA1...
+   // Pump ROM data into crypto to get SHA1 and CRC32...
    for ( i = 0; i < pCartridge->getPrgRomBanks()->getPrgRomBanks().count(); i++ )
    {
       sha1alg.addData((char*)pCartridge->getPrgRomBanks()->getPrgRomBanks().at(i)->getBankData(),MEM_8KB);
+      crc = crc32(crc,(uint8_t*)pCartridge->getPrgRomBanks()->getPrgRomBanks().at(i)->getBankData(),MEM_8KB);
    }
 
    for ( i = 0; i < pCartridge->getChrRomBanks()->getChrRomBanks().count(); i++ )
    {
       sha1alg.addData((char*)pCartridge->getChrRomBanks()->getChrRomBanks().at(i)->getBankData(),MEM_8KB);
+      crc = crc32(crc,(uint8_t*)pCartridge->getChrRomBanks()->getChrRomBanks().at(i)->getBankData(),MEM_8KB);
+   }
+
+   if ( !m_header )
+   {
+      return false;
    }
 
    // Get the resulting hash value from the crypto...
    sha1key = sha1alg.result();
 
-   // Search the loaded game database for the corresponding hash value...
-   QDomNode gameNode = docElem.firstChild();
-
-   while (!gameNode.isNull())
+   // Binary search the index for the corresponding hash value...
+   lo = 0;
+   hi = m_header->numEntries-1;
+   while ( lo <= hi )
    {
-      QDomElement gameElem = gameNode.toElement(); // try to convert the node to an element.
-
-      if (!gameElem.isNull())
+      mid = (lo+hi)/2;
+      cmp = memcmp(m_entries[mid].sha1,sha1key.constData(),GAMEDB_SHA1_SIZE);
+      if ( cmp == 0 )
       {
-         QDomNode cartridgeNode = gameElem.firstChild();
-
-         while (!cartridgeNode.isNull())
-         {
-            QDomElement cartridgeElem = cartridgeNode.toElement(); // try to convert the node to an element.
-
-            if ( sha1key.toHex().toUpper() == cartridgeElem.attribute("sha1").toUpper() )
-            {
-               // Save found game for later reference...
-               m_game = gameNode.cloneNode();
-               m_cartridge = cartridgeNode.cloneNode();
-               return true;
-            }
-
-            cartridgeNode = cartridgeNode.nextSibling();
-         }
+         // Save found game for later reference...
+         m_found = &m_entries[mid];
+         return true;
+      }
+      else if ( cmp < 0 )
+      {
+         lo = mid+1;
+      }
+      else
+      {
+         hi = mid-1;
       }
+   }
 
-      gameNode = gameNode.nextSibling();
+   // ...then fall back to the CRC32.
+   lo = 0;
+   hi = m_header->numCrcEntries-1;
+   while ( lo <= hi )
+   {
+      mid = (lo+hi)/2;
+      if ( m_entries[m_crcOrder[mid]].crc32 == crc )
+      {
+         m_found = &m_entries[m_crcOrder[mid]];
+         return true;
+      }
+      else if ( m_entries[m_crcOrder[mid]].crc32 < crc )
+      {
+         lo = mid+1;
+      }
+      else
+      {
+         hi = mid-1;
+      }
    }
 
    return false;
 }
 
+QString CGameDatabaseHandler::getSHA1()
+{
+   static const uint8_t noSha1[GAMEDB_SHA1_SIZE] = { 0 };
+
+   if ( (!m_found) || (!memcmp(m_found->sha1,noSha1,GAMEDB_SHA1_SIZE)) )
+   {
+      return QString();
+   }
+   return QByteArray((const char*)m_found->sha1,GAMEDB_SHA1_SIZE).toHex().toUpper();
+}
+
 int CGameDatabaseHandler::getRegion()
 {
-   QDomElement cartridgeElem = m_cartridge.toElement();
-   QString str = cartridgeElem.attribute("system");
+   QString str = getSystem();
 
    if ( str.contains("USA") )
    {
@@ -1,19 +1,69 @@
 #ifndef CGAMEDATABASEHANDLER_H
 #define CGAMEDATABASEHANDLER_H
 
-#include <QDomDocument>
-#include <QDomElement>
+#include <QByteArray>
+#include <QFile>
 #include <QString>
 
+#include <stdint.h>
+
 #include "ccartridge.h"
 
-#define GAME_DATA(attr)  QDomElement gameElem = m_game.toElement(); return gameElem.attribute(attr)
-#define CART_DATA(attr)  QDomElement cartridgeElem = m_cartridge.toElement(); return cartridgeElem.attribute(attr)
+// The NesCartDB XML is compiled once into a binary index that is cached
+// on disk and memory-mapped on subsequent runs.  The index is:
+//    GameDBIndexHeader
+//    GameDBIndexEntry[numEntries]  (sorted by SHA1)
+//    uint32_t[numCrcEntries]       (numbers of entries with a CRC32, sorted by CRC32)
+//    string table                  (NUL-terminated UTF-8 strings)
+// Each entry's record offset points at the string table where the
+// game name, publisher, date and cartridge system follow each other.
+// Cartridges with only a CRC32 recorded have an all-zero SHA1.
+// The index is keyed by the SHA1 of the database's path, size and
+// modification time so it is found without reading the database.
+#define GAMEDB_INDEX_MAGIC   0x42444747 // 'GGDB'
+#define GAMEDB_INDEX_VERSION 3
+#define GAMEDB_SHA1_SIZE     20
+
+typedef struct _GameDBIndexHeader
+{
+   uint32_t magic;
+   uint32_t version;
+   uint8_t  sourceKey[GAMEDB_SHA1_SIZE];
+   uint32_t numEntries;
+   uint32_t numCrcEntries;
+   uint32_t entriesOffset;
+   uint32_t crcOrderOffset;
+   uint32_t stringsOffset;
+   uint32_t authorOffset;
+   uint32_t timestampOffset;
+   uint32_t size;
+} GameDBIndexHeader;
+
+// Entry flags.
+#define GAMEDB_ENTRY_HAS_CRC32 0x00000001
+
+typedef struct _GameDBIndexEntry
+{
+   uint8_t  sha1[GAMEDB_SHA1_SIZE];
+   uint32_t crc32;
+   uint32_t flags;
+   uint32_t recordOffset;
+} GameDBIndexEntry;
+
+enum
+{
+   GAMEDB_FIELD_NAME = 0,
+   GAMEDB_FIELD_PUBLISHER,
+   GAMEDB_FIELD_DATE,
+   GAMEDB_FIELD_SYSTEM,
+   GAMEDB_NUM_FIELDS
+};
 
 class CGameDatabaseHandler
 {
 public:
    CGameDatabaseHandler();
+   virtual ~CGameDatabaseHandler();
    bool initialize(QString fileName);
 
    // Database information.
@@ -26,32 +76,45 @@ public:
    // Game values.
    QString getName()
    {
-      GAME_DATA("name");
+      return getField(GAMEDB_FIELD_NAME);
    }
    QString getPublisher()
    {
-      GAME_DATA("publisher");
+      return getField(GAMEDB_FIELD_PUBLISHER);
    }
    QString getDate()
    {
-      GAME_DATA("date");
+      return getField(GAMEDB_FIELD_DATE);
    }
    int getRegion();
 
    // Cartridge values.
    QString getSystem()
    {
-      CART_DATA("system");
-   }
-   QString getSHA1()
-   {
-      CART_DATA("sha1").toUpper();
+      return getField(GAMEDB_FIELD_SYSTEM);
    }
+   QString getSHA1();
 
 protected:
-   QDomDocument m_db;
-   QDomNode     m_game;
-   QDomNode     m_cartridge;
+   bool openIndex(QString indexFileName,const QByteArray& sourceKey);
+   bool buildIndex(const QByteArray& source,const QByteArray& sourceKey);
+   bool validIndex(const uchar* index,qint64 size,const QByteArray& sourceKey);
+   void closeIndex();
+   QString getField(int field);
+   QString getString(uint32_t offset);
+   static uint32_t crc32(uint32_t crc,const uint8_t* data,uint32_t length);
+
+   // Either a memory-mapped cached index or, if the cache could
+   // not be written, the freshly compiled one held in memory.
+   QFile                    m_indexFile;
+   QByteArray               m_indexData;
+   const uchar*             m_index;
+   const GameDBIndexHeader* m_header;
+   const GameDBIndexEntry*  m_entries;
+   const uint32_t*          m_crcOrder;
+
+   // The entry for the last successful find, or NULL.
+   const GameDBIndexEntry*  m_found;
 };
 
 #endif // CGAMEDATABASEHANDLER_H
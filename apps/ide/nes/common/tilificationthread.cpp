@@ -2,8 +2,86 @@
 
 #include "nes_emulator_core.h"
 
+#include <QHash>
+#include <QVector>
+#include <QRunnable>
+#include <QThreadPool>
+
+// Tiles handed to one hashing job at least.
+#define TILES_PER_JOB 256
+
+// Content of a tile, the two bit planes packed in two 64-bit words.
+typedef struct TileKey
+{
+   quint64 lo;
+   quint64 hi;
+
+   bool operator==(const TileKey& other) const { return (lo == other.lo) && (hi == other.hi); }
+} TileKey;
+
+inline uint qHash(const TileKey& key)
+{
+   quint64 h = key.lo^(key.hi*0x9E3779B97F4A7C15ULL);
+
+   return (uint)(h^(h>>32));
+}
+
+static TileKey tileKey(const unsigned char* tile)
+{
+   TileKey key;
+   int idx;
+
+   key.lo = 0;
+   key.hi = 0;
+   for ( idx = 0; idx < 8; idx++ )
+   {
+      key.lo |= ((quint64)tile[idx])<<(idx<<3);
+      key.hi |= ((quint64)tile[idx+8])<<(idx<<3);
+   }
+   return key;
+}
+
+// Hashes a range of tiles and finds the first tile of each key in the range.
+class TileHashJob : public QRunnable
+{
+public:
+   TileHashJob(const unsigned char* tiles,int first,int count,TileKey* keys,char* localFirst) :
+      m_tiles(tiles), m_first(first), m_count(count), m_keys(keys), m_localFirst(localFirst)
+   {
+      setAutoDelete(false);
+   }
+
+   void run()
+   {
+      QHash<TileKey,int> firsts;
+      int idx;
+
+      firsts.reserve(m_count);
+      for ( idx = m_first; idx < m_first+m_count; idx++ )
+      {
+         m_keys[idx] = tileKey(m_tiles+(idx<<4));
+         m_localFirst[idx] = !firsts.contains(m_keys[idx]);
+         if ( m_localFirst[idx] )
+         {
+            firsts.insert(m_keys[idx],idx);
+         }
+      }
+   }
+
+   int first() const { return m_first; }
+   int count() const { return m_count; }
+
+private:
+   const unsigned char* m_tiles;
+   int                  m_first;
+   int                  m_count;
+   TileKey*             m_keys;
+   char*                m_localFirst;
+};
+
 TilificationThread::TilificationThread(QObject *parent) :
-   QThread(parent)
+   QThread(parent),
+   m_dedupe(true)
 {
 }
 
@@ -24,108 +102,111 @@ void TilificationThread::tilify()
 }
 
 void TilificationThread::run()
+{
+   int idx;
+
+   if ( m_dedupe )
+   {
+      m_output = tilify(m_input);
+   }
+   else
+   {
+      for ( idx = 0; idx < m_input.count(); idx++ )
+      {
+         m_output += m_input.at(idx)->getChrRomBankItemData();
+      }
+   }
+
+   emit tilificationComplete(m_output);
+}
+
+QByteArray TilificationThread::tilify(QList<IChrRomBankItem*> items,QVector<int>* tileMap)
 {
    QByteArray tileDataIn;
    QByteArray tileDataLockMap;
+   QByteArray itemData;
+   QByteArray output;
+   QVector<TileKey> keys;
+   QByteArray localFirst;
+   QHash<TileKey,int> firsts;
+   QList<TileHashJob*> jobs;
+   QThreadPool pool;
+   TileHashJob* job;
+   const unsigned char* tiles;
+   int tileCount;
+   int tilesPerJob;
    int idx1;
    int idx2;
-   bool newTile;
-   unsigned int* pSrc;
-   unsigned int* pDst;
-   const char* tileSrc;
-   const char* tileDst;
-
-#if 1
-// disable tilification for now until I sort out how to incorporate it best.
-   for ( idx1 = 0; idx1 < m_input.count(); idx1++ )
-   {
-      m_output.append(m_input.at(idx1)->getChrRomBankItemData());
-   }
-#else
-   for ( idx1 = 0; idx1 < m_input.count(); idx1++ )
+
+   // Only tiles of tile stamps are candidates for removal, the content of
+   // other items is kept intact but their tiles are matched against.
+   for ( idx1 = 0; idx1 < items.count(); idx1++ )
    {
-      tileDataIn.append(m_input.at(idx1)->getChrRomBankItemData());
-      if ( m_input.at(idx1)->getItemType() == "Tile" )
+      itemData = items.at(idx1)->getChrRomBankItemData();
+
+      // CHR data is made of whole tiles.
+      if ( itemData.count()&0xF )
       {
-         for ( idx2 = 0; idx2 < m_input.at(idx1)->getChrRomBankItemData().count()>>4; idx2++ )
-         {
-            tileDataLockMap.append('0');
-         }
+         itemData.append(QByteArray(16-(itemData.count()&0xF),0));
       }
-      else
+      tileDataIn.append(itemData);
+      tileDataLockMap.append(QByteArray(itemData.count()>>4,(items.at(idx1)->getItemType() == "Tile")?'0':'1'));
+   }
+
+   tileCount = tileDataIn.count()>>4;
+   tiles = (const unsigned char*)tileDataIn.constData();
+   keys.resize(tileCount);
+   localFirst.resize(tileCount);
+
+   // Hash the tiles in parallel, each job also finds the first tile of
+   // each key within its own range.
+   tilesPerJob = qMax(TILES_PER_JOB,(tileCount+pool.maxThreadCount()-1)/qMax(1,pool.maxThreadCount()));
+   for ( idx1 = 0; idx1 < tileCount; idx1 += tilesPerJob )
+   {
+      job = new TileHashJob(tiles,idx1,qMin(tilesPerJob,tileCount-idx1),keys.data(),localFirst.data());
+      jobs.append(job);
+      pool.start(job);
+   }
+   pool.waitForDone();
+
+   // Merge the per-job results in tile order so the first tile of each key
+   // wins, only tiles that were first within their job can be.
+   firsts.reserve(tileCount);
+   foreach ( job, jobs )
+   {
+      for ( idx2 = job->first(); idx2 < job->first()+job->count(); idx2++ )
       {
-         for ( idx2 = 0; idx2 < m_input.at(idx1)->getChrRomBankItemData().count()>>4; idx2++ )
+         if ( localFirst.at(idx2) && !firsts.contains(keys.at(idx2)) )
          {
-            tileDataLockMap.append('1');
+            firsts.insert(keys.at(idx2),idx2);
          }
       }
+      delete job;
    }
 
-   for ( idx1 = 0; idx1 < tileDataIn.count(); idx1 += 16)
+   if ( tileMap )
    {
-      // Go through the tile data and 'compress' it by
-      // keeping only unique tiles.
-      // Pointer for tile data.
-      tileSrc = tileDataIn.constData();
+      tileMap->resize(tileCount);
+   }
 
-      // First tile always gets put in.
-      if ( (tileDataLockMap.at(idx1>>4) == '1') || idx1 == 0 )
-      {
-         m_output.append(tileSrc,16);
-      }
-      else
+   output.reserve(tileDataIn.count());
+   for ( idx1 = 0; idx1 < tileCount; idx1++ )
+   {
+      if ( (tileDataLockMap.at(idx1) == '1') ||
+           (localFirst.at(idx1) && (firsts.value(keys.at(idx1)) == idx1)) )
       {
-         // Go through tiles in the output list already.
-         newTile = true;
-         for ( idx2 = 0; idx2 < m_output.count(); idx2 += 16)
-         {
-            // Pointer for tile data.
-            tileDst = m_output.constData();
-            pSrc = (unsigned int*)(tileSrc+idx1);
-            pDst = (unsigned int*)(tileDst+idx2);
-
-            // If the tiles match, add this tile.
-            if ( (*pSrc == *pDst) &&
-                 (*(pSrc+2) == *(pDst+2)) &&
-                 (*(pSrc+1) == *(pDst+1)) &&
-                 (*(pSrc+3) == *(pDst+3)) )
-            {
-               // Tile already copied.
-               newTile = false;
-               break;
-            }
-         }
-
-         // Copy tile if needed.
-         if ( newTile )
+         if ( tileMap )
          {
-            m_output.append(tileSrc+idx1,16);
-
-            // Go through original tile data and remove the tile we just found.
-            for ( idx2 = idx1+16; idx2 < tileDataIn.count(); )
-            {
-               // Pointer for tile data.
-               tileDst = tileDataIn.constData();
-               pSrc = (unsigned int*)(tileSrc+idx1);
-               pDst = (unsigned int*)(tileDst+idx2);
-
-               // If the tiles match, remove this tile.
-               if ( (*pSrc == *pDst) &&
-                    (*(pSrc+2) == *(pDst+2)) &&
-                    (*(pSrc+1) == *(pDst+1)) &&
-                    (*(pSrc+3) == *(pDst+3)) )
-               {
-                  tileDataIn.remove(idx2,16);
-               }
-               else
-               {
-                  idx2 += 16;
-               }
-            }
+            (*tileMap)[idx1] = output.count()>>4;
          }
+         output.append(tileDataIn.constData()+(idx1<<4),16);
+      }
+      else if ( tileMap )
+      {
+         // The tile that was kept comes first so it is already placed.
+         (*tileMap)[idx1] = tileMap->at(firsts.value(keys.at(idx1)));
       }
    }
-#endif
 
-   emit tilificationComplete(m_output);
+   return output;
 }
@@ -2,6 +2,7 @@
 #define TILIFICATIONTHREAD_H
 
 #include <QThread>
+#include <QVector>
 
 #include "ichrrombankitem.h"
 
@@ -11,6 +12,14 @@ class TilificationThread : public QThread
 public:
    explicit TilificationThread(QObject *parent = 0);
 
+   // Concatenates the CHR data of the items with duplicate tile stamp tiles
+   // removed.  If tileMap is given it receives the output tile index of
+   // every input tile, removed tiles map to the tile that was kept.
+   static QByteArray tilify(QList<IChrRomBankItem*> items,QVector<int>* tileMap = 0);
+
+   // Without dedupe the thread just concatenates the CHR data.
+   void setDedupe(bool dedupe) { m_dedupe = dedupe; }
+
 protected:
    void run();
 
@@ -25,6 +34,7 @@ public slots:
 private:
    QList<IChrRomBankItem*> m_input;
    QByteArray m_output;
+   bool m_dedupe;
 };
 
 #endif // TILIFICATIONTHREAD_H
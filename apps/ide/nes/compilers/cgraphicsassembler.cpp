@@ -47,19 +47,50 @@ bool CGraphicsAssembler::assemble()
          for (int gfxBankIdx = 0; gfxBankIdx < gfxBanks->getGraphicsBanks().count(); gfxBankIdx++)
          {
             CGraphicsBank* curGfxBank = gfxBanks->getGraphicsBanks().at(gfxBankIdx);
+            QVector<int> tileMap;
+            QByteArray chrData;
+            int tile = 0;
 
             buildTextLogger->write("Constructing '" + curGfxBank->caption() + "':");
 
             if ( curGfxBank->getGraphics().count() )
             {
+               chrData = curGfxBank->getChrData(&tileMap);
+
                for (int bankItemIdx = 0; bankItemIdx < curGfxBank->getGraphics().count(); bankItemIdx++)
                {
                   IChrRomBankItem* bankItem = curGfxBank->getGraphics().at(bankItemIdx);
                   IProjectTreeViewItem* ptvi = dynamic_cast<IProjectTreeViewItem*>(bankItem);
+                  int tiles = (bankItem->getChrRomBankItemSize()+15)>>4;
+                  QString tileList;
+                  bool moved = false;
+
                   buildTextLogger->write("&nbsp;&nbsp;&nbsp;Adding: "+ptvi->caption()+"("+QString::number(bankItem->getChrRomBankItemSize())+" bytes)");
 
-                  chrRomFile.write(bankItem->getChrRomBankItemData().data(), bankItem->getChrRomBankItemSize());
+                  // In banks with duplicate tiles removed, stamps sharing tiles with
+                  // earlier items don't have their tiles in order, list where each
+                  // of them went.
+                  for (int tileIdx = tile; tileIdx < tileMap.count() && tileIdx < tile+tiles; tileIdx++)
+                  {
+                     if ( tileMap.at(tileIdx) != tileMap.at(tile)+(tileIdx-tile) )
+                     {
+                        moved = true;
+                     }
+                     tileList += QString(" $%1").arg(tileMap.at(tileIdx),2,16,QChar('0')).toUpper();
+                  }
+                  if ( moved )
+                  {
+                     buildTextLogger->write("&nbsp;&nbsp;&nbsp;&nbsp;&nbsp;&nbsp;Tiles:"+tileList);
+                  }
+                  tile += tiles;
+               }
+
+               if ( chrData.count() > MEM_8KB )
+               {
+                  buildTextLogger->write("<font color='red'>Warning: '"+curGfxBank->caption()+"' is "+QString::number(chrData.count())+" bytes, more than the "+QString::number(MEM_8KB)+" bytes of a CHR bank.</font>");
                }
+
+               chrRomFile.write(chrData);
             }
             else
             {
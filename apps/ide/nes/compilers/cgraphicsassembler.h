@@ -4,6 +4,11 @@
 #include "cchrrombank.h"
 #include "cbuildertextlogger.h"
 
+// Builds the CHR-ROM file from the project's graphics banks.  The banks
+// are written one after the other as they are, so a project may split its
+// CHR into banks of any size its mapper switches.  A bank with no items is
+// written as 8KB of zeros.  A bank larger than 8KB can't be switched in as
+// a whole on any mapper, the build warns about it but still writes it.
 class CGraphicsAssembler
 {
 public:
@@ -8,7 +8,7 @@
 #include "nes_emulator_core.h"
 #include "cnessystempalette.h"
 
-GraphicsBankEditorForm::GraphicsBankEditorForm(QList<IChrRomBankItem*> bankItems,IProjectTreeViewItem* link,QWidget* parent) :
+GraphicsBankEditorForm::GraphicsBankEditorForm(QList<IChrRomBankItem*> bankItems,bool dedupeTiles,IProjectTreeViewItem* link,QWidget* parent) :
    CDesignerEditorBase(link,parent),
    ui(new Ui::GraphicsBankEditorForm)
 {
@@ -51,6 +51,12 @@ GraphicsBankEditorForm::GraphicsBankEditorForm(QList<IChrRomBankItem*> bankItems
 
    ui->gauge->setMaximum(MEM_8KB);
 
+   // Set before the first tilification so it matches the bank.
+   ui->dedupeTiles->blockSignals(true);
+   ui->dedupeTiles->setChecked(dedupeTiles);
+   ui->dedupeTiles->blockSignals(false);
+   pThread->setDedupe(dedupeTiles);
+
    updateChrRomBankItemList(bankItems);
 
    // Get mouse events from the renderer here!
@@ -80,6 +86,30 @@ QList<IChrRomBankItem*> GraphicsBankEditorForm::bankItems()
    return model->bankItems();
 }
 
+bool GraphicsBankEditorForm::dedupeTiles()
+{
+   return ui->dedupeTiles->isChecked();
+}
+
+void GraphicsBankEditorForm::on_dedupeTiles_toggled(bool checked)
+{
+   int idx;
+
+   pThread->setDedupe(checked);
+
+   emit prepareToTilify();
+
+   for (idx = 0; idx < model->bankItems().count(); idx++ )
+   {
+      emit addToTilificator(model->bankItems().at(idx));
+   }
+
+   emit tilify();
+
+   setModified(true);
+   emit markProjectDirty(true);
+}
+
 bool GraphicsBankEditorForm::eventFilter(QObject* obj,QEvent* event)
 {
    if ( obj == renderer )
@@ -227,7 +257,10 @@ void GraphicsBankEditorForm::renderData(QByteArray output)
 {
    int idx;
 
+   // Let the gauge run past 8KB so an overflowing bank shows as one.
+   ui->gauge->setMaximum(qMax(MEM_8KB,output.count()));
    ui->gauge->setValue(output.count());
+   ui->gauge->setFormat((output.count() > MEM_8KB)?QString("%v bytes, %1 over 8KB").arg(output.count()-MEM_8KB):QString("%p%"));
 
    // Pad to 8KB.
    for ( idx = output.count(); idx < MEM_8KB; idx++ )
@@ -22,12 +22,13 @@ class GraphicsBankEditorForm : public CDesignerEditorBase
 {
    Q_OBJECT
 public:
-   GraphicsBankEditorForm(QList<IChrRomBankItem*> bankItems,IProjectTreeViewItem* link = 0,QWidget* parent = 0);
+   GraphicsBankEditorForm(QList<IChrRomBankItem*> bankItems,bool dedupeTiles,IProjectTreeViewItem* link = 0,QWidget* parent = 0);
    virtual ~GraphicsBankEditorForm();
    void updateChrRomBankItemList(QList<IChrRomBankItem*> bankItems);
 
    // Member getters.
    QList<IChrRomBankItem*> bankItems();
+   bool dedupeTiles();
 
 protected:
    void changeEvent(QEvent* event);
@@ -58,6 +59,7 @@ private slots:
    void applyChangesToTab(QString uuid);
    void applyProjectPropertiesToTab();
    void updateTargetMachine(QString /*target*/) {}
+   void on_dedupeTiles_toggled(bool checked);
 
 signals:
    void prepareToTilify();
@@ -15,6 +15,7 @@
 //    along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <QSettings>
+#include <QCryptographicHash>
 
 #include <cdockwidgetregistry.h>
 
@@ -65,6 +66,13 @@ static void audioHook ( void )
    nesAudioSemaphore.acquire();
 }
 
+// Used while replaying a movie to a seek point.  The replayed frames
+// aren't heard so there's no need to wait for the audio device.
+static void seekAudioHook ( void )
+{
+   nesClearAudioSamplesAvailable();
+}
+
 extern "C" void SDL_Emulator(void* /*userdata*/, uint8_t* stream, int32_t len)
 {
 #if 0
@@ -102,6 +110,10 @@ NESEmulatorThread::NESEmulatorThread(QObject*)
    m_isResetting = false;
    m_debugFrame = 0;
    m_pCartridge = NULL;
+   m_movieRequest = MovieNone;
+   m_movieState = MovieNone;
+   m_movieFrame = 0;
+   m_movieSeekFrame = -1;
 
    // Enable callbacks from the external emulator library.
    nesSetBreakpointHook(breakpointHook);
@@ -220,6 +232,68 @@ void NESEmulatorThread::resetEmulator()
    start();
 }
 
+void NESEmulatorThread::recordMovie(QString fileName)
+{
+   // Recording always starts from a hard reset so the movie
+   // can be played back from one.
+   m_movieFileName = fileName;
+   m_movieRequest = MovieRecord;
+   resetEmulator();
+}
+
+void NESEmulatorThread::playMovie(QString fileName)
+{
+   nesEnableBreakpoints(false);
+
+   m_movieFileName = fileName;
+   m_movieRequest = MoviePlay;
+   m_isStarting = false;
+   m_isRunning = false;
+   m_isPaused = true;
+   m_showOnPause = false;
+
+   // If during the last run we were stopped at a breakpoint, clear it...
+   if ( !(nesBreakpointSemaphore.available()) )
+   {
+      nesBreakpointSemaphore.release();
+   }
+   start();
+}
+
+void NESEmulatorThread::stopMovie()
+{
+   m_movieRequest = MovieStop;
+   m_isStarting = false;
+   m_isRunning = false;
+   m_isPaused = true;
+   m_showOnPause = false;
+
+   // If during the last run we were stopped at a breakpoint, clear it...
+   if ( !(nesBreakpointSemaphore.available()) )
+   {
+      nesBreakpointSemaphore.release();
+   }
+   start();
+}
+
+void NESEmulatorThread::seekMovie(int32_t frame)
+{
+   nesEnableBreakpoints(false);
+
+   m_movieSeekFrame = frame;
+   m_isStarting = false;
+   m_isRunning = false;
+   m_isPaused = true;
+   m_showOnPause = false;
+
+   // If during the last run we were stopped at a breakpoint, clear it...
+   if ( !(nesBreakpointSemaphore.available()) )
+   {
+      nesBreakpointSemaphore.release();
+   }
+   start();
+}
+
 void NESEmulatorThread::startEmulation ()
 {
    m_isStarting = true;
@@ -435,6 +509,10 @@ void NESEmulatorThread::loadCartridge()
          nesLoadCHRROMBank ( b, (uint8_t*)m_pCartridge->getChrRomBanks()->getChrRomBanks().at(b)->getBankData() );
       }
 
+      // Pass on the NES 2.0 header information...
+      nesSetSubmapper ( m_pCartridge->getSubmapperNumber() );
+      nesSetPRGRAMSize ( m_pCartridge->getPrgRamSize() );
+
       // Perform any necessary fixup from the ROM loading...
       nesLoadROM();
 
@@ -453,7 +531,10 @@ void NESEmulatorThread::loadCartridge()
       }
 
       // Initialize NES...
-      nesResetInitial(m_pCartridge->getMapperNumber());
+      if ( !nesResetInitial(m_pCartridge->getMapperNumber()) )
+      {
+         generalTextLogger->write("<font color='red'>Mapper "+QString::number(m_pCartridge->getMapperNumber())+" is not supported.</font>");
+      }
 
       if ( !nesicideProject->getProjectCartridgeSaveStateName().isEmpty() )
       {
@@ -464,7 +545,8 @@ void NESEmulatorThread::loadCartridge()
          }
       }
 
-      // Trigger inspector updates...
+      // Trigger inspector updates...  Banks that aren't mapped in are
+      // disassembled in the background at the pause that follows.
       nesDisassemble();
       emit updateDebuggers();
 
@@ -473,8 +555,100 @@ void NESEmulatorThread::loadCartridge()
    }
 }
 
+QByteArray NESEmulatorThread::cartridgeHash()
+{
+   QCryptographicHash sha1(QCryptographicHash::Sha1);
+   CCartridge* pCartridge;
+   int32_t b;
+
+   if ( (!nesicideProject) || (!nesicideProject->getCartridge()) )
+   {
+      return QByteArray();
+   }
+   pCartridge = nesicideProject->getCartridge();
+
+   // Same hash as nesbench uses: PRG-ROM followed by CHR-ROM.
+   for ( b = 0; b < pCartridge->getPrgRomBanks()->getPrgRomBanks().count(); b++ )
+   {
+      sha1.addData((const char*)pCartridge->getPrgRomBanks()->getPrgRomBanks().at(b)->getBankData(),MEM_8KB);
+   }
+   for ( b = 0; b < pCartridge->getChrRomBanks()->getChrRomBanks().count(); b++ )
+   {
+      sha1.addData((const char*)pCartridge->getChrRomBanks()->getChrRomBanks().at(b)->getBankData(),MEM_8KB);
+   }
+   return sha1.result();
+}
+
+void NESEmulatorThread::processMovieRequest()
+{
+   QString errors;
+
+   // Any request ends a recording in progress.  The recording's own file
+   // name is kept since a new request may already have replaced the
+   // requested one.
+   if ( (m_movieRequest != MovieNone) && (m_movieState == MovieRecord) )
+   {
+      if ( !m_movie.save(m_movieRecordingFileName) )
+      {
+         generalTextLogger->write("<font color='red'>Cannot save movie "+m_movieRecordingFileName+".</font>");
+      }
+      m_movieState = MovieNone;
+   }
+
+   switch ( m_movieRequest )
+   {
+      case MovieRecord:
+         // The NES was hard reset just before this.
+         m_movie.startRecording(cartridgeHash());
+         m_movieRecordingFileName = m_movieFileName;
+         m_movieState = MovieRecord;
+         m_movieFrame = 0;
+         break;
+      case MoviePlay:
+         if ( m_movie.load(m_movieFileName,errors) )
+         {
+            if ( m_movie.romHash() != cartridgeHash() )
+            {
+               generalTextLogger->write("<font color='red'>Movie "+m_movieFileName+" was not recorded with this ROM, replaying from reset.</font>");
+               m_movie.discardKeyframes();
+            }
+            m_movieState = MoviePlay;
+            m_movieSeekFrame = 0;
+         }
+         else
+         {
+            generalTextLogger->write("<font color='red'>"+errors+"</font>");
+            m_movieState = MovieNone;
+         }
+         break;
+      case MovieStop:
+         m_movieState = MovieNone;
+         break;
+   }
+   m_movieRequest = MovieNone;
+
+   // Seeking only makes sense while playing a movie.
+   if ( (m_movieState == MoviePlay) && (m_movieSeekFrame >= 0) )
+   {
+      nesSetAudioHook(seekAudioHook);
+      nesEnableBreakpoints(false);
+      if ( m_movie.seek(m_movieSeekFrame) )
+      {
+         m_movieFrame = m_movieSeekFrame;
+      }
+      nesSetAudioHook(audioHook);
+      nesClearAudioSamplesAvailable();
+
+      // Trigger inspector updates...
+      nesDisassemble();
+      emit updateDebuggers();
+   }
+   m_movieSeekFrame = -1;
+}
+
 void NESEmulatorThread::run ()
 {
+   uint32_t movieJoy [ NUM_CONTROLLERS ];
    QWidget* emulatorWidget = CDockWidgetRegistry::getWidget("Emulator");
    int scaleX;
    int scaleY;
@@ -499,6 +673,10 @@ void NESEmulatorThread::run ()
 
    while ( m_isStarting || m_isRunning || m_isResetting || m_isPaused )
    {
+      // The banks that aren't mapped in may still be being disassembled
+      // from the last pause.
+      m_disassembler.wait();
+
       // Allow thread exit...
       if ( m_isTerminating )
       {
@@ -552,6 +730,12 @@ void NESEmulatorThread::run ()
          m_isResetting = false;
       }
 
+      // Start, stop, or seek a movie...
+      if ( (m_movieRequest != MovieNone) || (m_movieSeekFrame >= 0) )
+      {
+         processMovieRequest();
+      }
+
       // Pause?
       if ( m_isPaused || (m_pauseAfterFrames == 0) )
       {
@@ -571,6 +755,10 @@ void NESEmulatorThread::run ()
             emit emulatorPausedAfter();
          }
 
+         // Banks that aren't mapped in are disassembled while this thread
+         // sleeps so bank switches find their disassembly cached.
+         m_disassembler.start(QThread::LowPriority);
+
          nesBreak();
       }
 
@@ -623,7 +811,31 @@ void NESEmulatorThread::run ()
                                               emuY+(240*scale));
             }
          }
-         nesRun(m_joy);
+         if ( m_movieState == MovieRecord )
+         {
+            m_movie.recordFrame(m_joy);
+            m_movieFrame++;
+            nesRun(m_joy);
+         }
+         else if ( m_movieState == MoviePlay )
+         {
+            // Play back the movie's input, then hand control back to
+            // the live controllers when it runs out.
+            if ( m_movie.getFrameInput(m_movieFrame,movieJoy) )
+            {
+               m_movieFrame++;
+               nesRun(movieJoy);
+            }
+            else
+            {
+               m_movieState = MovieNone;
+               nesRun(m_joy);
+            }
+         }
+         else
+         {
+            nesRun(m_joy);
+         }
 
          if ( m_pauseAfterFrames != -1 )
          {
@@ -647,6 +859,8 @@ void NESEmulatorThread::run ()
       }
    }
 
+   m_disassembler.wait();
+
    return;
 }
 
@@ -10,6 +10,20 @@
 
 #include "ccartridge.h"
 
+#include "cnesmovie.h"
+
+// Disassembles the banks that aren't mapped in.  It only runs while the
+// emulator thread is stopped at a pause, the emulator thread waits for it
+// before it touches the NES again.
+class NESDisassemblerThread : public QThread
+{
+protected:
+   virtual void run ()
+   {
+      nesDisassembleAllBanks();
+   }
+};
+
 class NESEmulatorThread : public QThread, public IXMLSerializable
 {
    Q_OBJECT
@@ -39,6 +53,10 @@ public slots:
    void stepPPUEmulation ();
    void advanceFrame ();
    void adjustAudio ( int32_t bufferDepth );
+   void recordMovie ( QString fileName );
+   void playMovie ( QString fileName );
+   void stopMovie ();
+   void seekMovie ( int32_t frame );
    void controllerInput ( uint32_t* joy )
    {
       m_joy[CONTROLLER1] = joy[CONTROLLER1];
@@ -60,6 +78,8 @@ signals:
 protected:
    virtual void run ();
    void loadCartridge ();
+   void processMovieRequest ();
+   QByteArray cartridgeHash ();
 
    CCartridge*   m_pCartridge;
 
@@ -73,6 +93,25 @@ protected:
    bool          m_isStarting;
    int           m_debugFrame;
    uint32_t      m_joy [ NUM_CONTROLLERS ];
+
+   // Movie recording and playback.  Requests are made by the slots and
+   // carried out by the emulator thread between frames.
+   enum
+   {
+      MovieNone = 0,
+      MovieRecord,
+      MoviePlay,
+      MovieStop
+   };
+   NESDisassemblerThread m_disassembler;
+
+   CNESMovie     m_movie;
+   QString       m_movieFileName;
+   QString       m_movieRecordingFileName;
+   int           m_movieRequest;
+   int           m_movieState;
+   uint32_t      m_movieFrame;
+   int32_t       m_movieSeekFrame;
 };
 
 #endif // NESEMULATORTHREAD_H
@@ -40,6 +40,9 @@ void TestSuiteExecutiveDialog::updateTargetMachine(QString /*target*/)
       QObject::connect(emulator,SIGNAL(emulatedFrame()),this,SLOT(updateProgress()));
       QObject::connect(this,SIGNAL(startEmulation()),emulator,SLOT(startEmulation()));
       QObject::connect(this,SIGNAL(pauseEmulationAfter(int32_t)),emulator,SLOT(pauseEmulationAfter(int32_t)));
+      QObject::connect(this,SIGNAL(recordMovie(QString)),emulator,SLOT(recordMovie(QString)));
+      QObject::connect(this,SIGNAL(playMovie(QString)),emulator,SLOT(playMovie(QString)));
+      QObject::connect(this,SIGNAL(stopMovie()),emulator,SLOT(stopMovie()));
       QObject::connect(emulator,SIGNAL(emulatorPausedAfter()),this,SLOT(emulatorPausedAfter()));
    }
 }
@@ -188,6 +191,7 @@ void TestSuiteExecutiveDialog::doTestPhase()
    QString testFailComment;
    QString previousSha1;
    QString testRecordedInput;
+   QString testMovieFileName;
    QByteArray inputSamplesRaw;
    JoypadLoggerInfo* inputSample;
    int     numInputSamples;
@@ -205,6 +209,11 @@ void TestSuiteExecutiveDialog::doTestPhase()
    previousSha1 = ui->tableWidget->item(testRunning,6)->text();
    testRecordedInput = ui->tableWidget->item(testRunning,7)->text();
 
+   // Recorded input is now kept in a movie file next to the test ROM.
+   // Suites recorded before movies existed keep the base64 input log
+   // in the Recorded Input column instead of a movie file name.
+   testMovieFileName = testFileName+".nesmovie";
+
    switch ( testPhase )
    {
    case 0:
@@ -221,7 +230,8 @@ void TestSuiteExecutiveDialog::doTestPhase()
 
       nesResetInputRecording();
 
-      if ( !ui->recordInputs->isChecked() )
+      if ( (!ui->recordInputs->isChecked()) &&
+           (!testRecordedInput.endsWith(".nesmovie")) )
       {
          inputSamplesRaw.clear();
          inputSamplesRaw = QByteArray::fromBase64(testRecordedInput.toLocal8Bit());
@@ -240,7 +250,7 @@ void TestSuiteExecutiveDialog::doTestPhase()
       }
       else
       {
-         nesSetInputRecording(true);
+         nesSetInputRecording(false);
          nesSetInputPlayback(false);
       }
 
@@ -255,6 +265,15 @@ void TestSuiteExecutiveDialog::doTestPhase()
 
       emit openNesROM(testSuiteFolder.fromNativeSeparators(testSuiteFolder.absoluteFilePath(testFileName)),false);
 
+      if ( ui->recordInputs->isChecked() )
+      {
+         emit recordMovie(testSuiteFolder.fromNativeSeparators(testSuiteFolder.absoluteFilePath(testMovieFileName)));
+      }
+      else if ( testRecordedInput.endsWith(".nesmovie") )
+      {
+         emit playMovie(testSuiteFolder.fromNativeSeparators(testSuiteFolder.absoluteFilePath(testRecordedInput)));
+      }
+
       emit pauseEmulationAfter(framesRun);
 
       emit startEmulation();
@@ -322,13 +341,7 @@ void TestSuiteExecutiveDialog::doTestPhase()
 
          if ( ui->recordInputs->isChecked() )
          {
-            inputSamplesRaw.clear();
-            for ( sample = 0; sample < nesGetInputSamplesAvailable(0); sample++ )
-            {
-               inputSample = nesGetInputSample(0,sample);
-               inputSamplesRaw.append((char*)inputSample,sizeof(JoypadLoggerInfo));
-            }
-            ui->tableWidget->item(testRunning,7)->setText(inputSamplesRaw.toBase64());
+            ui->tableWidget->item(testRunning,7)->setText(testMovieFileName);
          }
 
          ui->tableWidget->item(testRunning,3)->setText(testResult);
@@ -352,6 +365,9 @@ void TestSuiteExecutiveDialog::doTestPhase()
 
       emit pauseEmulationAfter(-1);
 
+      // Finish the movie so the next test starts a fresh one.
+      emit stopMovie();
+
       if ( testRunning < testEnd )
       {
          doTestPhase();
@@ -33,6 +33,9 @@ signals:
     void openNesROM(QString romFile,bool runRom);
     void startEmulation();
     void pauseEmulationAfter(int32_t frames);
+    void recordMovie(QString fileName);
+    void playMovie(QString fileName);
+    void stopMovie();
 
 private slots:
     void on_save_clicked();
@@ -9,6 +9,9 @@ CCartridge::CCartridge(IProjectTreeViewItem* parent)
    // Initialize this node's attributes
    m_mirrorMode = HorizontalMirroring;
    m_mapperNumber = 0;
+   m_submapperNumber = 0;
+   m_prgRamSize = 0;
+   m_chrRamSize = MEM_8KB;
    m_hasBatteryBackedRam = false;
    m_fourScreen = false;
 
@@ -64,6 +67,9 @@ void CCartridge::initializeProject()
    // Initialize this node's attributes
    m_mirrorMode = HorizontalMirroring;
    m_mapperNumber = 0;
+   m_submapperNumber = 0;
+   m_prgRamSize = 0;
+   m_chrRamSize = MEM_8KB;
    m_hasBatteryBackedRam = false;
    m_fourScreen = false;
 
@@ -81,6 +87,9 @@ void CCartridge::terminateProject()
    // Initialize this node's attributes
    m_mirrorMode = HorizontalMirroring;
    m_mapperNumber = 0;
+   m_submapperNumber = 0;
+   m_prgRamSize = 0;
+   m_chrRamSize = MEM_8KB;
    m_hasBatteryBackedRam = false;
    m_fourScreen = false;
 
@@ -100,6 +109,9 @@ bool CCartridge::serialize(QDomDocument& doc, QDomNode& node)
 
    // Export the iNES header
    cartridgeElement.setAttribute("mapperNumber", m_mapperNumber);
+   cartridgeElement.setAttribute("submapperNumber", m_submapperNumber);
+   cartridgeElement.setAttribute("prgRamSize", m_prgRamSize);
+   cartridgeElement.setAttribute("chrRamSize", m_chrRamSize);
    cartridgeElement.setAttribute("mirrorMode", m_mirrorMode);
    cartridgeElement.setAttribute("hasBatteryBackedRam", m_hasBatteryBackedRam);
    cartridgeElement.setAttribute("fourScreen",m_fourScreen);
@@ -125,6 +137,9 @@ bool CCartridge::deserialize(QDomDocument& doc, QDomNode& node, QString& errors)
    QDomElement cartridgeElement = node.toElement();
 
    setMapperNumber(cartridgeElement.attribute("mapperNumber").toInt());
+   setSubmapperNumber(cartridgeElement.attribute("submapperNumber","0").toInt());
+   setPrgRamSize(cartridgeElement.attribute("prgRamSize","0").toUInt());
+   setChrRamSize(cartridgeElement.attribute("chrRamSize",QString::number(MEM_8KB)).toUInt());
    setMirrorMode((eMirrorMode)cartridgeElement.attribute("mirrorMode").toInt());
    setBatteryBackedRam(cartridgeElement.attribute("hasBatteryBackedRam").toInt() == 1);
    setFourScreen(cartridgeElement.attribute("fourScreen").toInt() == 1);
@@ -32,6 +32,18 @@ public:
    {
       return m_mapperNumber;
    }
+   int getSubmapperNumber()
+   {
+      return m_submapperNumber;
+   }
+   uint32_t getPrgRamSize()
+   {
+      return m_prgRamSize;
+   }
+   uint32_t getChrRamSize()
+   {
+      return m_chrRamSize;
+   }
    bool isBatteryBackedRam()
    {
       return m_hasBatteryBackedRam;
@@ -58,6 +70,18 @@ public:
    {
       m_mapperNumber = mapperNumber;
    }
+   void setSubmapperNumber(int submapperNumber)
+   {
+      m_submapperNumber = submapperNumber;
+   }
+   void setPrgRamSize(uint32_t size)
+   {
+      m_prgRamSize = size;
+   }
+   void setChrRamSize(uint32_t size)
+   {
+      m_chrRamSize = size;
+   }
    void setBatteryBackedRam(bool batteryBackedRam)
    {
       m_hasBatteryBackedRam = batteryBackedRam;
@@ -88,6 +112,9 @@ private:
    eMirrorMode m_mirrorMode;               // Mirror mode used in the emulator
    bool m_hasBatteryBackedRam;                                     // Memory can be saved via RAM kept valid with a battery
    int  m_mapperNumber;                                           // Numeric ID of the cartridge mapper
+   int  m_submapperNumber;                                        // NES 2.0 submapper
+   uint32_t m_prgRamSize;                                         // PRG-RAM plus PRG-NVRAM in bytes, 0 if unknown
+   uint32_t m_chrRamSize;                                         // CHR-RAM plus CHR-NVRAM in bytes
    bool m_fourScreen;
 };
 
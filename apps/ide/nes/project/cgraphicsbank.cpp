@@ -4,6 +4,7 @@
 #include "cnesicideproject.h"
 
 #include "cimageconverters.h"
+#include "tilificationthread.h"
 
 #include "main.h"
 
@@ -14,6 +15,7 @@ CGraphicsBank::CGraphicsBank(IProjectTreeViewItem* parent)
 
    // Allocate attributes
    m_bankItems.clear();
+   m_dedupeTiles = false;
 }
 
 CGraphicsBank::~CGraphicsBank()
@@ -25,11 +27,29 @@ QList<IChrRomBankItem*> CGraphicsBank::getGraphics()
    return m_bankItems;
 }
 
+QByteArray CGraphicsBank::getChrData(QVector<int>* tileMap)
+{
+   QByteArray chrData;
+   int idx;
+
+   if ( m_dedupeTiles )
+   {
+      return TilificationThread::tilify(m_bankItems,tileMap);
+   }
+
+   for ( idx = 0; idx < m_bankItems.count(); idx++ )
+   {
+      chrData += m_bankItems.at(idx)->getChrRomBankItemData();
+   }
+   return chrData;
+}
+
 bool CGraphicsBank::serialize(QDomDocument& doc, QDomNode& node)
 {
    QDomElement element = addElement( doc, node, "graphicsbank" );
    element.setAttribute("name", m_name);
    element.setAttribute("uuid", uuid());
+   element.setAttribute("dedupetiles", m_dedupeTiles);
 
    if ( m_editor && m_editor->isModified() )
    {
@@ -50,20 +70,12 @@ void CGraphicsBank::exportAsPNG()
 {
    QString fileName = QFileDialog::getSaveFileName(NULL,"Export Graphics Bank as PNG",QDir::currentPath());
    QByteArray chrData;
-   QByteArray imgData;
-   int idx;
    QImage imgOut;
 
    if ( !fileName.isEmpty() )
    {
-      for ( idx = 0; idx < m_bankItems.count(); idx++ )
-      {
-         IChrRomBankItem* item = dynamic_cast<IChrRomBankItem*>(m_bankItems.at(idx));
-         if ( item )
-         {
-            chrData += item->getChrRomBankItemData();
-         }
-      }
+      // Same tiles as the built bank.
+      chrData = getChrData();
       imgOut = CImageConverters::toIndexed8(chrData);
 
       imgOut.save(fileName,"png");
@@ -95,6 +107,9 @@ bool CGraphicsBank::deserialize(QDomDocument& /*doc*/, QDomNode& node, QString&
 
    setUuid(element.attribute("uuid"));
 
+   // Projects from before the option keep their tile layout.
+   m_dedupeTiles = element.attribute("dedupetiles","0").toInt();
+
    m_bankItems.clear();
 
    QDomNode childNode = node.firstChild();
@@ -180,7 +195,7 @@ void CGraphicsBank::openItemEvent(CProjectTabWidget* tabWidget)
    }
    else
    {
-      m_editor = new GraphicsBankEditorForm(m_bankItems,this);
+      m_editor = new GraphicsBankEditorForm(m_bankItems,m_dedupeTiles,this);
       tabWidget->addTab(m_editor, this->caption());
       tabWidget->setCurrentWidget(m_editor);
    }
@@ -189,6 +204,7 @@ void CGraphicsBank::openItemEvent(CProjectTabWidget* tabWidget)
 void CGraphicsBank::saveItemEvent()
 {
    m_bankItems = editor()->bankItems();
+   m_dedupeTiles = editor()->dedupeTiles();
 
    if ( m_editor )
    {
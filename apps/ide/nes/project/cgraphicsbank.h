@@ -16,6 +16,12 @@ public:
 
    // Member getters
    QList<IChrRomBankItem*> getGraphics();
+   bool getDedupeTiles() { return m_dedupeTiles; }
+
+   // The bank's CHR data as built.  Duplicate tile stamp tiles are only
+   // left out when the bank asks for it since that moves the tiles after
+   // them.  tileMap is only filled in for such banks.
+   QByteArray getChrData(QVector<int>* tileMap = 0);
 
    GraphicsBankEditorForm* editor() { return dynamic_cast<GraphicsBankEditorForm*>(m_editor); }
    void exportAsPNG();
@@ -37,6 +43,7 @@ public:
 private:
    // Attributes
    QList<IChrRomBankItem*> m_bankItems;
+   bool m_dedupeTiles;
 };
 
 #endif // CGRAPHICSBANK_H
@@ -33,19 +33,41 @@ CTileStamp::CTileStamp(IProjectTreeViewItem* parent)
    m_tileProperties = nesicideProject->getTileProperties();
 
    m_grid = false;
+
+   m_dataLoaded = true;
 }
 
 CTileStamp::~CTileStamp()
 {
 }
 
+void CTileStamp::loadData()
+{
+   CProjectArchive* pArchive = nesicideProject->getProjectArchive();
+
+   if ( !m_dataLoaded )
+   {
+      if ( !m_tileChunk.isEmpty() )
+      {
+         m_tile = QByteArray::fromHex(pArchive->readChunk(m_tileChunk));
+      }
+      if ( !m_attrChunk.isEmpty() )
+      {
+         m_attr = QByteArray::fromHex(pArchive->readChunk(m_attrChunk));
+      }
+      m_dataLoaded = true;
+   }
+}
+
 QByteArray CTileStamp::getTileData()
 {
+   loadData();
    return m_tile;
 }
 
 QByteArray CTileStamp::getAttributeData()
 {
+   loadData();
    return m_attr;
 }
 
@@ -57,8 +79,6 @@ QImage CTileStamp::getTileImage()
 bool CTileStamp::serialize(QDomDocument& doc, QDomNode& node)
 {
    QDomElement element = addElement( doc, node, "tile" );
-   char byte[3];
-   int idx;
 
    element.setAttribute("name", m_name);
    element.setAttribute("uuid", uuid());
@@ -84,31 +104,27 @@ bool CTileStamp::serialize(QDomDocument& doc, QDomNode& node)
       elm.setAttribute("value",item.value);
    }
 
-   // Serialize the tile data.
    QDomElement tileElement = addElement(doc,element,"tile");
-   QDomCDATASection tileDataSect;
-   QString tileDataMem;
+   QDomElement attrElement = addElement(doc,element,"attr");
 
-   for ( idx = 0; idx < m_tile.count(); idx++ )
+   // Data that was never loaded stays where it is in the project archive.
+   if ( !m_dataLoaded &&
+        !m_tileChunk.isEmpty() &&
+        !m_attrChunk.isEmpty() &&
+        nesicideProject->getProjectArchive()->isSerializing() )
    {
-      sprintf(byte,"%02X",(unsigned char)m_tile.at(idx));
-      tileDataMem += byte;
+      tileElement.setAttribute("chunk",m_tileChunk);
+      attrElement.setAttribute("chunk",m_attrChunk);
+      return true;
    }
-   tileDataSect = doc.createCDATASection(tileDataMem);
-   tileElement.appendChild(tileDataSect);
 
-   // Serialize the attribute data.
-   QDomElement attrElement = addElement(doc,element,"attr");
-   QDomCDATASection attrDataSect;
-   QString attrDataMem;
+   loadData();
 
-   for ( idx = 0; idx < m_attr.count(); idx++ )
-   {
-      sprintf(byte,"%02X",(unsigned char)m_attr.at(idx));
-      attrDataMem += byte;
-   }
-   attrDataSect = doc.createCDATASection(attrDataMem);
-   attrElement.appendChild(attrDataSect);
+   // Serialize the tile data.
+   tileElement.appendChild(doc.createCDATASection(QString(m_tile.toHex().toUpper())));
+
+   // Serialize the attribute data.
+   attrElement.appendChild(doc.createCDATASection(QString(m_attr.toHex().toUpper())));
 
    return true;
 }
@@ -122,8 +138,6 @@ bool CTileStamp::deserialize(QDomDocument&, QDomNode& node, QString& errors)
    QDomCDATASection cdataSection;
    QDomNode propertyChild;
    QDomElement propertyChildsElement;
-   QString cdataString;
-   char byte;
    int idx;
 
    if (element.isNull())
@@ -168,28 +182,33 @@ bool CTileStamp::deserialize(QDomDocument&, QDomNode& node, QString& errors)
    {
       if ( child.nodeName() == "tile" )
       {
-         cdataNode = child.firstChild();
-         cdataSection = cdataNode.toCDATASection();
-         cdataString = cdataSection.data();
-         m_tile.clear();
-         while ( cdataString.length() )
+         childsElement = child.toElement();
+         if ( childsElement.hasAttribute("chunk") )
+         {
+            // Loaded from the project archive on first use.
+            m_tileChunk = childsElement.attribute("chunk");
+            m_dataLoaded = false;
+         }
+         else
          {
-            byte = cdataString.left(2).toInt(0,16);
-            cdataString = cdataString.right(cdataString.length()-2);
-            m_tile.append(byte);
+            cdataNode = child.firstChild();
+            cdataSection = cdataNode.toCDATASection();
+            m_tile = QByteArray::fromHex(cdataSection.data().toAscii());
          }
       }
       else if ( child.nodeName() == "attr" )
       {
-         cdataNode = child.firstChild();
-         cdataSection = cdataNode.toCDATASection();
-         cdataString = cdataSection.data();
-         m_attr.clear();
-         while ( cdataString.length() )
+         childsElement = child.toElement();
+         if ( childsElement.hasAttribute("chunk") )
+         {
+            m_attrChunk = childsElement.attribute("chunk");
+            m_dataLoaded = false;
+         }
+         else
          {
-            byte = cdataString.left(2).toInt(0,16);
-            cdataString = cdataString.right(cdataString.length()-2);
-            m_attr.append(byte);
+            cdataNode = child.firstChild();
+            cdataSection = cdataNode.toCDATASection();
+            m_attr = QByteArray::fromHex(cdataSection.data().toAscii());
          }
       }
       else if ( child.nodeName() == "tileproperties" )
@@ -282,6 +301,7 @@ void CTileStamp::openItemEvent(CProjectTabWidget* tabWidget)
    }
    else
    {
+      loadData();
       m_editor = new TileStampEditorForm(m_tile,m_attr,m_attrTblUUID,m_tileProperties,m_xSize,m_ySize,m_grid,this);
       tabWidget->addTab(m_editor, this->caption());
       tabWidget->setCurrentWidget(m_editor);
@@ -53,8 +53,14 @@ public:
    }
 
 private:
+   void loadData();
+
    QByteArray m_tile;
    QByteArray m_attr;
+   // Project archive chunks holding the data until it is first needed.
+   QString    m_tileChunk;
+   QString    m_attrChunk;
+   bool       m_dataLoaded;
    int        m_xSize;
    int        m_ySize;
    QString    m_attrTblUUID;
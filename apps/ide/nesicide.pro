@@ -238,6 +238,7 @@ SOURCES += \
    nes/emulator/nesemulatorcontrol.cpp \
    c64/emulator/c64emulatorcontrol.cpp \
    common/panzoomrenderer.cpp \
+   common/projectsaverthread.cpp \
    common/qtcolorpicker.cpp \
    common/searchbar.cpp \
    common/searchdockwidget.cpp \
@@ -322,6 +323,7 @@ SOURCES += \
    nes/project/cgraphicsbank.cpp \
    nes/project/cgraphicsbanks.cpp \
    project/cnesicideproject.cpp \
+   project/cprojectarchive.cpp \
    nes/project/cprgrombank.cpp \
    nes/project/cprgrombanks.cpp \
    project/cproject.cpp \
@@ -345,6 +347,7 @@ SOURCES += \
    c64/debuggers/dbg_cc64.cpp \
    $$TOP/common/appeventfilter.cpp \
    $$TOP/common/cobjectregistry.cpp \
+   $$TOP/common/cnesmovie.cpp \
     nes/debuggers/joypadloggerdockwidget.cpp \
     model/cprojectmodel.cpp \
     model/csourcefilemodel.cpp \
@@ -385,6 +388,7 @@ HEADERS += \
    nes/emulator/nesemulatorcontrol.h \
    c64/emulator/c64emulatorcontrol.h \
    common/panzoomrenderer.h \
+   common/projectsaverthread.h \
    common/qtcolorpicker.h \
    common/searchbar.h \
    common/searchdockwidget.h \
@@ -473,6 +477,7 @@ HEADERS += \
    nes/project/cgraphicsbank.h \
    nes/project/cgraphicsbanks.h \
    project/cnesicideproject.h \
+   project/cprojectarchive.h \
    nes/project/cprgrombank.h \
    nes/project/cprgrombanks.h \
    project/cproject.h \
@@ -497,6 +502,7 @@ HEADERS += \
    $$TOP/common/cmemorydata.h \
    $$TOP/common/appeventfilter.h \
    $$TOP/common/cobjectregistry.h \
+   $$TOP/common/cnesmovie.h \
     nes/debuggers/joypadloggerdockwidget.h \
     model/cprojectmodel.h \
     model/projectsearcher.h \
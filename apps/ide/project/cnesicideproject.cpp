@@ -15,6 +15,7 @@ CNesicideProject::CNesicideProject()
 {
    // Add node to tree as root
    InitTreeItem(":/resources/folder_closed.png");
+   setTreeIndex(&m_treeIndex);
 
    // Allocate children
    m_pProject = new CProject(this);
@@ -33,6 +34,9 @@ CNesicideProject::CNesicideProject()
 
 CNesicideProject::~CNesicideProject()
 {
+   // Stop indexing before the tree goes away.
+   setTreeIndex(0);
+
    if ( m_pProject )
    {
       delete m_pProject;
@@ -190,6 +194,8 @@ void CNesicideProject::terminateProject()
 
    m_tileProperties.clear();
 
+   m_projectArchive.close();
+
    m_isInitialized = false;
    m_isDirty = false;
 }
@@ -559,14 +565,13 @@ bool CNesicideProject::createProjectFromRom(QString fileName,bool silent)
 
    if (fileIn.exists() && fileIn.open(QIODevice::ReadOnly))
    {
-      QDataStream fs(&fileIn);
-
-      // Check the NES header
-      char nesHeader[4] = {'N', 'E', 'S', 0x1A};
-      char nesTest[4] = {0, 0, 0, 0};
-      fs.readRawData(nesTest,4);
+      QByteArray image = fileIn.readAll();
+      NESROMHeader header;
+      int numPrgRomBanks;
+      int numChrRomBanks;
 
-      if (memcmp(nesHeader, nesTest,4))
+      // Check the iNES/NES 2.0 header
+      if (!nesParseROMHeader((uint8_t*)image.data(),image.size(),&header))
       {
          // Header check failed, quit
          fileIn.close();
@@ -577,37 +582,8 @@ bool CNesicideProject::createProjectFromRom(QString fileName,bool silent)
          return false;
       }
 
-      // Number of 16 KB PRG-ROM banks
-      qint8 numPrgRomBanks;
-      fs >> numPrgRomBanks;
-
-      // Convert to 8 KB banks
-      numPrgRomBanks <<= 1;
-
-      // Get the number of 8 KB CHR-ROM / VROM banks
-      qint8 numChrRomBanks;
-      fs >> numChrRomBanks;
-
-      // ROM Control Byte 1:
-      // - Bit 0 - Indicates the type of mirroring used by the game
-      //   where 0 indicates horizontal mirroring, 1 indicates
-      //   vertical mirroring.
-      //
-      // - Bit 1 - Indicates the presence of battery-backed RAM at
-      //   memory locations $6000-$7FFF.
-      //
-      // - Bit 2 - Indicates the presence of a 512-byte trainer at
-      //   memory locations $7000-$71FF.
-      //
-      // - Bit 3 - If this bit is set it overrides bit 0 to indicate fourscreen
-      //   mirroring should be used.
-      //
-      // - Bits 4-7 - Four lower bits of the mapper number.
-      qint8 romCB1;
-      fs >> romCB1;
-
       // First extract the mirror mode
-      if ((romCB1&FLAG_MIRROR) == FLAG_MIRROR_VERT)
+      if (header.verticalMirroring)
       {
          m_pCartridge->setMirrorMode(VerticalMirroring);
       }
@@ -615,63 +591,19 @@ bool CNesicideProject::createProjectFromRom(QString fileName,bool silent)
       {
          m_pCartridge->setMirrorMode(HorizontalMirroring);
       }
-      if ((romCB1&FLAG_VRAM) == FLAG_FOURSCREEN_VRAM)
-      {
-         m_pCartridge->setFourScreen(true);
-      }
-
-      // Now extract the two flags (battery backed ram and trainer)
-      m_pCartridge->setBatteryBackedRam(romCB1 & 0x02);
-      bool hasTrainer = (romCB1 & 0x04);
-
-      // ROM Control Byte 2:
-      //  Bits 0-3 - Reserved for future usage and should all be 0.
-      //  Bits 4-7 - Four upper bits of the mapper number.
-      qint8 romCB2;
-      fs >> romCB2;
-
-      if ( romCB2&0x0F )
-      {
-         romCB2 = 0x00;
-         if (!silent)
-         {
-            QMessageBox::information(0, "Warning", "Invalid iNES header format.\nSave the project to fix.");
-         }
-      }
-
-      // Extract the upper four bits of the mapper number
-      m_pCartridge->setMapperNumber(((romCB1>>4)&0x0F)|(romCB2&0xF0));
-
-      // Number of 8 KB RAM banks. For compatibility with previous
-      // versions of the iNES format, assume 1 page of RAM when
-      // this is 0.
-      qint8 numRamBanks;
-      fs >> numRamBanks;
-
-      if (numRamBanks == 0)
-      {
-         numRamBanks = 1;
-      }
-
-      // Skip the 7 reserved bytes
-      qint8 skip;
+      m_pCartridge->setFourScreen(header.fourScreen);
+      m_pCartridge->setBatteryBackedRam(header.batteryBackedRam);
 
-      for (int i=0; i<7; i++)
-      {
-         fs >> skip;
-      }
+      m_pCartridge->setMapperNumber(header.mapper);
+      m_pCartridge->setSubmapperNumber(header.submapper);
+      m_pCartridge->setPrgRamSize(header.prgRamSize+header.prgNvramSize);
+      m_pCartridge->setChrRamSize(header.chrRamSize+header.chrNvramSize);
 
-      // Extract the trainer (if it exists)
-      if (hasTrainer)
-      {
-         // TODO: Handle trainer. Skipping for now.
-         for (int i=0; i<512; i++)
-         {
-            fs >> skip;
-         }
-      }
+      // The trainer, if any, is skipped.
+      numPrgRomBanks = header.prgRomSize/MEM_8KB;
+      numChrRomBanks = header.chrRomSize/MEM_8KB;
 
-      // Load the PRG-ROM banks (16KB each)
+      // Load the PRG-ROM banks (8KB each)
       oldBanks = prgRomBanks->getPrgRomBanks().count();
       bankIdx = 0;
       for (int bank=0; bank<numPrgRomBanks; bank++)
@@ -694,7 +626,7 @@ bool CNesicideProject::createProjectFromRom(QString fileName,bool silent)
             curBank = prgRomBanks->getPrgRomBanks().at(bankIdx++);
          }
 
-         fs.readRawData((char*)curBank->getBankData(),MEM_8KB);
+         memcpy(curBank->getBankData(),image.constData()+header.prgRomOffset+(bank*MEM_8KB),MEM_8KB);
       }
 
       // Load the CHR-ROM banks (8KB each)
@@ -720,7 +652,7 @@ bool CNesicideProject::createProjectFromRom(QString fileName,bool silent)
             curBank = chrRomBanks->getChrRomBanks().at(bankIdx++);
          }
 
-         fs.readRawData((char*)curBank->getBankData(),MEM_8KB);
+         memcpy(curBank->getBankData(),image.constData()+header.chrRomOffset+(bank*MEM_8KB),MEM_8KB);
       }
 
       str = "<b>Searcing internal game database: ";
@@ -843,14 +775,62 @@ bool CNesicideProject::createRomFromProject(QString fileName)
 
        romCB2 |= (m_pCartridge->getMapperNumber()&0xF0);
 
-       fs << romCB2;
+       // Only use a NES 2.0 header if the cartridge can't be described by iNES 1.0.
+       bool nes2 = (m_pCartridge->getSubmapperNumber() != 0) ||
+                   (m_pCartridge->getMapperNumber() > 255);
+
+       if ( nes2 )
+       {
+          romCB2 |= NES2_HEADER_ID;
+       }
 
-       // Skip the 7 reserved bytes
-       qint8 skip = 0;
+       fs << romCB2;
 
-       for (int i=0; i<8; i++)
+       if ( nes2 )
+       {
+          // Byte 8: Mapper bits 8-11 and submapper.
+          qint8 mapperMSB = ((m_pCartridge->getMapperNumber()>>8)&0x0F)|((m_pCartridge->getSubmapperNumber()&0x0F)<<4);
+          fs << mapperMSB;
+
+          // Byte 9: PRG-ROM/CHR-ROM size MSBs (always zero here).
+          qint8 romSizeMSB = 0;
+          fs << romSizeMSB;
+
+          // Bytes 10-11: PRG-RAM and CHR-RAM shift counts.
+          // An unknown PRG-RAM size is written as the customary 8KB.
+          uint32_t prgRamSize = m_pCartridge->getPrgRamSize()?m_pCartridge->getPrgRamSize():MEM_8KB;
+          qint8 prgRamShift = 0;
+          qint8 chrRamShift = 0;
+          while ( (64<<prgRamShift) < (int)prgRamSize ) prgRamShift++;
+          while ( (64<<chrRamShift) < (int)m_pCartridge->getChrRamSize() ) chrRamShift++;
+          if ( m_pCartridge->isBatteryBackedRam() )
+          {
+             prgRamShift <<= 4;
+          }
+          if ( numChrRomBanks )
+          {
+             chrRamShift = 0;
+          }
+          fs << prgRamShift;
+          fs << chrRamShift;
+
+          // Skip the 4 remaining bytes
+          qint8 skip = 0;
+
+          for (int i=0; i<4; i++)
+          {
+             fs << skip;
+          }
+       }
+       else
        {
-          fs << skip;
+          // Skip the 8 reserved bytes
+          qint8 skip = 0;
+
+          for (int i=0; i<8; i++)
+          {
+             fs << skip;
+          }
        }
 
        // Ignore trainer.
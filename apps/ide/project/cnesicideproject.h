@@ -5,6 +5,7 @@
 #include "ccartridge.h"
 #include "cproject.h"
 #include "cpropertylistmodel.h"
+#include "cprojectarchive.h"
 
 #include <QString>
 #include <QStringList>
@@ -68,6 +69,7 @@ public:
    QList<CPaletteEntry> *getProjectPaletteEntries() { return &m_projectPaletteEntries; }
    CCartridge* getCartridge() { return m_pCartridge; }
    CProject* getProject() { return m_pProject; }
+   CProjectArchive* getProjectArchive() { return &m_projectArchive; }
 
    // Member Setters
    void setProjectFileName(QString value) { m_projectFileName = value; }
@@ -181,6 +183,12 @@ private:
    CProject*            m_pProject;
    CCartridge*          m_pCartridge;
 
+   // Items of the project tree by UUID and by type.
+   IProjectTreeViewItemIndex m_treeIndex;
+
+   // Binary project file the project was opened from or last saved to.
+   CProjectArchive m_projectArchive;
+
 signals:
    void createTarget(QString target);
 };
@@ -0,0 +1,548 @@
+#include "cprojectarchive.h"
+
+#include <QFileInfo>
+#include <QDataStream>
+#include <QStringList>
+#include <QCryptographicHash>
+#include <QMutexLocker>
+
+// File layout: magic, version, offset of the index, then the chunks, then
+// the index.
+#define ARCHIVE_MAGIC       "NESICIDE"
+#define ARCHIVE_MAGIC_SIZE  8
+#define ARCHIVE_VERSION     1
+#define ARCHIVE_INDEX_POS   (ARCHIVE_MAGIC_SIZE+4)
+#define ARCHIVE_HEADER_SIZE (ARCHIVE_INDEX_POS+8)
+
+// The project XML with the chunks taken out.
+#define PROJECT_CHUNK "project"
+
+// CDATA larger than this is moved to a chunk of its own.
+#define CHUNK_THRESHOLD 4096
+
+// Chunks smaller than this aren't worth compressing.
+#define COMPRESS_THRESHOLD 256
+
+// Elements whose data is read by their owner on first use instead of on open.
+static const char* lazyElements[] =
+{
+   "tile/tile",
+   "tile/attr",
+   NULL
+};
+
+static bool isLazyElement(QString path)
+{
+   int idx;
+
+   for ( idx = 0; lazyElements[idx]; idx++ )
+   {
+      if ( path == lazyElements[idx] )
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
+static bool writeHeader(QFile& file,quint64 indexOffset)
+{
+   QDataStream stream(&file);
+
+   stream.setVersion(QDataStream::Qt_4_6);
+
+   if ( !file.seek(0) )
+   {
+      return false;
+   }
+   stream.writeRawData(ARCHIVE_MAGIC,ARCHIVE_MAGIC_SIZE);
+   stream << (quint32)ARCHIVE_VERSION;
+   stream << indexOffset;
+
+   return stream.status() == QDataStream::Ok;
+}
+
+CProjectArchive::CProjectArchive()
+{
+   m_isOpen = false;
+   m_isSerializing = false;
+   m_pendingSaves = 0;
+}
+
+CProjectArchive::~CProjectArchive()
+{
+   close();
+}
+
+bool CProjectArchive::isArchive(QString fileName)
+{
+   QFile file(fileName);
+
+   if ( !file.open(QFile::ReadOnly) )
+   {
+      return false;
+   }
+
+   return file.read(ARCHIVE_MAGIC_SIZE) == ARCHIVE_MAGIC;
+}
+
+bool CProjectArchive::open(QString fileName,QDomDocument& doc,QString& errors)
+{
+   QDomNodeList elements;
+   QDomElement element;
+   QByteArray data;
+   QString key;
+   QString parseError;
+   int parseLine;
+   int idx;
+   bool missing = false;
+
+   close();
+
+   QMutexLocker locker(&m_mutex);
+
+   m_file.setFileName(fileName);
+   if ( !m_file.open(QFile::ReadOnly) )
+   {
+      errors.append("Failed to open the project file.\n");
+      return false;
+   }
+
+   if ( !readIndex(m_file,m_index,errors) )
+   {
+      m_file.close();
+      m_index.clear();
+      return false;
+   }
+
+   if ( !m_index.contains(PROJECT_CHUNK) )
+   {
+      errors.append("The project file has no project data.\n");
+      m_file.close();
+      m_index.clear();
+      return false;
+   }
+
+   data = loadChunk(m_index.value(PROJECT_CHUNK));
+   if ( !doc.setContent(data,&parseError,&parseLine) )
+   {
+      errors.append("Failed to parse the project xml data at line "+QString::number(parseLine)+": "+parseError+"\n");
+      m_file.close();
+      m_index.clear();
+      return false;
+   }
+
+   // Put the data of chunks that aren't loaded on demand back in the document.
+   elements = doc.elementsByTagName("*");
+   for ( idx = 0; idx < elements.count(); idx++ )
+   {
+      element = elements.at(idx).toElement();
+      if ( element.hasAttribute("chunk") )
+      {
+         key = element.attribute("chunk");
+         if ( !m_index.contains(key) )
+         {
+            errors.append("Missing project data chunk '"+key+"'.\n");
+            missing = true;
+         }
+         else if ( !(m_index.value(key).flags&Chunk_Lazy) )
+         {
+            data = loadChunk(m_index.value(key));
+            element.removeAttribute("chunk");
+            element.appendChild(doc.createCDATASection(QString::fromUtf8(data)));
+         }
+      }
+   }
+
+   // Loading what's left would lose the missing data on the next save.
+   if ( missing )
+   {
+      m_file.close();
+      m_index.clear();
+      return false;
+   }
+
+   m_fileName = fileName;
+   m_isOpen = true;
+
+   return true;
+}
+
+void CProjectArchive::close()
+{
+   waitForSaves();
+
+   QMutexLocker locker(&m_mutex);
+
+   m_file.close();
+   m_index.clear();
+   m_fileName.clear();
+   m_isOpen = false;
+}
+
+QByteArray CProjectArchive::readChunk(QString key)
+{
+   QMutexLocker locker(&m_mutex);
+   QByteArray data;
+
+   if ( m_isOpen && m_index.contains(key) )
+   {
+      data = loadChunk(m_index.value(key));
+   }
+
+   return data;
+}
+
+bool CProjectArchive::write(QString fileName,QDomDocument doc,QString& errors)
+{
+   QMap<QString,QByteArray> payloads;
+   QMap<QString,QByteArray> changed;
+   QMap<QString,uint32_t> flags;
+   QStringList refs;
+   ChunkIndex index;
+   ChunkIndex written;
+   QFile file;
+   QString key;
+   QString tempFileName;
+   QByteArray data;
+   ChunkEntry entry;
+   quint64 liveSize = 0;
+   quint64 keptSize = 0;
+   quint64 indexOffset;
+   bool sameFile;
+   bool rewrite;
+
+   // Pull the large payloads out of the document, what's left of it is the
+   // project chunk.
+   extractChunks(doc.documentElement(),QString(),payloads,flags,refs);
+   payloads.insert(PROJECT_CHUNK,doc.toByteArray());
+   flags.insert(PROJECT_CHUNK,0);
+
+   QMutexLocker locker(&m_mutex);
+
+   sameFile = m_isOpen && (QFileInfo(fileName).absoluteFilePath() == QFileInfo(m_fileName).absoluteFilePath());
+
+   // Chunks that weren't loaded are carried over from the open file.
+   foreach ( key, refs )
+   {
+      if ( !m_isOpen || !m_index.contains(key) )
+      {
+         errors.append("Missing project data chunk '"+key+"'.\n");
+         return false;
+      }
+      index.insert(key,m_index.value(key));
+      keptSize += m_index.value(key).storedSize;
+   }
+
+   // So are chunks whose content didn't change.
+   foreach ( key, payloads.keys() )
+   {
+      data = payloads.value(key);
+      if ( m_isOpen &&
+           m_index.contains(key) &&
+           (m_index.value(key).flags&Chunk_Lazy) == flags.value(key) &&
+           m_index.value(key).hash == QCryptographicHash::hash(data,QCryptographicHash::Md5) )
+      {
+         index.insert(key,m_index.value(key));
+         keptSize += m_index.value(key).storedSize;
+      }
+      else
+      {
+         changed.insert(key,data);
+         liveSize += data.size();
+      }
+   }
+   liveSize += keptSize;
+
+   // Append to the open file unless the stale data in it would outweigh
+   // the live data, otherwise write a fresh file next to it and swap it in.
+   rewrite = !sameFile || ((quint64)m_file.size() > ARCHIVE_HEADER_SIZE+keptSize+liveSize);
+
+   if ( !rewrite )
+   {
+      file.setFileName(fileName);
+      if ( !file.open(QFile::ReadWrite) )
+      {
+         errors.append("Failed to open the project file for writing.\n");
+         return false;
+      }
+      written = index;
+      file.seek(file.size());
+   }
+   else
+   {
+      tempFileName = fileName+".tmp";
+      file.setFileName(tempFileName);
+      if ( !file.open(QFile::WriteOnly|QFile::Truncate) ||
+           !writeHeader(file,0) )
+      {
+         errors.append("Failed to open the project file for writing.\n");
+         return false;
+      }
+
+      // Copy the kept chunks as stored.
+      foreach ( key, index.keys() )
+      {
+         entry = index.value(key);
+         data = readStoredChunk(entry);
+         entry.offset = file.pos();
+         if ( (uint32_t)data.size() != entry.storedSize ||
+              file.write(data) != data.size() )
+         {
+            errors.append("Failed to copy project data chunk '"+key+"'.\n");
+            file.close();
+            file.remove();
+            return false;
+         }
+         written.insert(key,entry);
+      }
+   }
+
+   foreach ( key, changed.keys() )
+   {
+      if ( !writeChunk(file,key,changed.value(key),flags.value(key),written) )
+      {
+         errors.append("Failed to write project data chunk '"+key+"'.\n");
+         file.close();
+         if ( rewrite )
+         {
+            file.remove();
+         }
+         return false;
+      }
+   }
+
+   // The header is updated last so an interrupted append leaves the
+   // previous index in effect.
+   indexOffset = file.pos();
+   if ( !writeIndex(file,written) ||
+        !file.flush() ||
+        !writeHeader(file,indexOffset) )
+   {
+      errors.append("Failed to write the project file index.\n");
+      file.close();
+      if ( rewrite )
+      {
+         file.remove();
+      }
+      return false;
+   }
+   file.close();
+
+   m_file.close();
+   if ( rewrite )
+   {
+      QFile::remove(fileName);
+      if ( !QFile::rename(tempFileName,fileName) )
+      {
+         errors.append("Failed to replace the project file.\n");
+         m_isOpen = false;
+         m_index.clear();
+         return false;
+      }
+   }
+
+   m_fileName = fileName;
+   m_index = written;
+   m_file.setFileName(fileName);
+   m_isOpen = m_file.open(QFile::ReadOnly);
+
+   return m_isOpen;
+}
+
+void CProjectArchive::beginSave()
+{
+   QMutexLocker locker(&m_pendingMutex);
+
+   m_pendingSaves++;
+}
+
+void CProjectArchive::endSave()
+{
+   QMutexLocker locker(&m_pendingMutex);
+
+   m_pendingSaves--;
+   if ( !m_pendingSaves )
+   {
+      m_savesDone.wakeAll();
+   }
+}
+
+void CProjectArchive::waitForSaves()
+{
+   QMutexLocker locker(&m_pendingMutex);
+
+   while ( m_pendingSaves )
+   {
+      m_savesDone.wait(&m_pendingMutex);
+   }
+}
+
+void CProjectArchive::extractChunks(QDomElement element,QString owner,QMap<QString,QByteArray>& payloads,QMap<QString,uint32_t>& flags,QStringList& refs)
+{
+   QDomElement child;
+   QDomCDATASection cdata;
+   QString key;
+   bool lazy;
+   int idx;
+
+   if ( element.hasAttribute("uuid") )
+   {
+      owner = element.attribute("uuid");
+   }
+
+   for ( child = element.firstChildElement(); !child.isNull(); child = child.nextSiblingElement() )
+   {
+      if ( child.hasAttribute("chunk") )
+      {
+         refs.append(child.attribute("chunk"));
+      }
+      else if ( (child.childNodes().count() == 1) && child.firstChild().isCDATASection() )
+      {
+         cdata = child.firstChild().toCDATASection();
+         lazy = isLazyElement(element.tagName()+"/"+child.tagName());
+         if ( lazy || (cdata.length() >= CHUNK_THRESHOLD) )
+         {
+            key = owner+"/"+child.tagName();
+            for ( idx = 1; payloads.contains(key); idx++ )
+            {
+               key = owner+"/"+child.tagName()+"#"+QString::number(idx);
+            }
+            payloads.insert(key,cdata.data().toUtf8());
+            flags.insert(key,lazy?Chunk_Lazy:0);
+            child.removeChild(cdata);
+            child.setAttribute("chunk",key);
+         }
+      }
+      else
+      {
+         extractChunks(child,owner,payloads,flags,refs);
+      }
+   }
+}
+
+QByteArray CProjectArchive::readStoredChunk(const ChunkEntry& entry)
+{
+   if ( !m_file.seek(entry.offset) )
+   {
+      return QByteArray();
+   }
+   return m_file.read(entry.storedSize);
+}
+
+QByteArray CProjectArchive::loadChunk(const ChunkEntry& entry)
+{
+   QByteArray data = readStoredChunk(entry);
+
+   if ( entry.flags&Chunk_Compressed )
+   {
+      data = qUncompress(data);
+   }
+   return data;
+}
+
+bool CProjectArchive::readIndex(QFile& file,ChunkIndex& index,QString& errors)
+{
+   QDataStream stream(&file);
+   QString key;
+   ChunkEntry entry;
+   quint32 version;
+   quint64 indexOffset;
+   quint32 count;
+   quint32 idx;
+
+   stream.setVersion(QDataStream::Qt_4_6);
+
+   if ( file.read(ARCHIVE_MAGIC_SIZE) != ARCHIVE_MAGIC )
+   {
+      errors.append("The file is not a NESICIDE project archive.\n");
+      return false;
+   }
+
+   stream >> version >> indexOffset;
+   if ( version > ARCHIVE_VERSION )
+   {
+      errors.append("The project file was written by a newer version of NESICIDE.\n");
+      return false;
+   }
+
+   if ( !file.seek(indexOffset) )
+   {
+      errors.append("The project file index is damaged.\n");
+      return false;
+   }
+
+   stream >> count;
+   for ( idx = 0; (idx < count) && (stream.status() == QDataStream::Ok); idx++ )
+   {
+      stream >> key;
+      stream >> entry.flags;
+      stream >> entry.offset;
+      stream >> entry.storedSize;
+      stream >> entry.size;
+      stream >> entry.hash;
+      index.insert(key,entry);
+   }
+
+   if ( stream.status() != QDataStream::Ok )
+   {
+      errors.append("The project file index is damaged.\n");
+      return false;
+   }
+
+   return true;
+}
+
+bool CProjectArchive::writeChunk(QFile& file,QString key,QByteArray data,uint32_t flags,ChunkIndex& index)
+{
+   ChunkEntry entry;
+   QByteArray stored = data;
+   QByteArray compressed;
+
+   entry.flags = flags;
+   entry.size = data.size();
+   entry.hash = QCryptographicHash::hash(data,QCryptographicHash::Md5);
+
+   if ( data.size() >= COMPRESS_THRESHOLD )
+   {
+      compressed = qCompress(data);
+      if ( compressed.size() < data.size() )
+      {
+         stored = compressed;
+         entry.flags |= Chunk_Compressed;
+      }
+   }
+
+   entry.offset = file.pos();
+   entry.storedSize = stored.size();
+
+   if ( file.write(stored) != stored.size() )
+   {
+      return false;
+   }
+
+   index.insert(key,entry);
+
+   return true;
+}
+
+bool CProjectArchive::writeIndex(QFile& file,const ChunkIndex& index)
+{
+   QDataStream stream(&file);
+   ChunkIndex::const_iterator iter;
+
+   stream.setVersion(QDataStream::Qt_4_6);
+
+   stream << (quint32)index.count();
+   for ( iter = index.constBegin(); iter != index.constEnd(); ++iter )
+   {
+      stream << iter.key();
+      stream << (quint32)iter.value().flags;
+      stream << iter.value().offset;
+      stream << (quint32)iter.value().storedSize;
+      stream << (quint32)iter.value().size;
+      stream << iter.value().hash;
+   }
+
+   return stream.status() == QDataStream::Ok;
+}
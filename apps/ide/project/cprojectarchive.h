@@ -0,0 +1,89 @@
+#ifndef CPROJECTARCHIVE_H
+#define CPROJECTARCHIVE_H
+
+#include <QString>
+#include <QByteArray>
+#include <QMap>
+#include <QFile>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QDomDocument>
+
+#include "stdint.h"
+
+// Binary project file container.  The project XML is kept in one chunk of
+// the file, large payloads of the project are pulled out of the XML into
+// chunks of their own and replaced by a chunk="key" reference.  The index
+// of the chunks is stored at the end of the file.
+//
+// Chunks marked lazy stay referenced in the document handed back by open(),
+// their owner reads them with readChunk() when it first needs them.  The
+// other chunks are put back into the document on open.
+//
+// Saving to the file the archive was opened from only appends the chunks
+// that changed and a new index, the file is rewritten as a whole when the
+// stale data in it outweighs the live data.
+class CProjectArchive
+{
+public:
+   CProjectArchive();
+   virtual ~CProjectArchive();
+
+   static bool isArchive(QString fileName);
+
+   bool open(QString fileName,QDomDocument& doc,QString& errors);
+   void close();
+   bool isOpen() const { return m_isOpen; }
+   QByteArray readChunk(QString key);
+
+   // Writes the document.  May be called from a worker thread, saves handed
+   // to a worker are bracketed by beginSave() and endSave() so that closing
+   // the archive can wait for them.
+   bool write(QString fileName,QDomDocument doc,QString& errors);
+   void beginSave();
+   void endSave();
+   void waitForSaves();
+
+   // Set while the project is serialized for an archive save, unloaded lazy
+   // data is then written as a reference to its chunk.
+   void setSerializing(bool serializing) { m_isSerializing = serializing; }
+   bool isSerializing() const { return m_isSerializing; }
+
+private:
+   enum
+   {
+      Chunk_Compressed = 0x01,
+      Chunk_Lazy = 0x02
+   };
+
+   typedef struct
+   {
+      uint32_t   flags;
+      quint64    offset;
+      uint32_t   storedSize;
+      uint32_t   size;
+      QByteArray hash;
+   } ChunkEntry;
+
+   typedef QMap<QString,ChunkEntry> ChunkIndex;
+
+   void extractChunks(QDomElement element,QString owner,QMap<QString,QByteArray>& payloads,QMap<QString,uint32_t>& flags,QStringList& refs);
+   QByteArray readStoredChunk(const ChunkEntry& entry);
+   QByteArray loadChunk(const ChunkEntry& entry);
+   bool readIndex(QFile& file,ChunkIndex& index,QString& errors);
+   bool writeChunk(QFile& file,QString key,QByteArray data,uint32_t flags,ChunkIndex& index);
+   bool writeIndex(QFile& file,const ChunkIndex& index);
+
+   bool           m_isOpen;
+   bool           m_isSerializing;
+   QString        m_fileName;
+   QFile          m_file;
+   ChunkIndex     m_index;
+   QMutex         m_mutex;
+
+   int            m_pendingSaves;
+   QMutex         m_pendingMutex;
+   QWaitCondition m_savesDone;
+};
+
+#endif // CPROJECTARCHIVE_H
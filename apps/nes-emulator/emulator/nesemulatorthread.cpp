@@ -116,6 +116,20 @@ void NESEmulatorThread::kill()
    }
 }
 
+void NESEmulatorThread::stopEmulation ()
+{
+   // Pause the emulator and wait for it to finish the frame it is in.
+   // The PRG-ROM is run in place from the cartridge image so the image
+   // must not be released while the emulator can still touch it.
+   m_isStarting = false;
+   m_isRunning = false;
+   m_isResetting = false;
+   m_isPaused = true;
+   m_showOnPause = false;
+
+   wait();
+}
+
 void NESEmulatorThread::primeEmulator(CCartridge* pCartridge)
 {
    m_pCartridge = pCartridge;
@@ -128,18 +142,20 @@ void NESEmulatorThread::loadCartridge()
    // Clear emulator's cartridge ROMs...
    nesUnloadROM();
 
-   // Load cartridge PRG-ROM banks into emulator...
-   for ( b = 0; b < m_pCartridge->getNumPrgRomBanks(); b++ )
-   {
-      nesLoadPRGROMBank(b,(uint8_t*)m_pCartridge->getPointerToPrgRomBank(b));
-   }
+   // Hand the cartridge's memory-mapped PRG-ROM to the emulator...
+   nesLoadPRGROM(m_pCartridge->getPrgRom(),m_pCartridge->getNumPrgRomBanks());
 
    // Load cartridge CHR-ROM banks into emulator...
+   // CHR memory is writable in the emulator so it is still copied.
    for ( b = 0; b < m_pCartridge->getNumChrRomBanks(); b++ )
    {
       nesLoadCHRROMBank(b,(uint8_t*)m_pCartridge->getPointerToChrRomBank(b));
    }
 
+   // Pass on the NES 2.0 header information...
+   nesSetSubmapper(m_pCartridge->getSubmapperNumber());
+   nesSetPRGRAMSize(m_pCartridge->getPrgRamSize());
+
    // Perform any necessary fixup on from the ROM loading...
    nesLoadROM();
 
@@ -17,6 +17,7 @@ public:
    NESEmulatorThread ( QObject* parent = 0 );
    virtual ~NESEmulatorThread ();
    void kill();
+   void stopEmulation ();
 
    // IXMLSerializable Interface Implementation
    virtual bool serialize(QDomDocument& doc, QDomNode& node);
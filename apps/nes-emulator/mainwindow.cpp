@@ -70,7 +70,7 @@ MainWindow::MainWindow(QWidget* parent) :
 
    if ( sl_nes.count() >= 1 )
    {
-      emit pauseEmulation(false);
+      m_pNESEmulatorThread->stopEmulation();
 
       loadCartridge(sl_nes.at(0));
 
@@ -183,7 +183,8 @@ void MainWindow::saveEmulatorState(QString fileName)
 
 void MainWindow::loadCartridge ( QString fileName )
 {
-   QString str;
+   QFileInfo fileInfo(fileName);
+   NESROMHeader header;
 
    // Make sure our pointers are in order..
    if (!cartridge)
@@ -191,135 +192,75 @@ void MainWindow::loadCartridge ( QString fileName )
       cartridge = new CCartridge();
    }
 
-   QFile fileIn(fileName);
-   QFileInfo fileInfo(fileName);
-
-   if (fileIn.exists() && fileIn.open(QIODevice::ReadOnly))
+   // Map the ROM image.  The PRG-ROM is handed to the emulator core in place
+   // so nothing is copied out of the mapping.
+   if ( !cartridge->openImage(fileName) )
    {
-      QDataStream fs(&fileIn);
-
-      // Check the NES header
-      char nesHeader[4] = {'N', 'E', 'S', 0x1A};
-      char nesTest[4] = {0, 0, 0, 0};
-      fs.readRawData(nesTest,4);
-
-      if (memcmp(nesHeader, nesTest,4))
-      {
-         // Header check failed, quit
-         fileIn.close();
-         QMessageBox::information(0, "Error", "Invalid ROM format.\nCannot create project.");
-         return;
-      }
-
-      // Number of 16 KB PRG-ROM banks
-      qint8 numPrgRomBanks;
-      fs >> numPrgRomBanks;
-
-      // Convert to 8 KB banks
-      numPrgRomBanks <<= 1;
-
-      // Get the number of 8 KB CHR-ROM / VROM banks
-      qint8 numChrRomBanks;
-      fs >> numChrRomBanks;
-
-      // ROM Control Byte 1:
-      // - Bit 0 - Indicates the type of mirroring used by the game
-      //   where 0 indicates horizontal mirroring, 1 indicates
-      //   vertical mirroring.
-      //
-      // - Bit 1 - Indicates the presence of battery-backed RAM at
-      //   memory locations $6000-$7FFF.
-      //
-      // - Bit 2 - Indicates the presence of a 512-byte trainer at
-      //   memory locations $7000-$71FF.
-      //
-      // - Bit 3 - If this bit is set it overrides bit 0 to indicate fourscreen
-      //   mirroring should be used.
-      //
-      // - Bits 4-7 - Four lower bits of the mapper number.
-      qint8 romCB1;
-      fs >> romCB1;
-
-      // First extract the mirror mode
-      if ((romCB1&FLAG_MIRROR) == FLAG_MIRROR_VERT)
-      {
-         cartridge->setMirrorMode(VerticalMirroring);
-      }
-      else
-      {
-         cartridge->setMirrorMode(HorizontalMirroring);
-      }
-
-      // Now extract the two flags (battery backed ram and trainer)
-      cartridge->setBatteryBackedRam(romCB1 & 0x02);
-      bool hasTrainer = (romCB1 & 0x04);
-
-      // ROM Control Byte 2:
-      //  Bits 0-3 - Reserved for future usage and should all be 0.
-      //  Bits 4-7 - Four upper bits of the mapper number.
-      qint8 romCB2;
-      fs >> romCB2;
-
-      if ( romCB2&0x0F )
-      {
-         romCB2 = 0x00;
-         QMessageBox::information(0, "Warning", "Invalid iNES header format.\nSave the project to fix.");
-      }
+      return;
+   }
 
-      // Extract the upper four bits of the mapper number
-      cartridge->setMapperNumber(((romCB1>>4)&0x0F)|(romCB2&0xF0));
+   // Check the iNES/NES 2.0 header
+   if ( !nesParseROMHeader(cartridge->getImage(),cartridge->getImageSize(),&header) )
+   {
+      // Header check failed, quit
+      cartridge->closeImage();
+      QMessageBox::information(0, "Error", "Invalid ROM format.\nCannot create project.");
+      return;
+   }
 
-      // Number of 8 KB RAM banks. For compatibility with previous
-      // versions of the iNES format, assume 1 page of RAM when
-      // this is 0.
-      qint8 numRamBanks;
-      fs >> numRamBanks;
+   if ( !nesIsMapperSupported(header.mapper) )
+   {
+      cartridge->closeImage();
+      QMessageBox::information(0, "Error", "Mapper "+QString::number(header.mapper)+" is not supported.");
+      return;
+   }
 
-      if (numRamBanks == 0)
-      {
-         numRamBanks = 1;
-      }
+   // First extract the mirror mode
+   if ( header.verticalMirroring )
+   {
+      cartridge->setMirrorMode(VerticalMirroring);
+   }
+   else
+   {
+      cartridge->setMirrorMode(HorizontalMirroring);
+   }
+   cartridge->setFourScreen(header.fourScreen);
+   cartridge->setBatteryBackedRam(header.batteryBackedRam);
 
-      // Skip the 7 reserved bytes
-      qint8 skip;
+   cartridge->setMapperNumber(header.mapper);
+   cartridge->setSubmapperNumber(header.submapper);
 
-      for (int i=0; i<7; i++)
-      {
-         fs >> skip;
-      }
+   // PRG-RAM size.  Volatile and battery-backed RAM are accounted for
+   // together, iNES 1.0 headers leave it unknown.
+   cartridge->setPrgRamSize(header.prgRamSize+header.prgNvramSize);
+   cartridge->setTiming(header.timing);
 
-      // Extract the trainer (if it exists)
-      if (hasTrainer)
-      {
-         // TODO: Handle trainer. Skipping for now.
-         for (int i=0; i<512; i++)
-         {
-            fs >> skip;
-         }
-      }
+   // NES 2.0 ROMs say which console they're meant for.  Follow that for this
+   // ROM without changing the preferred TV standard.
+   if ( header.nes2 && (header.timing != NES2_TIMING_MULTI) )
+   {
+      uint32_t systemMode = MODE_NTSC;
 
-      // Load the PRG-ROM banks (16KB each)
-      for (int bank=0; bank<numPrgRomBanks; bank++)
+      if ( header.timing == NES2_TIMING_PAL )
       {
-         // Load in the binary data
-         fs.readRawData(cartridge->getPointerToPrgRomBank(bank),MEM_8KB);
+         systemMode = MODE_PAL;
       }
-
-      cartridge->setNumPrgRomBanks(numPrgRomBanks);
-
-      // Load the CHR-ROM banks (8KB each)
-      for (int bank=0; bank<numChrRomBanks; bank++)
+      else if ( header.timing == NES2_TIMING_DENDY )
       {
-         // Load in the binary data
-         fs.readRawData(cartridge->getPointerToChrRomBank(bank),MEM_8KB);
+         systemMode = MODE_DENDY;
       }
+      ui->actionNTSC->setChecked(systemMode==MODE_NTSC);
+      ui->actionPAL->setChecked(systemMode==MODE_PAL);
+      ui->actionDendy->setChecked(systemMode==MODE_DENDY);
+      nesSetSystemMode(systemMode);
+   }
 
-      cartridge->setNumChrRomBanks(numChrRomBanks);
-
-      cartridge->setSaveStateFile(fileInfo.completeBaseName()+".sav");
+   // PRG-ROM and CHR-ROM are 8KB banks as far as the emulator is concerned.
+   // The trainer, if any, is skipped.
+   cartridge->setPrgRom(cartridge->getImage()+header.prgRomOffset,header.prgRomSize/MEM_8KB);
+   cartridge->setChrRom(cartridge->getImage()+header.chrRomOffset,header.chrRomSize/MEM_8KB);
 
-      fileIn.close();
-   }
+   cartridge->setSaveStateFile(fileInfo.completeBaseName()+".sav");
 }
 
 void MainWindow::on_actionOpen_triggered()
@@ -337,7 +278,8 @@ void MainWindow::on_actionOpen_triggered()
    QFileInfo fileInfo(fileName);
    QDir::setCurrent(fileInfo.path());
 
-   emit pauseEmulation(false);
+   // Stop the emulator before the old cartridge image is unmapped.
+   m_pNESEmulatorThread->stopEmulation();
 
    loadCartridge(fileName);
 
@@ -400,7 +342,8 @@ void MainWindow::dropEvent(QDropEvent* event)
          QFileInfo fileInfo(fileName);
          QDir::setCurrent(fileInfo.path());
 
-         emit pauseEmulation(false);
+         // Stop the emulator before the old cartridge image is unmapped.
+         m_pNESEmulatorThread->stopEmulation();
 
          loadCartridge(fileName);
 
@@ -2,11 +2,62 @@
 
 CCartridge::CCartridge()
 {
+   m_pImage = NULL;
+   m_imageSize = 0;
+   m_numPrgBanks = 0;
+   m_pPrgRom = NULL;
+   m_numChrBanks = 0;
+   m_pChrRom = NULL;
    m_mirrorMode = HorizontalMirroring;
    m_mapperNumber = 0;
+   m_submapperNumber = 0;
    m_hasBatteryBackedRam = false;
+   m_fourScreen = false;
+   m_prgRamSize = 0;
+   m_timing = NES2_TIMING_NTSC;
 }
 
 CCartridge::~CCartridge()
 {
+   closeImage();
+}
+
+bool CCartridge::openImage(QString fileName)
+{
+   closeImage();
+
+   m_imageFile.setFileName(fileName);
+   if ( !m_imageFile.open(QIODevice::ReadOnly) )
+   {
+      return false;
+   }
+
+   m_imageSize = m_imageFile.size();
+   m_pImage = m_imageFile.map(0,m_imageSize);
+
+   // Fall back to reading the file if it can't be mapped.
+   if ( !m_pImage )
+   {
+      m_imageData = m_imageFile.readAll();
+      m_imageFile.close();
+      m_pImage = (uint8_t*)m_imageData.data();
+   }
+
+   return true;
+}
+
+void CCartridge::closeImage()
+{
+   // Closing the file also unmaps it.
+   if ( m_imageFile.isOpen() )
+   {
+      m_imageFile.close();
+   }
+   m_imageData.clear();
+   m_pImage = NULL;
+   m_imageSize = 0;
+   m_pPrgRom = NULL;
+   m_numPrgBanks = 0;
+   m_pChrRom = NULL;
+   m_numChrBanks = 0;
 }
@@ -2,6 +2,8 @@
 #define CCARTRIDGE_H
 
 #include <QString>
+#include <QFile>
+#include <QByteArray>
 
 #include "nes_emulator_core.h"
 
@@ -17,6 +19,19 @@ public:
    CCartridge();
    virtual ~CCartridge();
 
+   // ROM image access.  The image is memory-mapped read-only so that
+   // every emulator instance running the same ROM shares its pages.
+   bool openImage(QString fileName);
+   void closeImage();
+   uint8_t* getImage()
+   {
+      return m_pImage;
+   }
+   uint32_t getImageSize()
+   {
+      return m_imageSize;
+   }
+
    // Member Getters
    eMirrorMode getMirrorMode()
    {
@@ -26,6 +41,10 @@ public:
    {
       return m_mapperNumber;
    }
+   int getSubmapperNumber()
+   {
+      return m_submapperNumber;
+   }
    bool isBatteryBackedRam()
    {
       return m_hasBatteryBackedRam;
@@ -38,9 +57,13 @@ public:
    {
       return m_numPrgBanks;
    }
+   uint8_t* getPrgRom()
+   {
+      return m_pPrgRom;
+   }
    char* getPointerToPrgRomBank(int bank)
    {
-      return m_prgBank[bank];
+      return (char*)m_pPrgRom+(bank*MEM_8KB);
    }
    int getNumChrRomBanks()
    {
@@ -48,7 +71,15 @@ public:
    }
    char* getPointerToChrRomBank(int bank)
    {
-      return m_chrBank[bank];
+      return (char*)m_pChrRom+(bank*MEM_8KB);
+   }
+   uint32_t getPrgRamSize()
+   {
+      return m_prgRamSize;
+   }
+   int getTiming()
+   {
+      return m_timing;
    }
    QString getSaveStateFile()
    {
@@ -56,13 +87,15 @@ public:
    }
 
    // Member Setters
-   void setNumChrRomBanks(int banks)
+   void setPrgRom(uint8_t* prgRom,int banks)
    {
-      m_numChrBanks = banks;
+      m_pPrgRom = prgRom;
+      m_numPrgBanks = banks;
    }
-   void setNumPrgRomBanks(int banks)
+   void setChrRom(uint8_t* chrRom,int banks)
    {
-      m_numPrgBanks = banks;
+      m_pChrRom = chrRom;
+      m_numChrBanks = banks;
    }
    void setMirrorMode(eMirrorMode mirrorMode)
    {
@@ -72,6 +105,10 @@ public:
    {
       m_mapperNumber = mapperNumber;
    }
+   void setSubmapperNumber(int submapperNumber)
+   {
+      m_submapperNumber = submapperNumber;
+   }
    void setBatteryBackedRam(bool batteryBackedRam)
    {
       m_hasBatteryBackedRam = batteryBackedRam;
@@ -80,20 +117,35 @@ public:
    {
       m_fourScreen = fourScreen;
    }
+   void setPrgRamSize(uint32_t size)
+   {
+      m_prgRamSize = size;
+   }
+   void setTiming(int timing)
+   {
+      m_timing = timing;
+   }
    void setSaveStateFile(QString file)
    {
       saveStateFile = file;
    }
 
 private:
+   QFile m_imageFile;
+   QByteArray m_imageData;                        // Only used if the ROM file can't be mapped
+   uint8_t* m_pImage;
+   uint32_t m_imageSize;
    int m_numPrgBanks;
-   char m_prgBank [ NUM_ROM_BANKS ][ MEM_8KB ];
+   uint8_t* m_pPrgRom;                            // Points into the ROM image
    int m_numChrBanks;
-   char m_chrBank [ NUM_ROM_BANKS ][ MEM_8KB ];
+   uint8_t* m_pChrRom;                            // Points into the ROM image
    eMirrorMode m_mirrorMode;                      // Mirror mode used in the emulator
    bool m_hasBatteryBackedRam;                        // Memory can be saved via RAM kept valid with a battery
    bool m_fourScreen;
    int  m_mapperNumber;                              // Numeric ID of the cartridge mapper
+   int  m_submapperNumber;                           // NES 2.0 submapper
+   uint32_t m_prgRamSize;                            // PRG-RAM plus PRG-NVRAM in bytes, 0 if unknown
+   int  m_timing;                                    // NES 2.0 CPU/PPU timing mode
    QString saveStateFile;
 };
 
@@ -0,0 +1,479 @@
+#include <QCoreApplication>
+#include <QStringList>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QFile>
+#include <QDir>
+#include <QTextStream>
+#include <QCryptographicHash>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "nes_emulator_core.h"
+
+#include "cnesmovie.h"
+
+// Runs a suite of ROMs headlessly for a fixed number of frames each and
+// reports the emulator core's throughput as JSON so results can be diffed
+// across commits.
+//
+// nesbench [-frames N] [-counters] [-debug] [-pal] [-romdir DIR]
+//          [-suite FILE] [-o FILE] [rom.nes ...]
+//
+// A single ROM can also be run from, or recorded to, a movie:
+// nesbench -movie FILE [-seek N] rom.nes
+// nesbench -record FILE [-frames N] rom.nes
+// With -seek the movie is positioned at frame N before the timed run
+// plays the rest of it; the seek itself is reported separately.
+
+#define DEFAULT_FRAMES 600
+
+typedef struct _BenchResult
+{
+   QString     rom;
+   QString     error;
+   uint32_t    mapper;
+   uint32_t    frames;
+   qint64      nsecs;
+   uint64_t    cpuCycles;
+   uint64_t    ppuDots;
+   qint64      seekNsecs;
+   NESCounters counters;
+} BenchResult;
+
+// Movie to play back or record, if any.
+typedef struct _BenchMovie
+{
+   QString   fileName;
+   bool      record;
+   uint32_t  seekFrame;
+   CNESMovie movie;
+} BenchMovie;
+
+// Audio is consumed as fast as it is produced.
+static void audioHook ( void )
+{
+   nesClearAudioSamplesAvailable();
+}
+
+static QString jsonString ( QString str )
+{
+   str.replace("\\","\\\\");
+   str.replace("\"","\\\"");
+   return "\""+str+"\"";
+}
+
+static QString jsonDouble ( double value )
+{
+   return QString::number(value,'f',3);
+}
+
+static QByteArray romHash ( const QByteArray& image, const NESROMHeader& header )
+{
+   QCryptographicHash sha1(QCryptographicHash::Sha1);
+
+   sha1.addData(image.constData()+header.prgRomOffset,header.prgRomSize);
+   sha1.addData(image.constData()+header.chrRomOffset,header.chrRomSize);
+   return sha1.result();
+}
+
+static bool runRom ( QString fileName, uint32_t frames, BenchMovie* movie, BenchResult* result )
+{
+   QFile        file(fileName);
+   QByteArray   image;
+   NESROMHeader header;
+   uint32_t     joy [ NUM_CONTROLLERS ] = { 0, 0 };
+   uint32_t     frame;
+   uint32_t     cpuCycle;
+   uint32_t     b;
+   QElapsedTimer timer;
+
+   result->rom = fileName;
+   result->mapper = 0;
+   result->frames = 0;
+   result->nsecs = 0;
+   result->cpuCycles = 0;
+   result->ppuDots = 0;
+   result->seekNsecs = 0;
+   memset(&result->counters,0,sizeof(result->counters));
+
+   if ( !file.open(QIODevice::ReadOnly) )
+   {
+      result->error = "not found";
+      return false;
+   }
+   image = file.readAll();
+   file.close();
+
+   if ( !nesParseROMHeader((uint8_t*)image.data(),image.size(),&header) )
+   {
+      result->error = "invalid ROM format";
+      return false;
+   }
+   result->mapper = header.mapper;
+
+   // Load the cartridge the same way the emulator front ends do.
+   nesUnloadROM();
+   nesLoadPRGROM((uint8_t*)image.data()+header.prgRomOffset,header.prgRomSize/MEM_8KB);
+   for ( b = 0; b < header.chrRomSize/MEM_8KB; b++ )
+   {
+      nesLoadCHRROMBank(b,(uint8_t*)image.data()+header.chrRomOffset+(b*MEM_8KB));
+   }
+   nesSetSubmapper(header.submapper);
+   nesSetPRGRAMSize(header.prgRamSize+header.prgNvramSize);
+   nesLoadROM();
+   if ( header.verticalMirroring )
+   {
+      nesSetVerticalMirroring();
+   }
+   else
+   {
+      nesSetHorizontalMirroring();
+   }
+   if ( header.fourScreen )
+   {
+      nesSetFourScreen();
+   }
+   if ( !nesResetInitial(header.mapper) )
+   {
+      result->error = "unsupported mapper";
+      return false;
+   }
+   nesSetInputPlayback(false);
+   nesSetInputRecording(false);
+   nesResetCounters();
+
+   frame = 0;
+   if ( movie && movie->record )
+   {
+      movie->movie.startRecording(romHash(image,header));
+   }
+   else if ( movie )
+   {
+      if ( movie->movie.romHash() != romHash(image,header) )
+      {
+         fprintf(stderr,"nesbench: movie %s was not recorded with %s, replaying from reset\n",
+                 movie->fileName.toLatin1().constData(),
+                 fileName.toLatin1().constData());
+         movie->movie.discardKeyframes();
+      }
+      if ( !movie->movie.keyframesUsable() )
+      {
+         fprintf(stderr,"nesbench: movie %s keyframes are from emulator version %s, replaying from reset\n",
+                 movie->fileName.toLatin1().constData(),
+                 movie->movie.emulatorVersion().constData());
+      }
+
+      // The movie decides how long the run is.
+      frames = movie->movie.frames();
+      if ( movie->seekFrame > frames )
+      {
+         movie->seekFrame = frames;
+      }
+      timer.start();
+      movie->movie.seek(movie->seekFrame);
+      result->seekNsecs = timer.nsecsElapsed();
+      frame = movie->seekFrame;
+      nesResetCounters();
+   }
+
+   cpuCycle = nesGetCPUCycle();
+
+   result->frames = frames-frame;
+   timer.start();
+   for ( ; frame < frames; frame++ )
+   {
+      if ( movie && movie->record )
+      {
+         movie->movie.recordFrame(joy);
+      }
+      else if ( movie )
+      {
+         movie->movie.getFrameInput(frame,joy);
+      }
+      nesRun(joy);
+
+      // PPU cycles restart every frame.
+      result->ppuDots += nesGetPPUCycle();
+   }
+   result->nsecs = timer.nsecsElapsed();
+
+   result->cpuCycles = nesGetCPUCycle()-cpuCycle;
+   nesGetCounters(&result->counters);
+
+   // The image goes away with this function.
+   nesUnloadROM();
+   return true;
+}
+
+static QStringList readSuite ( QString suiteFileName, QString romDir, QList<uint32_t>& frames, uint32_t defaultFrames )
+{
+   QFile       suite(suiteFileName);
+   QStringList roms;
+
+   if ( !suite.open(QIODevice::ReadOnly|QIODevice::Text) )
+   {
+      return roms;
+   }
+
+   QTextStream in(&suite);
+   while ( !in.atEnd() )
+   {
+      QString line = in.readLine().trimmed();
+      if ( line.isEmpty() || line.startsWith("#") )
+      {
+         continue;
+      }
+
+      QStringList fields = line.split(QRegExp("\\s+"));
+      roms.append(QDir(romDir).filePath(fields.at(0)));
+      if ( fields.count() > 1 )
+      {
+         frames.append(fields.at(1).toUInt());
+      }
+      else
+      {
+         frames.append(defaultFrames);
+      }
+   }
+   return roms;
+}
+
+static void writeResult ( QTextStream& out, BenchResult* result, bool counters, bool last )
+{
+   double seconds = result->nsecs/1000000000.0;
+
+   out << "    {\n";
+   out << "      \"rom\": " << jsonString(result->rom) << ",\n";
+   if ( !result->error.isEmpty() )
+   {
+      out << "      \"skipped\": " << jsonString(result->error) << "\n";
+      out << "    }" << (last?"":",") << "\n";
+      return;
+   }
+   out << "      \"mapper\": " << result->mapper << ",\n";
+   out << "      \"frames\": " << result->frames << ",\n";
+   if ( result->seekNsecs )
+   {
+      out << "      \"seekSeconds\": " << QString::number(result->seekNsecs/1000000000.0,'f',6) << ",\n";
+   }
+   out << "      \"seconds\": " << QString::number(seconds,'f',6) << ",\n";
+   out << "      \"fps\": " << jsonDouble(seconds?(result->frames/seconds):0.0) << ",\n";
+   out << "      \"cpuCycles\": " << result->cpuCycles << ",\n";
+   out << "      \"ppuDots\": " << result->ppuDots << ",\n";
+   out << "      \"nsPerCpuCycle\": " << jsonDouble(result->cpuCycles?((double)result->nsecs/result->cpuCycles):0.0) << ",\n";
+   out << "      \"nsPerPpuDot\": " << jsonDouble(result->ppuDots?((double)result->nsecs/result->ppuDots):0.0);
+   if ( counters )
+   {
+      out << ",\n";
+      out << "      \"counters\": {\n";
+      out << "        \"mapperCalls\": " << result->counters.mapperCalls << ",\n";
+      out << "        \"breakpointChecks\": " << result->counters.breakpointChecks << ",\n";
+      out << "        \"tracerSamples\": " << result->counters.tracerSamples << ",\n";
+      out << "        \"apuSamples\": " << result->counters.apuSamples << "\n";
+      out << "      }";
+   }
+   out << "\n    }" << (last?"":",") << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+   QCoreApplication app(argc, argv);
+   QStringList      args = app.arguments();
+   QStringList      roms;
+   QList<uint32_t>  frames;
+   QList<BenchResult> results;
+   QString          suiteFileName = QFileInfo(app.applicationDirPath(),"suite.txt").filePath();
+   QString          romDir = ".";
+   QString          outFileName;
+   uint32_t         defaultFrames = DEFAULT_FRAMES;
+   bool             counters = false;
+   bool             debug = false;
+   uint32_t         systemMode = MODE_NTSC;
+   BenchMovie       movie;
+   QString          errors;
+   int              idx;
+
+   movie.record = false;
+   movie.seekFrame = 0;
+
+   for ( idx = 1; idx < args.count(); idx++ )
+   {
+      if ( (args.at(idx) == "-frames") && (idx+1 < args.count()) )
+      {
+         defaultFrames = args.at(++idx).toUInt();
+      }
+      else if ( args.at(idx) == "-counters" )
+      {
+         counters = true;
+      }
+      else if ( args.at(idx) == "-debug" )
+      {
+         debug = true;
+      }
+      else if ( args.at(idx) == "-pal" )
+      {
+         systemMode = MODE_PAL;
+      }
+      else if ( (args.at(idx) == "-romdir") && (idx+1 < args.count()) )
+      {
+         romDir = args.at(++idx);
+      }
+      else if ( (args.at(idx) == "-suite") && (idx+1 < args.count()) )
+      {
+         suiteFileName = args.at(++idx);
+      }
+      else if ( (args.at(idx) == "-o") && (idx+1 < args.count()) )
+      {
+         outFileName = args.at(++idx);
+      }
+      else if ( (args.at(idx) == "-movie") && (idx+1 < args.count()) )
+      {
+         movie.fileName = args.at(++idx);
+         movie.record = false;
+      }
+      else if ( (args.at(idx) == "-record") && (idx+1 < args.count()) )
+      {
+         movie.fileName = args.at(++idx);
+         movie.record = true;
+      }
+      else if ( (args.at(idx) == "-seek") && (idx+1 < args.count()) )
+      {
+         movie.seekFrame = args.at(++idx).toUInt();
+      }
+      else if ( args.at(idx).startsWith("-") )
+      {
+         fprintf(stderr,"usage: nesbench [-frames N] [-counters] [-debug] [-pal] [-romdir DIR] [-suite FILE] [-o FILE] [rom.nes ...]\n");
+         fprintf(stderr,"       nesbench -movie FILE [-seek N] rom.nes\n");
+         fprintf(stderr,"       nesbench -record FILE [-frames N] rom.nes\n");
+         return 1;
+      }
+      else
+      {
+         roms.append(args.at(idx));
+         frames.append(0);
+      }
+   }
+
+   // A movie belongs to exactly one ROM.
+   if ( (!movie.fileName.isEmpty()) && (roms.count() != 1) )
+   {
+      fprintf(stderr,"nesbench: -movie and -record need exactly one ROM\n");
+      return 1;
+   }
+   if ( (!movie.fileName.isEmpty()) && (!movie.record) )
+   {
+      if ( !movie.movie.load(movie.fileName,errors) )
+      {
+         fprintf(stderr,"nesbench: %s\n",errors.toLatin1().constData());
+         return 1;
+      }
+      systemMode = movie.movie.systemMode();
+   }
+
+   // ROMs named on the command line replace the suite.
+   if ( roms.isEmpty() )
+   {
+      roms = readSuite(suiteFileName,romDir,frames,defaultFrames);
+      if ( roms.isEmpty() )
+      {
+         fprintf(stderr,"nesbench: no ROMs to run (suite %s)\n",suiteFileName.toLatin1().constData());
+         return 1;
+      }
+   }
+   for ( idx = 0; idx < frames.count(); idx++ )
+   {
+      if ( !frames.at(idx) )
+      {
+         frames[idx] = defaultFrames;
+      }
+   }
+
+   // Debug mode exercises the breakpoint checks and tracer the IDE pays for.
+   if ( debug )
+   {
+      nesEnableDebug();
+   }
+   else
+   {
+      nesDisableDebug();
+   }
+   nesEnableCounters(counters);
+   nesSetSystemMode(systemMode);
+   nesSetAudioHook(audioHook);
+
+   for ( idx = 0; idx < roms.count(); idx++ )
+   {
+      BenchResult result;
+
+      if ( !runRom(roms.at(idx),frames.at(idx),movie.fileName.isEmpty()?NULL:&movie,&result) )
+      {
+         fprintf(stderr,"nesbench: skipped %s: %s\n",
+                 roms.at(idx).toLatin1().constData(),
+                 result.error.toLatin1().constData());
+      }
+      results.append(result);
+   }
+
+   if ( movie.record && results.at(0).error.isEmpty() )
+   {
+      if ( !movie.movie.save(movie.fileName) )
+      {
+         fprintf(stderr,"nesbench: cannot write %s\n",movie.fileName.toLatin1().constData());
+         return 1;
+      }
+   }
+
+   // Emit results.
+   QFile outFile(outFileName);
+   if ( outFileName.isEmpty() )
+   {
+      outFile.open(stdout,QIODevice::WriteOnly|QIODevice::Text);
+   }
+   else if ( !outFile.open(QIODevice::WriteOnly|QIODevice::Text) )
+   {
+      fprintf(stderr,"nesbench: cannot write %s\n",outFileName.toLatin1().constData());
+      return 1;
+   }
+
+   BenchResult total;
+   total.frames = 0;
+   total.nsecs = 0;
+   total.cpuCycles = 0;
+   total.ppuDots = 0;
+   for ( idx = 0; idx < results.count(); idx++ )
+   {
+      if ( results.at(idx).error.isEmpty() )
+      {
+         total.frames += results.at(idx).frames;
+         total.nsecs += results.at(idx).nsecs;
+         total.cpuCycles += results.at(idx).cpuCycles;
+         total.ppuDots += results.at(idx).ppuDots;
+      }
+   }
+   double seconds = total.nsecs/1000000000.0;
+
+   QTextStream out(&outFile);
+   out << "{\n";
+   out << "  \"version\": " << jsonString(nesGetVersion()) << ",\n";
+   out << "  \"systemMode\": " << jsonString((systemMode==MODE_PAL)?"PAL":"NTSC") << ",\n";
+   out << "  \"debug\": " << (debug?"true":"false") << ",\n";
+   out << "  \"counters\": " << (counters?"true":"false") << ",\n";
+   out << "  \"roms\": [\n";
+   for ( idx = 0; idx < results.count(); idx++ )
+   {
+      writeResult(out,&results[idx],counters,idx == results.count()-1);
+   }
+   out << "  ],\n";
+   out << "  \"total\": {\n";
+   out << "    \"frames\": " << total.frames << ",\n";
+   out << "    \"seconds\": " << QString::number(seconds,'f',6) << ",\n";
+   out << "    \"fps\": " << jsonDouble(seconds?(total.frames/seconds):0.0) << ",\n";
+   out << "    \"nsPerCpuCycle\": " << jsonDouble(total.cpuCycles?((double)total.nsecs/total.cpuCycles):0.0) << ",\n";
+   out << "    \"nsPerPpuDot\": " << jsonDouble(total.ppuDots?((double)total.nsecs/total.ppuDots):0.0) << "\n";
+   out << "  }\n";
+   out << "}\n";
+
+   return 0;
+}
@@ -0,0 +1,62 @@
+QT = core
+
+TOP = ../..
+
+TARGET = nesbench
+TEMPLATE = app
+
+CONFIG += console
+CONFIG -= app_bundle
+
+# Remove crap we do not need!
+CONFIG -= rtti exceptions
+
+isEmpty (NESICIDE_LIBS) {
+   NESICIDE_LIBS = -lnes-emulator
+}
+
+win32 {
+   NESICIDE_CXXFLAGS = -I$$TOP/libs/nes -I$$TOP/libs/nes/emulator -I$$TOP/libs/nes/common
+
+   CONFIG(release, debug|release) {
+      NESICIDE_LIBS = -L$$TOP/libs/nes/release -lnes-emulator
+   } else {
+      NESICIDE_LIBS = -L$$TOP/libs/nes/debug -lnes-emulator
+   }
+}
+
+mac {
+   CONFIG(release, debug|release) {
+      DESTDIR = release
+      OBJECTS_DIR = release
+      BUILD_DIR = release
+   } else {
+      DESTDIR = debug
+      OBJECTS_DIR = debug
+      BUILD_DIR = debug
+   }
+
+   NESICIDE_CXXFLAGS = -I $$TOP/libs/nes -I $$TOP/libs/nes/emulator -I $$TOP/libs/nes/common
+   NESICIDE_LIBS = -L$$TOP/libs/nes/$$BUILD_DIR -lnes-emulator
+}
+
+unix:!mac {
+   NESICIDE_CXXFLAGS = -I $$TOP/libs/nes -I $$TOP/libs/nes/emulator -I $$TOP/libs/nes/common
+   NESICIDE_LIBS = -L$$TOP/libs/nes -lnes-emulator
+}
+
+QMAKE_CXXFLAGS += $$NESICIDE_CXXFLAGS
+LIBS += $$NESICIDE_LIBS
+
+INCLUDEPATH += \
+   $$TOP/common
+
+SOURCES += \
+   main.cpp \
+   $$TOP/common/cnesmovie.cpp
+
+HEADERS += \
+   $$TOP/common/cnesmovie.h
+
+OTHER_FILES += \
+   suite.txt
@@ -0,0 +1,203 @@
+#include "cnesmovie.h"
+
+#include <QDataStream>
+#include <QFile>
+
+#include "nes_emulator_core.h"
+
+CNESMovie::CNESMovie()
+{
+   clear();
+}
+
+void CNESMovie::clear()
+{
+   m_emulatorVersion = nesGetVersion();
+   m_romHash.clear();
+   m_systemMode = nesGetSystemMode();
+   m_keyframeInterval = NESMOVIE_DEFAULT_KEYFRAME_INTERVAL;
+   m_input.clear();
+   m_keyframes.clear();
+}
+
+void CNESMovie::startRecording(const QByteArray& romHash,uint32_t keyframeInterval)
+{
+   clear();
+   m_romHash = romHash;
+   if ( keyframeInterval )
+   {
+      m_keyframeInterval = keyframeInterval;
+   }
+}
+
+void CNESMovie::recordFrame(const uint32_t* joy)
+{
+   uint32_t frame = frames();
+   QByteArray state;
+
+   // Keyframes are taken before the frame's input is applied so seeking
+   // to a keyframe needs no replay at all.
+   if ( !(frame%m_keyframeInterval) )
+   {
+      state.resize(nesSaveState(NULL,0));
+      if ( nesSaveState((uint8_t*)state.data(),state.size()) )
+      {
+         m_keyframes.insert(frame,qCompress(state));
+      }
+   }
+
+   m_input.append(joy[CONTROLLER1]);
+   m_input.append(joy[CONTROLLER2]);
+}
+
+bool CNESMovie::getFrameInput(uint32_t frame,uint32_t* joy) const
+{
+   if ( frame >= frames() )
+   {
+      return false;
+   }
+   joy[CONTROLLER1] = m_input.at((frame*NUM_MOVIE_PORTS)+CONTROLLER1);
+   joy[CONTROLLER2] = m_input.at((frame*NUM_MOVIE_PORTS)+CONTROLLER2);
+   return true;
+}
+
+bool CNESMovie::keyframesUsable() const
+{
+   return (m_emulatorVersion == QByteArray(nesGetVersion())) &&
+          (m_systemMode == nesGetSystemMode());
+}
+
+bool CNESMovie::seek(uint32_t frame)
+{
+   QMap<uint32_t,QByteArray>::const_iterator keyframe;
+   QByteArray state;
+   uint32_t joy [ NUM_CONTROLLERS ];
+   uint32_t from = 0;
+   bool     restored = false;
+
+   if ( frame > frames() )
+   {
+      return false;
+   }
+
+   // Restore the nearest keyframe at or before the frame.
+   if ( keyframesUsable() )
+   {
+      keyframe = m_keyframes.upperBound(frame);
+      while ( (!restored) && (keyframe != m_keyframes.constBegin()) )
+      {
+         keyframe--;
+         state = qUncompress(keyframe.value());
+         restored = nesLoadState((uint8_t*)state.data(),state.size());
+         from = keyframe.key();
+      }
+   }
+   if ( !restored )
+   {
+      nesReset(false);
+      from = 0;
+   }
+
+   // Replay only the gap.
+   for ( ; from < frame; from++ )
+   {
+      getFrameInput(from,joy);
+      nesRun(joy);
+   }
+   return true;
+}
+
+bool CNESMovie::save(const QString& fileName) const
+{
+   QFile file(fileName);
+   QMap<uint32_t,QByteArray>::const_iterator keyframe;
+   int idx;
+
+   if ( !file.open(QIODevice::WriteOnly) )
+   {
+      return false;
+   }
+
+   QDataStream out(&file);
+   out.setByteOrder(QDataStream::LittleEndian);
+   out << (quint32)NESMOVIE_MAGIC;
+   out << (quint32)NESMOVIE_VERSION;
+   out << m_emulatorVersion;
+   out << m_romHash;
+   out << (quint32)m_systemMode;
+   out << (quint32)m_keyframeInterval;
+   out << (quint32)frames();
+   out << (quint32)m_keyframes.count();
+   for ( idx = 0; idx < m_input.count(); idx++ )
+   {
+      out << (quint16)m_input.at(idx);
+   }
+   for ( keyframe = m_keyframes.constBegin(); keyframe != m_keyframes.constEnd(); keyframe++ )
+   {
+      out << (quint32)keyframe.key();
+      out << keyframe.value();
+   }
+
+   return out.status() == QDataStream::Ok;
+}
+
+bool CNESMovie::load(const QString& fileName,QString& errors)
+{
+   QFile file(fileName);
+   quint32 magic;
+   quint32 version;
+   quint32 systemMode;
+   quint32 keyframeInterval;
+   quint32 numFrames;
+   quint32 numKeyframes;
+   quint32 frame;
+   quint16 input;
+   QByteArray state;
+   quint32 idx;
+
+   clear();
+
+   if ( !file.open(QIODevice::ReadOnly) )
+   {
+      errors = "Cannot open movie file "+fileName+".";
+      return false;
+   }
+
+   QDataStream in(&file);
+   in.setByteOrder(QDataStream::LittleEndian);
+   in >> magic >> version;
+   if ( (magic != NESMOVIE_MAGIC) || (version != NESMOVIE_VERSION) )
+   {
+      errors = fileName+" is not a movie file or is from a newer version.";
+      return false;
+   }
+   in >> m_emulatorVersion >> m_romHash;
+   in >> systemMode >> keyframeInterval >> numFrames >> numKeyframes;
+   if ( in.status() != QDataStream::Ok )
+   {
+      errors = fileName+" is truncated.";
+      clear();
+      return false;
+   }
+   m_systemMode = systemMode;
+   m_keyframeInterval = keyframeInterval?keyframeInterval:NESMOVIE_DEFAULT_KEYFRAME_INTERVAL;
+
+   for ( idx = 0; (idx < numFrames*NUM_MOVIE_PORTS) && (in.status() == QDataStream::Ok); idx++ )
+   {
+      in >> input;
+      m_input.append(input);
+   }
+   for ( idx = 0; (idx < numKeyframes) && (in.status() == QDataStream::Ok); idx++ )
+   {
+      in >> frame >> state;
+      m_keyframes.insert(frame,state);
+   }
+   if ( in.status() != QDataStream::Ok )
+   {
+      errors = fileName+" is truncated.";
+      clear();
+      return false;
+   }
+
+   return true;
+}
@@ -0,0 +1,98 @@
+#ifndef CNESMOVIE_H
+#define CNESMOVIE_H
+
+#include <QByteArray>
+#include <QMap>
+#include <QString>
+#include <QVector>
+
+#include <stdint.h>
+
+// A movie is a recording of the joypad input for each frame of an
+// emulation run that started from a NES reset.  Playing the input back
+// reproduces the run exactly.  Every so many frames the recording also
+// embeds a snapshot of the whole NES (a keyframe) so that seeking only
+// has to restore the nearest keyframe and replay the frames after it.
+//
+// The file is laid out as (all values little-endian):
+//    uint32_t magic, version
+//    QByteArray emulator version, ROM hash
+//    uint32_t system mode, keyframe interval, frames, keyframes
+//    uint16_t input[frames][NUM_CONTROLLERS]
+//    { uint32_t frame, QByteArray compressed snapshot }[keyframes]
+//
+// The ROM hash is the SHA1 of the PRG-ROM followed by the CHR-ROM.
+// Keyframes are raw emulator snapshots so they are ignored if the movie
+// was recorded by a different emulator version; seeking then replays the
+// input from reset instead.
+#define NESMOVIE_MAGIC   0x564F4D4E // 'NMOV'
+#define NESMOVIE_VERSION 1
+#define NESMOVIE_DEFAULT_KEYFRAME_INTERVAL 600
+
+class CNESMovie
+{
+public:
+   CNESMovie();
+
+   void clear();
+
+   // Recording.  The NES must have just been reset when recording starts.
+   // recordFrame must be called with each frame's input just before the
+   // frame is run.
+   void startRecording(const QByteArray& romHash,uint32_t keyframeInterval = NESMOVIE_DEFAULT_KEYFRAME_INTERVAL);
+   void recordFrame(const uint32_t* joy);
+
+   // Playback.  getFrameInput returns false past the end of the movie.
+   // seek leaves the NES ready to run the given frame.
+   bool getFrameInput(uint32_t frame,uint32_t* joy) const;
+   bool seek(uint32_t frame);
+
+   // File interfaces.
+   bool save(const QString& fileName) const;
+   bool load(const QString& fileName,QString& errors);
+
+   // Movie information.
+   uint32_t frames() const
+   {
+      return m_input.count()/NUM_MOVIE_PORTS;
+   }
+   const QByteArray& romHash() const
+   {
+      return m_romHash;
+   }
+   const QByteArray& emulatorVersion() const
+   {
+      return m_emulatorVersion;
+   }
+   uint32_t systemMode() const
+   {
+      return m_systemMode;
+   }
+   bool keyframesUsable() const;
+
+   // Keyframes from a movie recorded with a different ROM must not be
+   // restored; seeking then replays the input from reset instead.
+   void discardKeyframes()
+   {
+      m_keyframes.clear();
+   }
+
+protected:
+   enum
+   {
+      NUM_MOVIE_PORTS = 2
+   };
+
+   QByteArray m_emulatorVersion;
+   QByteArray m_romHash;
+   uint32_t   m_systemMode;
+   uint32_t   m_keyframeInterval;
+
+   // Two ports' input per frame.
+   QVector<uint16_t> m_input;
+
+   // Compressed snapshots keyed by the frame they were taken before.
+   QMap<uint32_t,QByteArray> m_keyframes;
+};
+
+#endif // CNESMOVIE_H
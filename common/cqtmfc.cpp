@@ -6,6 +6,7 @@
 #include <QLinearGradient>
 #include <QHeaderView>
 #include <QMessageBox>
+#include <QApplication>
 #include <QPixmap>
 #include <QMainWindow>
 #include <QFileInfo>
@@ -70,6 +71,13 @@ CMenu* qtMfcMenuResource(int id)
    return qtMfcMenuResources.value(id);
 }
 
+// Command line tools run without a QApplication, there are no widgets to show
+// message boxes in so the text goes to the console instead.
+static bool qtMfcHeadless()
+{
+   return !qobject_cast<QApplication*>(QCoreApplication::instance());
+}
+
 int AfxMessageBox(
    LPCTSTR lpszText,
    UINT nType,
@@ -81,6 +89,11 @@ int AfxMessageBox(
 #else
    QString text = lpszText;
 #endif
+   if ( qtMfcHeadless() )
+   {
+      qWarning("%s",qPrintable(text));
+      return QMessageBox::Ok;
+   }
    switch ( nType )
    {
    case MB_ICONERROR:
@@ -110,6 +123,11 @@ int AFXAPI AfxMessageBox(
 #else
    QString text = qtMfcStringResource(nIDPrompt);
 #endif
+   if ( qtMfcHeadless() )
+   {
+      qWarning("%s",qPrintable(text));
+      return QMessageBox::Ok;
+   }
    switch ( nType )
    {
    case MB_ICONERROR:
@@ -6884,6 +6902,23 @@ CProgressCtrl::~CProgressCtrl()
    _qt = NULL;
 }
 
+BOOL CProgressCtrl::Create(
+   DWORD dwStyle,
+   const RECT& rect,
+   CWnd* pParentWnd,
+   UINT nID 
+)
+{
+   m_hWnd = (HWND)this;
+   _id = nID;
+
+   _qtd->setGeometry(rect.left,rect.top,rect.right-rect.left,rect.bottom-rect.top);
+   _qtd->setVisible(dwStyle&WS_VISIBLE);
+   _qtd->setTextVisible(false);
+
+   return TRUE;
+}
+
 void CProgressCtrl::SetRange(
    short nLower,
    short nUpper 
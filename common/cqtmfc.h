@@ -2198,6 +2198,12 @@ protected:
 public:
    CProgressCtrl(CWnd* parent = 0);
    virtual ~CProgressCtrl();
+   virtual BOOL Create(
+      DWORD dwStyle,
+      const RECT& rect,
+      CWnd* pParentWnd,
+      UINT nID 
+   );
    void SetRange(
       short nLower,
       short nUpper 
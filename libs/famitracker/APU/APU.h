@@ -22,6 +22,10 @@
 #define _APU_H_
 
 #include <QObject>
+#include <QAtomicInt>
+#include <QSemaphore>
+#include <QThreadPool>
+#include <vector>
 
 //#define LOGGING
 
@@ -74,7 +78,7 @@ public:
 	
 	void	ChangeMachine(int Machine);
 	bool	SetupSound(int SampleRate, int NrChannels, int Speed);
-	void	SetupMixer(int LowCut, int HighCut, int HighDamp, int Volume) const;
+	void	SetupMixer(int LowCut, int HighCut, int HighDamp, int Volume);
 
 	int32	GetVol(uint8 Chan) const;
 	uint8	GetSamplePos() const;
@@ -85,11 +89,15 @@ public:
 	void	SetChipLevel(int Chip, int Level);
 
 	void	SetNamcoMixing(bool bLinear);
+	void	SetChannelPan(int Chan, int Pan);
 
 #ifdef LOGGING
 	void	Log();
 #endif
 
+	// Called by the chip render threads
+	void	RenderChipQueues();
+
 public:
 	static const uint8	LENGTH_TABLE[];
 	static const uint32	BASE_FREQ_NTSC;
@@ -110,6 +118,26 @@ private:
 		
 	void LogExternalWrite(uint16 Address, uint8 Value);
 
+	// Expansion chips are queued during the frame and rendered in parallel at frame end
+	struct stChipCommand {
+		uint8	Type;
+		uint8	Value;
+		uint16	Address;
+		uint32	Time;
+	};
+
+	struct stChipQueue {
+		CExternal		*pChip;
+		uint8			Chip;
+		std::vector<stChipCommand> Commands;
+		CMixerLog		Log;
+	};
+
+	void QueueChipCommand(uint8 Type, uint16 Address, uint8 Value, uint32 Time);
+	void RunChipQueue(stChipQueue &Queue);
+	void RenderChips();
+	void FlushChips();
+
 private:
 	CMixer		*m_pMixer;
 	ICallback	*m_pParent;
@@ -131,6 +159,12 @@ private:
 
 	uint8		m_iExternalSoundChip;				// External sound chip, if used
 
+	std::vector<stChipQueue> m_vExChips;			// Enabled expansion chips
+	bool		m_bParallelChips;					// Expansion chips are queued
+	QThreadPool	m_ChipThreads;
+	QAtomicInt	m_iNextChipQueue;					// Next queue to render
+	QSemaphore	m_ChipQueuesDone;
+
 	uint32		m_iFramePeriod;						// Cycles per frame
 	uint32		m_iFrameCycles;						// Cycles emulated from start of frame
 	uint32		m_iSequencerClock;						// Clock for frame sequencer
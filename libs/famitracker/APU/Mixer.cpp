@@ -58,10 +58,58 @@
 #include "emu2413.h"
 #include "emu2149.h"
 
-//#define LINEAR_MIXING
-
 static const double AMP_2A03 = 400.0;
 
+// The nonlinear outputs of the two APU pins are looked up in tables, indexed
+// in 1/32 steps of the pin input so that panned channels mix with integer
+// math. Pin 2 inputs are weighted relative to the DPCM channel, the weights
+// are rounded so the stereo pin 2 mix is a close approximation. Mono output
+// looks pin 2 up by the exact channel levels instead and is unchanged.
+static const int PIN_STEPS		= 32;
+static const int PIN_GAIN_SHIFT = 3;		// Pan gain (256) to pin steps (32)
+static const int PIN2_WEIGHT_T	= 88;		// 22638 / 8227 * 32
+static const int PIN2_WEIGHT_N	= 59;		// 22638 / 12241 * 32
+static const int PIN2_WEIGHT_D	= 32;
+
+static const int PIN1_SIZE = (15 + 15) * PIN_STEPS + 1;
+static const int PIN2_SIZE = 15 * PIN2_WEIGHT_T + 15 * PIN2_WEIGHT_N + 127 * PIN2_WEIGHT_D + 1;
+
+static int32 PIN1_TABLE[PIN1_SIZE];
+static int32 PIN2_TABLE[PIN2_SIZE];
+static int32 PIN2_MONO_TABLE[16 * 16 * 128];		// [Triangle][Noise][DPCM]
+
+// Filled once at load time, mixers on other threads only read the tables
+static class CPinTables {
+public:
+	CPinTables() {
+		PIN1_TABLE[0] = 0;
+		for (int i = 1; i < PIN1_SIZE; ++i)
+			PIN1_TABLE[i] = int32(95.88 / ((8128.0 * PIN_STEPS / i) + 100.0) * AMP_2A03 + 0.5);
+		PIN2_TABLE[0] = 0;
+		for (int i = 1; i < PIN2_SIZE; ++i)
+			PIN2_TABLE[i] = int32(159.79 / ((22638.0 * PIN_STEPS / i) + 100.0) * AMP_2A03 + 0.5);
+		for (int t = 0; t < 16; ++t) {
+			for (int n = 0; n < 16; ++n) {
+				for (int d = 0; d < 128; ++d) {
+					double Sum = 0;
+					if (t + n + d > 0)
+						Sum = 159.79 / ((1.0 / ((t / 8227.0) + (n / 12241.0) + (d / 22638.0))) + 100.0);
+					PIN2_MONO_TABLE[(t << 11) | (n << 7) | d] = int32(Sum * AMP_2A03 + 0.5);
+				}
+			}
+		}
+	}
+} PinTables;
+
+template <class T>
+static inline void OffsetStereo(T &Synth, int Time, const int32 *pDelta, Blip_Buffer *pLeft, Blip_Buffer *pRight)
+{
+	if (pDelta[0])
+		Synth.offset(Time, pDelta[0], pLeft);
+	if (pDelta[1])
+		Synth.offset(Time, pDelta[1], pRight);
+}
+
 static const float LEVEL_FALL_OFF_RATE	= 0.6f;
 static const int   LEVEL_FALL_OFF_DELAY = 3;
 
@@ -77,43 +125,78 @@ CMixer::CMixer()
 	m_fLevelFDS = 1.0f;
 
 	m_bNamcoMixing = false;
+	m_bNamcoMultiplexed = false;
+	m_bStereo = false;
+
+	for (int i = 0; i < CHANNELS; ++i)
+		SetChannelPan(i, PAN_CENTER);
+
+	memset(m_iLastOutput, 0, sizeof(m_iLastOutput));
+	memset(m_iLastNamcoOutput, 0, sizeof(m_iLastNamcoOutput));
+	memset(m_iLastSumSS, 0, sizeof(m_iLastSumSS));
+	memset(m_iLastSumTND, 0, sizeof(m_iLastSumTND));
+	memset(m_pChipLog, 0, sizeof(m_pChipLog));
 }
 
 CMixer::~CMixer()
 {
 }
 
-inline double CMixer::CalcPin1(double Val1, double Val2)
+void CMixer::ExternalSound(int Chip)
 {
-	// Mix the output of APU audio pin 1: square
-	//
-
-	if ((Val1 + Val2) > 0)
-		return 95.88 / ((8128.0 / (Val1 + Val2)) + 100.0);
+	m_iExternalChip = Chip;
+	UpdateSettings(m_iLowCut, m_iHighCut, m_iHighDamp, m_iOverallVol);
+}
 
-	return 0;
+void CMixer::SetNamcoMixing(bool bLinear)
+{
+	m_bNamcoMixing = bLinear;
 }
 
-inline double CMixer::CalcPin2(double Val1, double Val2, double Val3)
+void CMixer::SetNamcoMultiplexed(bool bMultiplexed)
 {
-	// Mix the output of APU audio pin 2: triangle, noise and DPCM
-	//
+	if (m_pChipLog[SNDCHIP_N163]) {
+		m_pChipLog[SNDCHIP_N163]->SetNamcoMultiplexed(bMultiplexed);
+		return;
+	}
 
-	if ((Val1 + Val2 + Val3) > 0)
-		return 159.79 / ((1.0 / ((Val1 / 8227.0) + (Val2 / 12241.0) + (Val3 / 22638.0))) + 100.0);
+	// When the N163 channels stop sharing the DAC each channel is mixed on
+	// its own again, starting from silence
+	if (m_bNamcoMultiplexed && !bMultiplexed) {
+		for (int i = CHANID_N163_CHAN1; i <= CHANID_N163_CHAN8; ++i)
+			m_iLastOutput[0][i] = m_iLastOutput[1][i] = 0;
+	}
 
-	return 0;
+	m_bNamcoMultiplexed = bMultiplexed;
 }
 
-void CMixer::ExternalSound(int Chip)
+bool CMixer::IsStereo() const
 {
-	m_iExternalChip = Chip;
-	UpdateSettings(m_iLowCut, m_iHighCut, m_iHighDamp, m_iOverallVol);
+	return m_bStereo;
 }
 
-void CMixer::SetNamcoMixing(bool bLinear)
+void CMixer::SetChannelPan(int ChanID, int Pan)
 {
-	m_bNamcoMixing = bLinear;
+	// Balance law, the center position plays both sides at full volume
+	// which matches the mono mix. Takes effect on the next output change.
+	if (Pan < PAN_LEFT)
+		Pan = PAN_LEFT;
+	if (Pan > PAN_RIGHT)
+		Pan = PAN_RIGHT;
+
+	m_iChannelPan[ChanID] = Pan;
+	m_iPanGain[0][ChanID] = (Pan > 0) ? (256 * (PAN_RIGHT - Pan)) / PAN_RIGHT : 256;
+	m_iPanGain[1][ChanID] = (Pan < 0) ? (256 * (Pan - PAN_LEFT)) / PAN_RIGHT : 256;
+}
+
+int CMixer::GetChannelPan(int ChanID) const
+{
+	return m_iChannelPan[ChanID];
+}
+
+int32 CMixer::GetPanGain(int Side, int ChanID) const
+{
+	return m_iPanGain[Side][ChanID];
 }
 
 void CMixer::SetChipLevel(int Chip, float Level)
@@ -155,6 +238,8 @@ void CMixer::UpdateSettings(int LowCut,	int HighCut, int HighDamp, int OverallVo
 
 	// Blip-buffer filtering
 	BlipBuffer.bass_freq(LowCut);
+	if (m_bStereo)
+		BlipBufferRight.bass_freq(LowCut);
 
 	blip_eq_t eq(-HighDamp, HighCut, m_iSampleRate);
 
@@ -196,17 +281,39 @@ void CMixer::UpdateSettings(int LowCut,	int HighCut, int HighDamp, int OverallVo
 
 void CMixer::SetNamcoVolume(float fVol)
 {
+	if (m_pChipLog[SNDCHIP_N163]) {
+		m_pChipLog[SNDCHIP_N163]->SetNamcoVolume(fVol);
+		return;
+	}
+
 	float fVolume = fVol * float(m_iOverallVol) / 100.0f;
 
 	SynthN163.volume(fVolume * 1.1f * (m_bNamcoMixing ? 0.8f : 1.0f));
 }
 
-void CMixer::MixSamples(blip_sample_t *pBuffer, uint32 Count)
+void CMixer::MixSamples(int Chip, const blip_sample_t *pBuffer, uint32 Count)
 {
-	// For VRC7
+	// For VRC7 and S5B
+	if (m_pChipLog[Chip]) {
+		m_pChipLog[Chip]->MixSamples(Chip, pBuffer, NULL, Count);
+		return;
+	}
+
 	BlipBuffer.mix_samples(pBuffer, Count);
 }
 
+void CMixer::MixSamplesStereo(int Chip, const blip_sample_t *pLeft, const blip_sample_t *pRight, uint32 Count)
+{
+	// For VRC7 and S5B in stereo
+	if (m_pChipLog[Chip]) {
+		m_pChipLog[Chip]->MixSamples(Chip, pLeft, pRight, Count);
+		return;
+	}
+
+	BlipBuffer.mix_samples(pLeft, Count);
+	BlipBufferRight.mix_samples(pRight, Count);
+}
+
 uint32 CMixer::GetMixSampleCount(int t) const
 {
 	return BlipBuffer.count_samples(t);
@@ -215,7 +322,10 @@ uint32 CMixer::GetMixSampleCount(int t) const
 bool CMixer::AllocateBuffer(unsigned int BufferLength, uint32 SampleRate, uint8 NrChannels)
 {
 	m_iSampleRate = SampleRate;
+	m_bStereo = (NrChannels == 2);
 	BlipBuffer.sample_rate(SampleRate, (BufferLength * 1000 * 2) / SampleRate);
+	if (m_bStereo)
+		BlipBufferRight.sample_rate(SampleRate, (BufferLength * 1000 * 2) / SampleRate);
 	return true;
 }
 
@@ -223,11 +333,15 @@ void CMixer::SetClockRate(uint32 Rate)
 {
 	// Change the clockrate
 	BlipBuffer.clock_rate(Rate);
+	if (m_bStereo)
+		BlipBufferRight.clock_rate(Rate);
 }
 
 void CMixer::ClearBuffer()
 {
 	BlipBuffer.clear();
+	if (m_bStereo)
+		BlipBufferRight.clear();
 }
 
 int CMixer::SamplesAvail() const
@@ -237,7 +351,10 @@ int CMixer::SamplesAvail() const
 
 int CMixer::FinishBuffer(int t)
 {
+	// Both sides share one timebase
 	BlipBuffer.end_frame(t);
+	if (m_bStereo)
+		BlipBufferRight.end_frame(t);
 
 	// Get channel levels for VRC7
 	for (int i = 0; i < 6; ++i)
@@ -269,68 +386,139 @@ int CMixer::FinishBuffer(int t)
 
 void CMixer::MixInternal1(int Time)
 {
-	static double LastSum;
-	double Sum, Delta;
+	// Pin 1: squares
+	const int32 Sq1 = m_iChannels[CHANID_SQUARE1];
+	const int32 Sq2 = m_iChannels[CHANID_SQUARE2];
+	int32 Delta[2];
+
+	if (!m_bStereo) {
+		int32 Sum = PIN1_TABLE[(Sq1 + Sq2) * PIN_STEPS];
+		Synth2A03SS.offset(Time, Sum - m_iLastSumSS[0], &BlipBuffer);
+		m_iLastSumSS[0] = Sum;
+		return;
+	}
 
-#ifdef LINEAR_MIXING
-	SumL = ((m_iChannels[CHANID_SQUARE1].Left + m_iChannels[CHANID_SQUARE2].Left) * 0.00752) * InternalVol;
-	SumR = ((m_iChannels[CHANID_SQUARE1].Right + m_iChannels[CHANID_SQUARE2].Right) *  0.00752) * InternalVol;
-#else
-	Sum = CalcPin1(m_iChannels[CHANID_SQUARE1], m_iChannels[CHANID_SQUARE2]);
-#endif
+	for (int i = 0; i < 2; ++i) {
+		int32 Sum = PIN1_TABLE[(Sq1 * m_iPanGain[i][CHANID_SQUARE1] + Sq2 * m_iPanGain[i][CHANID_SQUARE2]) >> PIN_GAIN_SHIFT];
+		Delta[i] = Sum - m_iLastSumSS[i];
+		m_iLastSumSS[i] = Sum;
+	}
 
-	Delta = (Sum - LastSum) * AMP_2A03;
-	Synth2A03SS.offset(Time, (int)Delta, &BlipBuffer);
-	LastSum = Sum;
+	OffsetStereo(Synth2A03SS, Time, Delta, &BlipBuffer, &BlipBufferRight);
 }
 
 void CMixer::MixInternal2(int Time)
 {
-	static double LastSum;
-	double Sum, Delta;
+	// Pin 2: triangle, noise and DPCM
+	const int32 Tri = m_iChannels[CHANID_TRIANGLE] * PIN2_WEIGHT_T;
+	const int32 Noise = m_iChannels[CHANID_NOISE] * PIN2_WEIGHT_N;
+	const int32 DPCM = m_iChannels[CHANID_DPCM] * PIN2_WEIGHT_D;
+	int32 Delta[2];
+
+	if (!m_bStereo) {
+		int32 Sum = PIN2_MONO_TABLE[(m_iChannels[CHANID_TRIANGLE] << 11) | (m_iChannels[CHANID_NOISE] << 7) | m_iChannels[CHANID_DPCM]];
+		Synth2A03TND.offset(Time, Sum - m_iLastSumTND[0], &BlipBuffer);
+		m_iLastSumTND[0] = Sum;
+		return;
+	}
 
-#ifdef LINEAR_MIXING
-	SumL = ((0.00851 * m_iChannels[CHANID_TRIANGLE].Left + 0.00494 * m_iChannels[CHANID_NOISE].Left + 0.00335 * m_iChannels[CHANID_DPCM].Left)) * InternalVol;
-	SumR = ((0.00851 * m_iChannels[CHANID_TRIANGLE].Right + 0.00494 * m_iChannels[CHANID_NOISE].Right + 0.00335 * m_iChannels[CHANID_DPCM].Right)) * InternalVol;
-#else
-	Sum = CalcPin2(m_iChannels[CHANID_TRIANGLE], m_iChannels[CHANID_NOISE], m_iChannels[CHANID_DPCM]);
-#endif
+	for (int i = 0; i < 2; ++i) {
+		int32 Sum = PIN2_TABLE[(Tri * m_iPanGain[i][CHANID_TRIANGLE] + Noise * m_iPanGain[i][CHANID_NOISE] + DPCM * m_iPanGain[i][CHANID_DPCM]) >> 8];
+		Delta[i] = Sum - m_iLastSumTND[i];
+		m_iLastSumTND[i] = Sum;
+	}
 
-	Delta = (Sum - LastSum) * AMP_2A03;
-	Synth2A03TND.offset(Time, (int)Delta, &BlipBuffer);
-	LastSum = Sum;
+	OffsetStereo(Synth2A03TND, Time, Delta, &BlipBuffer, &BlipBufferRight);
 }
 
-void CMixer::MixN163(int Value, int Time)
+inline void CMixer::PanDelta(int ChanID, int Level, int32 *pDelta)
 {
-	SynthN163.offset(Time, Value, &BlipBuffer);
+	// Expansion channels are panned by scaling their absolute level, each
+	// side gets the difference to its last output
+	for (int i = 0; i < 2; ++i) {
+		int32 Output = (Level * m_iPanGain[i][ChanID]) >> 8;
+		pDelta[i] = Output - m_iLastOutput[i][ChanID];
+		m_iLastOutput[i][ChanID] = Output;
+	}
 }
 
-void CMixer::MixFDS(int Value, int Time)
+void CMixer::MixN163(int ChanID, int Delta, int Level, int Time)
 {
-	SynthFDS.offset(Time, Value, &BlipBuffer);
+	int32 Pan[2];
+
+	if (!m_bStereo) {
+		SynthN163.offset(Time, Delta, &BlipBuffer);
+		return;
+	}
+
+	if (m_bNamcoMultiplexed) {
+		// Channels take turns on one DAC, the level is the whole N163 output
+		for (int i = 0; i < 2; ++i) {
+			int32 Output = (Level * m_iPanGain[i][ChanID]) >> 8;
+			Pan[i] = Output - m_iLastNamcoOutput[i];
+			m_iLastNamcoOutput[i] = Output;
+		}
+	}
+	else {
+		PanDelta(ChanID, Level, Pan);
+		m_iLastNamcoOutput[0] += Pan[0];
+		m_iLastNamcoOutput[1] += Pan[1];
+	}
+
+	OffsetStereo(SynthN163, Time, Pan, &BlipBuffer, &BlipBufferRight);
 }
 
-void CMixer::MixVRC6(int Value, int Time)
+void CMixer::MixFDS(int ChanID, int Delta, int Level, int Time)
 {
-	SynthVRC6.offset(Time, Value, &BlipBuffer);
+	int32 Pan[2];
+
+	if (!m_bStereo) {
+		SynthFDS.offset(Time, Delta, &BlipBuffer);
+		return;
+	}
+
+	PanDelta(ChanID, Level, Pan);
+	OffsetStereo(SynthFDS, Time, Pan, &BlipBuffer, &BlipBufferRight);
 }
 
-void CMixer::MixMMC5(int Value, int Time)
+void CMixer::MixVRC6(int ChanID, int Delta, int Level, int Time)
 {
-	SynthMMC5.offset(Time, Value, &BlipBuffer);
+	int32 Pan[2];
+
+	if (!m_bStereo) {
+		SynthVRC6.offset(Time, Delta, &BlipBuffer);
+		return;
+	}
+
+	PanDelta(ChanID, Level, Pan);
+	OffsetStereo(SynthVRC6, Time, Pan, &BlipBuffer, &BlipBufferRight);
 }
 
-void CMixer::MixS5B(int Value, int Time)
+void CMixer::MixMMC5(int ChanID, int Delta, int Level, int Time)
 {
-	SynthS5B.offset(Time, Value, &BlipBuffer);
+	int32 Pan[2];
+
+	if (!m_bStereo) {
+		SynthMMC5.offset(Time, Delta, &BlipBuffer);
+		return;
+	}
+
+	PanDelta(ChanID, Level, Pan);
+	OffsetStereo(SynthMMC5, Time, Pan, &BlipBuffer, &BlipBufferRight);
 }
 
 void CMixer::AddValue(int ChanID, int Chip, int Value, int AbsValue, int FrameCycles)
 {
 	// Add sound to mixer
 	//
+	// Value is the channel's new level for 2A03 and MMC5 channels and the
+	// change in level for the other chips, AbsValue is always the level
 	
+	if (m_pChipLog[Chip]) {
+		m_pChipLog[Chip]->AddValue(ChanID, Chip, Value, AbsValue, FrameCycles);
+		return;
+	}
+
 	int Delta = Value - m_iChannels[ChanID];
 	StoreChannelLevel(ChanID, AbsValue);
 	m_iChannels[ChanID] = Value;
@@ -350,22 +538,28 @@ void CMixer::AddValue(int ChanID, int Chip, int Value, int AbsValue, int FrameCy
 			}
 			break;
 		case SNDCHIP_N163:
-			MixN163(Value, FrameCycles);
+			MixN163(ChanID, Value, AbsValue, FrameCycles);
 			break;
 		case SNDCHIP_FDS:
-			MixFDS(Value, FrameCycles);
+			MixFDS(ChanID, Value, AbsValue, FrameCycles);
 			break;
 		case SNDCHIP_MMC5:
-			MixMMC5(Delta, FrameCycles);
+			MixMMC5(ChanID, Delta, Value, FrameCycles);
 			break;
 		case SNDCHIP_VRC6:
-			MixVRC6(Value, FrameCycles);
+			MixVRC6(ChanID, Value, AbsValue, FrameCycles);
 			break;
 	}
 }
 
 int CMixer::ReadBuffer(int Size, void *Buffer, bool Stereo)
 {
+	// Stereo samples are interleaved, returns the number of sample frames
+	if (Stereo && m_bStereo) {
+		BlipBuffer.read_samples((blip_sample_t*)Buffer, Size, 1);
+		return BlipBufferRight.read_samples((blip_sample_t*)Buffer + 1, Size, 1);
+	}
+
 	return BlipBuffer.read_samples((blip_sample_t*)Buffer, Size);
 }
 
@@ -412,3 +606,71 @@ uint32 CMixer::ResampleDuration(uint32 Time) const
 {
 	return (uint32)BlipBuffer.resampled_duration((blip_time_t)Time);
 }
+
+void CMixer::SetChipLog(int Chip, CMixerLog *pLog)
+{
+	m_pChipLog[Chip] = pLog;
+}
+
+// CMixerLog
+
+void CMixerLog::Clear()
+{
+	m_vEvents.clear();
+	m_vSamples.clear();
+}
+
+void CMixerLog::AddValue(int ChanID, int Chip, int Value, int AbsValue, int FrameCycles)
+{
+	stLogEvent Event = {LOG_VALUE, ChanID, Chip, Value, AbsValue, FrameCycles, 0.0f};
+	m_vEvents.push_back(Event);
+}
+
+void CMixerLog::SetNamcoVolume(float fVol)
+{
+	stLogEvent Event = {LOG_NAMCO_VOLUME, 0, SNDCHIP_N163, 0, 0, 0, fVol};
+	m_vEvents.push_back(Event);
+}
+
+void CMixerLog::SetNamcoMultiplexed(bool bMultiplexed)
+{
+	stLogEvent Event = {LOG_NAMCO_MULTIPLEXED, 0, SNDCHIP_N163, bMultiplexed ? 1 : 0, 0, 0, 0.0f};
+	m_vEvents.push_back(Event);
+}
+
+void CMixerLog::MixSamples(int Chip, const blip_sample_t *pLeft, const blip_sample_t *pRight, uint32 Count)
+{
+	// The samples are copied, the chip reuses its buffer
+	stLogEvent Event = {pRight ? LOG_SAMPLES_STEREO : LOG_SAMPLES, 0, Chip, (int)m_vSamples.size(), (int)Count, 0, 0.0f};
+	m_vEvents.push_back(Event);
+
+	m_vSamples.insert(m_vSamples.end(), pLeft, pLeft + Count);
+	if (pRight)
+		m_vSamples.insert(m_vSamples.end(), pRight, pRight + Count);
+}
+
+void CMixerLog::Replay(CMixer *pMixer) const
+{
+	// The chip's log slot must be cleared first
+	const blip_sample_t *pSamples = m_vSamples.empty() ? NULL : &m_vSamples[0];
+
+	for (std::vector<stLogEvent>::const_iterator it = m_vEvents.begin(); it != m_vEvents.end(); ++it) {
+		switch (it->Type) {
+			case LOG_VALUE:
+				pMixer->AddValue(it->ChanID, it->Chip, it->Value, it->AbsValue, it->Time);
+				break;
+			case LOG_NAMCO_VOLUME:
+				pMixer->SetNamcoVolume(it->fValue);
+				break;
+			case LOG_NAMCO_MULTIPLEXED:
+				pMixer->SetNamcoMultiplexed(it->Value != 0);
+				break;
+			case LOG_SAMPLES:
+				pMixer->MixSamples(it->Chip, pSamples + it->Value, it->AbsValue);
+				break;
+			case LOG_SAMPLES_STEREO:
+				pMixer->MixSamplesStereo(it->Chip, pSamples + it->Value, pSamples + it->Value + it->AbsValue, it->AbsValue);
+				break;
+		}
+	}
+}
@@ -21,6 +21,7 @@
 #ifndef _MIXER_H_
 #define _MIXER_H_
 
+#include <vector>
 #include "../common.h"
 #include "../Blip_Buffer/Blip_Buffer.h"
 
@@ -64,6 +65,52 @@ enum CHAN_IDS {
 	CHANNELS		/* Total number of channels */
 };
 
+// Mixer log slots are indexed by the SNDCHIP_* value
+const int MIXER_LOG_SLOTS = 64;
+
+class CMixer;
+
+// Mixer calls of an expansion chip rendered on a worker thread, they
+// are replayed in order at the end of the frame
+class CMixerLog
+{
+	public:
+		void	Clear();
+		void	Replay(CMixer *pMixer) const;
+
+		void	AddValue(int ChanID, int Chip, int Value, int AbsValue, int FrameCycles);
+		void	SetNamcoVolume(float fVol);
+		void	SetNamcoMultiplexed(bool bMultiplexed);
+		void	MixSamples(int Chip, const blip_sample_t *pLeft, const blip_sample_t *pRight, uint32 Count);
+
+	private:
+		enum {
+			LOG_VALUE,
+			LOG_NAMCO_VOLUME,
+			LOG_NAMCO_MULTIPLEXED,
+			LOG_SAMPLES,
+			LOG_SAMPLES_STEREO
+		};
+
+		struct stLogEvent {
+			int		Type;
+			int		ChanID;
+			int		Chip;
+			int		Value;
+			int		AbsValue;
+			int		Time;
+			float	fValue;
+		};
+
+		std::vector<stLogEvent>		m_vEvents;
+		std::vector<blip_sample_t>	m_vSamples;
+};
+
+// Channel pan positions
+const int PAN_LEFT	 = -100;
+const int PAN_CENTER =	  0;
+const int PAN_RIGHT	 =	100;
+
 class CMixer
 {
 	public:
@@ -80,7 +127,8 @@ class CMixer
 		int		FinishBuffer(int t);
 		int		SamplesAvail() const;
 
-		void	MixSamples(blip_sample_t *pBuffer, uint32 Count);
+		void	MixSamples(int Chip, const blip_sample_t *pBuffer, uint32 Count);
+		void	MixSamplesStereo(int Chip, const blip_sample_t *pLeft, const blip_sample_t *pRight, uint32 Count);
 		uint32	GetMixSampleCount(int t) const;
 
 		void	AddSample(int ChanID, int Value);
@@ -95,18 +143,25 @@ class CMixer
 
 		void	SetNamcoMixing(bool bLinear);
 		void	SetNamcoVolume(float fVol);
+		void	SetNamcoMultiplexed(bool bMultiplexed);
 
-	private:
-		inline double CalcPin1(double Val1, double Val2);
-		inline double CalcPin2(double Val1, double Val2, double Val3);
+		bool	IsStereo() const;
+		void	SetChannelPan(int ChanID, int Pan);
+		int		GetChannelPan(int ChanID) const;
+		int32	GetPanGain(int Side, int ChanID) const;
 
+		// Calls from the chip are recorded to the log instead of mixed while it is set
+		void	SetChipLog(int Chip, CMixerLog *pLog);
+
+	private:
 		void MixInternal1(int Time);
 		void MixInternal2(int Time);
-		void MixN163(int Value, int Time);
-		void MixFDS(int Value, int Time);
-		void MixVRC6(int Value, int Time);
-		void MixMMC5(int Value, int Time);
-		void MixS5B(int Value, int Time);
+		void MixN163(int ChanID, int Delta, int Level, int Time);
+		void MixFDS(int ChanID, int Delta, int Level, int Time);
+		void MixVRC6(int ChanID, int Delta, int Level, int Time);
+		void MixMMC5(int ChanID, int Delta, int Level, int Time);
+
+		inline void PanDelta(int ChanID, int Level, int32 *pDelta);
 
 		void StoreChannelLevel(int Channel, int Value);
 
@@ -120,15 +175,24 @@ class CMixer
 		Blip_Synth<blip_good_quality, -2000>	SynthS5B;
 		
 
-		// Blip buffer object
+		// Blip buffer objects, the right buffer is only used in stereo
 		Blip_Buffer	BlipBuffer;
+		Blip_Buffer	BlipBufferRight;
 
 		// Random variables
 		int32		*m_pSampleBuffer;
 
+		CMixerLog	*m_pChipLog[MIXER_LOG_SLOTS];
+
 		int32		m_iChannels[CHANNELS];
 		uint8		m_iExternalChip;
 		uint32		m_iSampleRate;
+		bool		m_bStereo;
+
+		// Pan positions and fixed point gains per side, 256 = full volume
+		int			m_iChannelPan[CHANNELS];
+		int32		m_iPanGain[2][CHANNELS];
+		int32		m_iLastOutput[2][CHANNELS];
 
 		float		m_fChannelLevels[CHANNELS];
 		uint32		m_iChanLevelFallOff[CHANNELS];
@@ -146,6 +210,12 @@ class CMixer
 		float		m_fLevelFDS;
 
 		bool		m_bNamcoMixing;
+		bool		m_bNamcoMultiplexed;
+		int32		m_iLastNamcoOutput[2];
+
+		// Last output of the internal mixing pins, per side
+		int32		m_iLastSumSS[2];
+		int32		m_iLastSumTND[2];
 };
 
 #endif /* _MIXER_H_ */
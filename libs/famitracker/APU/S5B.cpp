@@ -25,8 +25,6 @@
 
 // Sunsoft 5B (YM2149)
 
-PSG *psg;
-
 float CS5B::AMPLIFY = 2.0f;
 
 CS5B::CS5B(CMixer *pMixer)
@@ -35,13 +33,16 @@ CS5B::CS5B(CMixer *pMixer)
 
 	m_fVolume = AMPLIFY;
 
-	psg = NULL;
+	m_pPSG = NULL;
+	m_iBufferPtr = 0;
+	m_iLastSample = 0;
+	m_iLastSampleRight = 0;
 }
 
 CS5B::~CS5B()
 {
-	if (psg)
-		PSG_delete(psg);
+	if (m_pPSG)
+		PSG_delete(m_pPSG);
 }
 
 void CS5B::Reset()
@@ -55,28 +56,52 @@ void CS5B::Process(uint32 Time)
 	m_iTime += Time;
 }
 
-int16 m_pBuffer[4000];
-uint32 m_iBufferPtr = 0;
-
 void CS5B::EndFrame()
 {
-	GetMixMono();
+	if (m_pMixer->IsStereo())
+		GetMixStereo();
+	else
+		GetMixMono();
 }
 
 void CS5B::GetMixMono()
 {
-	static int32 LastSample = 0;
+	uint32 WantSamples = m_pMixer->GetMixSampleCount(m_iTime);
+
+	// Generate samples
+	while (m_iBufferPtr < WantSamples) {
+		int32 Sample = int32(float(PSG_calc(m_pPSG)) * m_fVolume);
+		m_pBuffer[m_iBufferPtr++] = int16((Sample + m_iLastSample) >> 1);
+		m_iLastSample = Sample;
+	}
+
+	m_pMixer->MixSamples(SNDCHIP_S5B, (blip_sample_t*)m_pBuffer, WantSamples);
 
+	m_iBufferPtr -= WantSamples;
+	m_iTime = 0;
+}
+
+void CS5B::GetMixStereo()
+{
 	uint32 WantSamples = m_pMixer->GetMixSampleCount(m_iTime);
+	int Sample[2];
+
+	// Pan and volume are folded into the channel gains
+	for (int i = 0; i < 3; ++i) {
+		PSG_set_pan_gain(m_pPSG, i, int32(float(m_pMixer->GetPanGain(0, CHANID_S5B_CH1 + i)) * m_fVolume),
+			int32(float(m_pMixer->GetPanGain(1, CHANID_S5B_CH1 + i)) * m_fVolume));
+	}
 
 	// Generate samples
 	while (m_iBufferPtr < WantSamples) {
-		int32 Sample = int32(float(PSG_calc(psg)) * m_fVolume);
-		m_pBuffer[m_iBufferPtr++] = int16((Sample + LastSample) >> 1);
-		LastSample = Sample;
+		PSG_calc_stereo(m_pPSG, Sample);
+		m_pBuffer[m_iBufferPtr] = int16((Sample[0] + m_iLastSample) >> 1);
+		m_pBufferRight[m_iBufferPtr++] = int16((Sample[1] + m_iLastSampleRight) >> 1);
+		m_iLastSample = Sample[0];
+		m_iLastSampleRight = Sample[1];
 	}
 
-	m_pMixer->MixSamples((blip_sample_t*)m_pBuffer, WantSamples);
+	m_pMixer->MixSamplesStereo(SNDCHIP_S5B, (blip_sample_t*)m_pBuffer, (blip_sample_t*)m_pBufferRight, WantSamples);
 
 	m_iBufferPtr -= WantSamples;
 	m_iTime = 0;
@@ -89,7 +114,7 @@ void CS5B::Write(uint16 Address, uint8 Value)
 			m_iRegister = Value & 0xF;
 			break;
 		case 0xE000:
-			PSG_writeReg(psg, m_iRegister, Value);
+			PSG_writeReg(m_pPSG, m_iRegister, Value);
 			break;
 	}
 }
@@ -103,14 +128,14 @@ uint8 CS5B::Read(uint16 Address, bool &Mapped)
 
 void CS5B::SetSampleSpeed(uint32 SampleRate, double ClockRate, uint32 FrameRate)
 {
-	if (psg != NULL) {
-		PSG_delete(psg);
+	if (m_pPSG != NULL) {
+		PSG_delete(m_pPSG);
 	}
 
 	//PSG_init((uint32)ClockRate, SampleRate);
-	psg = PSG_new((uint32)ClockRate, SampleRate);
-	PSG_setVolumeMode(psg, 1);
-	PSG_reset(psg);
+	m_pPSG = PSG_new((uint32)ClockRate, SampleRate);
+	PSG_setVolumeMode(m_pPSG, 1);
+	PSG_reset(m_pPSG);
 
 //	psg = PSG_new();
 
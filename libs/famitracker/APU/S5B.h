@@ -3,6 +3,7 @@
 
 #include "External.h"
 #include "Channel.h"
+#include "emu2149.h"
 
 class CS5B : public CExternal {
 public:
@@ -18,6 +19,7 @@ public:
 //	void	SetChannelVolume(int Chan, int LevelL, int LevelR);
 protected:
 	void	GetMixMono();
+	void	GetMixStereo();
 private:
 	static float AMPLIFY;
 private:
@@ -28,6 +30,14 @@ private:
 
 	float	m_fVolume;
 
+	PSG		*m_pPSG;
+
+	int16	m_pBuffer[4000];
+	int16	m_pBufferRight[4000];
+	uint32	m_iBufferPtr;
+	int32	m_iLastSample;
+	int32	m_iLastSampleRight;
+
 };
 
 #endif /* _S5B_H_ */
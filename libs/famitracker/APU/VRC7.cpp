@@ -44,6 +44,8 @@ CVRC7::~CVRC7()
 void CVRC7::Reset()
 {
 	m_iBufferPtr = 0;
+	m_iLastSample = 0;
+	m_iLastSampleRight = 0;
 	m_iTime = 0;
 }
 
@@ -62,8 +64,8 @@ void CVRC7::SetSampleSpeed(uint32 SampleRate, double ClockRate, uint32 FrameRate
 	m_iMaxSamples = (SampleRate / FrameRate) * 2;	// Allow some overflow
 
 	SAFE_RELEASE_ARRAY(m_pBuffer);
-	m_pBuffer = new int16[m_iMaxSamples];
-	memset(m_pBuffer, 0, sizeof(int16) * m_iMaxSamples);
+	m_pBuffer = new int16[m_iMaxSamples * 2];
+	memset(m_pBuffer, 0, sizeof(int16) * m_iMaxSamples * 2);
 }
 
 void CVRC7::SetVolume(float Volume)
@@ -90,18 +92,51 @@ uint8 CVRC7::Read(uint16 Address, bool &Mapped)
 
 void CVRC7::EndFrame()
 {
-	uint32 WantSamples = m_pMixer->GetMixSampleCount(m_iTime);
+	if (m_pMixer->IsStereo())
+		GetMixStereo();
+	else
+		GetMixMono();
+}
 
-	static int32 LastSample = 0;
+void CVRC7::GetMixMono()
+{
+	uint32 WantSamples = m_pMixer->GetMixSampleCount(m_iTime);
 
 	// Generate VRC7 samples
 	while (m_iBufferPtr < WantSamples) {
 		int32 Sample = int(float(OPLL_calc(m_pOPLLInt)) * m_fVolume);
-		m_pBuffer[m_iBufferPtr++] = int16((Sample + LastSample) >> 1);
-		LastSample = Sample;
+		m_pBuffer[m_iBufferPtr++] = int16((Sample + m_iLastSample) >> 1);
+		m_iLastSample = Sample;
+	}
+
+	m_pMixer->MixSamples(SNDCHIP_VRC7, (blip_sample_t*)m_pBuffer, WantSamples);
+
+	m_iBufferPtr -= WantSamples;
+	m_iTime = 0;
+}
+
+void CVRC7::GetMixStereo()
+{
+	uint32 WantSamples = m_pMixer->GetMixSampleCount(m_iTime);
+	int16 *pRight = m_pBuffer + m_iMaxSamples;
+	int Sample[2];
+
+	// Pan and volume are folded into the channel gains, so the per sample path stays integer
+	for (int i = 0; i < 6; ++i) {
+		OPLL_set_pan_gain(m_pOPLLInt, i, int32(float(m_pMixer->GetPanGain(0, CHANID_VRC7_CH1 + i)) * m_fVolume),
+			int32(float(m_pMixer->GetPanGain(1, CHANID_VRC7_CH1 + i)) * m_fVolume));
+	}
+
+	// Generate VRC7 samples
+	while (m_iBufferPtr < WantSamples) {
+		OPLL_calc_stereo(m_pOPLLInt, Sample);
+		m_pBuffer[m_iBufferPtr] = int16((Sample[0] + m_iLastSample) >> 1);
+		pRight[m_iBufferPtr++] = int16((Sample[1] + m_iLastSampleRight) >> 1);
+		m_iLastSample = Sample[0];
+		m_iLastSampleRight = Sample[1];
 	}
 
-	m_pMixer->MixSamples((blip_sample_t*)m_pBuffer, WantSamples);
+	m_pMixer->MixSamplesStereo(SNDCHIP_VRC7, (blip_sample_t*)m_pBuffer, (blip_sample_t*)pRight, WantSamples);
 
 	m_iBufferPtr -= WantSamples;
 	m_iTime = 0;
@@ -38,6 +38,9 @@ public:
 	void Process(uint32 Time);
 
 protected:
+	void GetMixMono();
+	void GetMixStereo();
+
 	static const float  AMPLIFY;
 	static const uint32 OPL_CLOCK;
 
@@ -46,8 +49,10 @@ private:
 	uint32	m_iTime;
 	uint32	m_iMaxSamples;
 
-	int16	*m_pBuffer;
+	int16	*m_pBuffer;			// Left half is used for mono, right half holds the right side in stereo
 	uint32	m_iBufferPtr;
+	int32	m_iLastSample;
+	int32	m_iLastSampleRight;
 
 	uint8	m_iSoundReg;
 
@@ -140,6 +140,8 @@ PSG_reset (PSG * psg)
   for (i = 0; i < 3; i++)
   {
     psg->cout[i] = 0;
+    psg->chout[i] = 0;
+    psg->pan_gain[0][i] = psg->pan_gain[1][i] = 256;
     psg->count[i] = 0x1000;
     psg->freq[i] = 0;
     psg->edge[i] = 0;
@@ -163,6 +165,7 @@ PSG_reset (PSG * psg)
   psg->env_pause = 1;
 
   psg->out = 0;
+  psg->sout[0] = psg->sout[1] = 0;
 }
 
 EMU2149_API void
@@ -263,6 +266,8 @@ calc (PSG * psg)
       }
     }
 
+    psg->chout[i] = 0;
+
     if (psg->mask&PSG_MASK_CH(i))
       continue;
 
@@ -274,6 +279,7 @@ calc (PSG * psg)
         psg->cout[i] = psg->voltbl[psg->env_ptr];
 
 	  psg_volumes[i] = psg->cout[i];
+	  psg->chout[i] = psg->cout[i];
 	  mix += psg->cout[i];
     }
 
@@ -301,6 +307,52 @@ PSG_calc (PSG * psg)
   return (int16) (psg->out << 4);
 }
 
+EMU2149_API void
+PSG_set_pan_gain (PSG * psg, uint32 ch, int32 left, int32 right)
+{
+  psg->pan_gain[0][ch % 3] = left;
+  psg->pan_gain[1][ch % 3] = right;
+}
+
+INLINE static void
+calc_stereo (PSG * psg, int out[2])
+{
+  calc (psg);
+
+  out[0] = (psg->chout[0] * psg->pan_gain[0][0] + psg->chout[1] * psg->pan_gain[0][1]
+          + psg->chout[2] * psg->pan_gain[0][2]) >> 8;
+  out[1] = (psg->chout[0] * psg->pan_gain[1][0] + psg->chout[1] * psg->pan_gain[1][1]
+          + psg->chout[2] * psg->pan_gain[1][2]) >> 8;
+}
+
+EMU2149_API void
+PSG_calc_stereo (PSG * psg, int out[2])
+{
+  int32 s[2];
+
+  if (!psg->quality)
+  {
+    calc_stereo (psg, out);
+    out[0] <<= 4;
+    out[1] <<= 4;
+    return;
+  }
+
+  /* Simple rate converter */
+  while (psg->realstep > psg->psgtime)
+  {
+    psg->psgtime += psg->psgstep;
+    calc_stereo (psg, s);
+    psg->sout[0] = (psg->sout[0] + s[0]) >> 1;
+    psg->sout[1] = (psg->sout[1] + s[1]) >> 1;
+  }
+
+  psg->psgtime = psg->psgtime - psg->realstep;
+
+  out[0] = psg->sout[0] << 4;
+  out[1] = psg->sout[1] << 4;
+}
+
 EMU2149_API void
 PSG_writeReg (PSG * psg, uint32 reg, uint32 val)
 {
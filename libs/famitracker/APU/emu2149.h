@@ -40,6 +40,11 @@ extern "C"
     int32 out;
     int32 cout[3];
 
+    /* Stereo output, channel gains are fixed point with 256 = full volume */
+    int32 chout[3];
+    int32 pan_gain[2][3];
+    int32 sout[2];
+
     uint32 clk, rate, base_incr, quality;
 
     uint32 count[3];
@@ -91,6 +96,8 @@ extern "C"
   EMU2149_API uint8 PSG_readReg (PSG * psg, uint32 reg);
   EMU2149_API uint8 PSG_readIO (PSG * psg);
   EMU2149_API int16 PSG_calc (PSG *);
+  EMU2149_API void PSG_calc_stereo (PSG *, int out[2]);
+  EMU2149_API void PSG_set_pan_gain (PSG *, uint32 ch, int32 left, int32 right);
   EMU2149_API void PSG_setVolumeMode (PSG * psg, int type);
   EMU2149_API uint32 PSG_setMask (PSG *, uint32 mask);
   EMU2149_API uint32 PSG_toggleMask (PSG *, uint32 mask);
@@ -1055,8 +1055,8 @@ OPLL_reset (OPLL * opll)
   opll->realstep = (uint32) ((1 << 31) / rate);
   opll->opllstep = (uint32) ((1 << 31) / (clk / 72));
   opll->oplltime = 0;
-  for (i = 0; i < 14; i++)
-    opll->pan[i] = 2;
+  for (i = 0; i < 16; i++)
+    opll->pan_gain[0][i] = opll->pan_gain[1][i] = 256;
   opll->sprev[0] = opll->sprev[1] = 0;
   opll->snext[0] = opll->snext[1] = 0;
 #endif
@@ -1770,14 +1770,26 @@ OPLL_writeIO (OPLL * opll, uint32 adr, uint32 val)
 void
 OPLL_set_pan (OPLL * opll, uint32 ch, uint32 pan)
 {
-  opll->pan[ch & 15] = pan & 3;
+  opll->pan_gain[0][ch & 15] = (pan & 2) ? 256 : 0;
+  opll->pan_gain[1][ch & 15] = (pan & 1) ? 256 : 0;
 }
 
+/* Channel gains are fixed point, 256 = full volume */
+void
+OPLL_set_pan_gain (OPLL * opll, uint32 ch, int32 left, int32 right)
+{
+  opll->pan_gain[0][ch & 15] = left;
+  opll->pan_gain[1][ch & 15] = right;
+}
+
+#define PAN_MIX(acc,ch,val) \
+  { int32 v = (val); acc[0] += v * opll->pan_gain[0][ch]; acc[1] += v * opll->pan_gain[1][ch]; }
+
 static void
-calc_stereo (OPLL * opll, int32 out[2])
+calc_stereo (OPLL * opll, int out[2])
 {
-  int32 b[4] = { 0, 0, 0, 0 };        /* Ignore, Right, Left, Center */
-  int32 r[4] = { 0, 0, 0, 0 };        /* Ignore, Right, Left, Center */
+  int32 b[2] = { 0, 0 };        /* Left, Right */
+  int32 r[2] = { 0, 0 };        /* Left, Right */
   int32 i;
 
   update_ampm (opll);
@@ -1791,52 +1803,59 @@ calc_stereo (OPLL * opll, int32 out[2])
 
   for (i = 0; i < 6; i++)
     if (!(opll->mask & OPLL_MASK_CH (i)) && (CAR(opll,i)->eg_mode != FINISH))
-      b[opll->pan[i]] += calc_slot_car (CAR(opll,i), calc_slot_mod (MOD(opll,i)));
+    {
+      int32 val = calc_slot_car (CAR(opll,i), calc_slot_mod (MOD(opll,i)));
+      PAN_MIX (b, i, val);
+      if (abs(val) > opll_volumes[i])
+        opll_volumes[i] = val;
+    }
 
 
   if (opll->patch_number[6] <= 15)
   {
     if (!(opll->mask & OPLL_MASK_CH (6)) && (CAR(opll,6)->eg_mode != FINISH))
-      b[opll->pan[6]] += calc_slot_car (CAR(opll,6), calc_slot_mod (MOD(opll,6)));
+      PAN_MIX (b, 6, calc_slot_car (CAR(opll,6), calc_slot_mod (MOD(opll,6))));
   }
   else
   {
     if (!(opll->mask & OPLL_MASK_BD) && (CAR(opll,6)->eg_mode != FINISH))
-      r[opll->pan[9]] += calc_slot_car (CAR(opll,6), calc_slot_mod (MOD(opll,6)));
+      PAN_MIX (r, 9, calc_slot_car (CAR(opll,6), calc_slot_mod (MOD(opll,6))));
   }
 
   if (opll->patch_number[7] <= 15)
   {
     if (!(opll->mask & OPLL_MASK_CH (7)) && (CAR (opll,7)->eg_mode != FINISH))
-      b[opll->pan[7]] += calc_slot_car (CAR (opll,7), calc_slot_mod (MOD (opll,7)));
+      PAN_MIX (b, 7, calc_slot_car (CAR (opll,7), calc_slot_mod (MOD (opll,7))));
   }
   else
   {
     if (!(opll->mask & OPLL_MASK_HH) && (MOD (opll,7)->eg_mode != FINISH))
-      r[opll->pan[10]] += calc_slot_hat (MOD (opll,7), CAR(opll,8)->pgout, opll->noise_seed&1);
+      PAN_MIX (r, 10, calc_slot_hat (MOD (opll,7), CAR(opll,8)->pgout, opll->noise_seed&1));
     if (!(opll->mask & OPLL_MASK_SD) && (CAR (opll,7)->eg_mode != FINISH))
-      r[opll->pan[11]] -= calc_slot_snare (CAR (opll,7), opll->noise_seed&1);
+      PAN_MIX (r, 11, -calc_slot_snare (CAR (opll,7), opll->noise_seed&1));
   }
 
   if (opll->patch_number[8] <= 15)
   {
     if (!(opll->mask & OPLL_MASK_CH (8)) && (CAR (opll,8)->eg_mode != FINISH))
-      b[opll->pan[8]] += calc_slot_car (CAR (opll,8), calc_slot_mod (MOD (opll,8)));
+      PAN_MIX (b, 8, calc_slot_car (CAR (opll,8), calc_slot_mod (MOD (opll,8))));
   }
   else
   {
     if (!(opll->mask & OPLL_MASK_TOM) && (MOD (opll,8)->eg_mode != FINISH))
-      r[opll->pan[12]] += calc_slot_tom (MOD (opll,8));
+      PAN_MIX (r, 12, calc_slot_tom (MOD (opll,8)));
     if (!(opll->mask & OPLL_MASK_CYM) && (CAR (opll,8)->eg_mode != FINISH))
-      r[opll->pan[13]] -= calc_slot_cym (CAR (opll,8), MOD(opll,7)->pgout);
+      PAN_MIX (r, 13, -calc_slot_cym (CAR (opll,8), MOD(opll,7)->pgout));
   }
 
-  out[1] = (b[1] + b[3] + ((r[1] + r[3]) << 1)) <<3;
-  out[0] = (b[2] + b[3] + ((r[2] + r[3]) << 1)) <<3;
+  out[0] = ((b[0] + (r[0] << 1)) >> 8) << 3;
+  out[1] = ((b[1] + (r[1] << 1)) >> 8) << 3;
 }
 
+#undef PAN_MIX
+
 void
-OPLL_calc_stereo (OPLL * opll, int32 out[2])
+OPLL_calc_stereo (OPLL * opll, int out[2])
 {
   if (!opll->quality)
   {
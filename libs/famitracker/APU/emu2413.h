@@ -83,7 +83,7 @@ typedef struct __OPLL {
   uint32 opllstep ;
   int32 prev, next ;
   int32 sprev[2],snext[2];
-  uint32 pan[16];
+  int32 pan_gain[2][16];
 #endif
 
   /* Register */
@@ -128,6 +128,7 @@ EMU2413_API void OPLL_reset_patch(OPLL *, int32) ;
 EMU2413_API void OPLL_set_rate(OPLL *opll, uint32 r) ;
 EMU2413_API void OPLL_set_quality(OPLL *opll, uint32 q) ;
 EMU2413_API void OPLL_set_pan(OPLL *, uint32 ch, uint32 pan);
+EMU2413_API void OPLL_set_pan_gain(OPLL *, uint32 ch, int32 left, int32 right);
 
 /* Port/Register access */
 EMU2413_API void OPLL_writeIO(OPLL *, uint32 reg, uint32 val) ;
@@ -135,7 +136,7 @@ EMU2413_API void OPLL_writeReg(OPLL *, uint32 reg, uint32 val) ;
 
 /* Synthsize */
 EMU2413_API int16 OPLL_calc(OPLL *) ;
-EMU2413_API void OPLL_calc_stereo(OPLL *, int32 out[2]) ;
+EMU2413_API void OPLL_calc_stereo(OPLL *, int out[2]) ;
 
 /* Misc */
 EMU2413_API void OPLL_setPatch(OPLL *, const uint8 *dump) ;
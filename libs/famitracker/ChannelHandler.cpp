@@ -47,6 +47,7 @@ CChannelHandler::CChannelHandler() :
 	m_pVibratoTable(NULL),
 	m_pDocument(NULL),
 	m_pAPU(NULL),
+	m_pSoundGen(NULL),
 	m_iPitch(0),
 	m_iNote(0),
 	m_iDefaultDuty(0),
@@ -57,13 +58,14 @@ CChannelHandler::CChannelHandler() :
 	m_iSeqVolume = 0;
 }
 
-void CChannelHandler::InitChannel(CAPU *pAPU, int *pVibTable, CFamiTrackerDoc *pDoc)
+void CChannelHandler::InitChannel(CAPU *pAPU, int *pVibTable, CFamiTrackerDoc *pDoc, CSoundGen *pSoundGen)
 {
 	// Called from main thread
 
 	m_pAPU = pAPU;
 	m_pVibratoTable = pVibTable;
 	m_pDocument = pDoc;
+	m_pSoundGen = pSoundGen;
 
 //	m_pDelayedNote = NULL;
 	m_bDelayEnabled = false;
@@ -188,7 +190,7 @@ void CChannelHandler::KillChannel()
 	for (int i = 0; i < SEQ_COUNT; ++i)
 		m_iSeqEnabled[i] = 0;
 
-	theApp.RegisterKeyState(m_iChannelID, -1);
+	m_pSoundGen->RegisterKeyState(m_iChannelID, -1);
 
 	ClearRegisters();
 }
@@ -218,7 +220,7 @@ void CChannelHandler::PlayNote(stChanNote *NoteData, int EffColumns)
 		return;
 
 	// Handle global effects
-	theApp.GetSoundGenerator()->EvaluateGlobalEffects(NoteData, EffColumns);
+	m_pSoundGen->EvaluateGlobalEffects(NoteData, EffColumns);
 
 	// Let the channel play
 	PlayChannelNote(NoteData, EffColumns);
@@ -238,7 +240,7 @@ unsigned int CChannelHandler::TriggerNote(int Note)
 		Note = 0;
 
 	// Trigger a note, return note period
-	theApp.RegisterKeyState(m_iChannelID, Note);
+	m_pSoundGen->RegisterKeyState(m_iChannelID, Note);
 
 	if (!m_pNoteLookupTable)
 		return Note;
@@ -263,7 +265,7 @@ void CChannelHandler::ReleaseNote()
 	if (!m_bEnabled)
 		return;
 
-	theApp.RegisterKeyState(m_iChannelID, -1);
+	m_pSoundGen->RegisterKeyState(m_iChannelID, -1);
 
 	m_bGate =  false;
 }
@@ -793,5 +795,5 @@ int CChannelHandler::CalculateVolume(int Limit) const
 
 void CChannelHandler::AddCycles(int count)
 {
-	theApp.GetSoundGenerator()->AddCycles(count);
+	m_pSoundGen->AddCycles(count);
 }
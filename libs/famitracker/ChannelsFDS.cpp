@@ -315,7 +315,7 @@ void CChannelHandlerFDS::FillModulationTable(CInstrumentFDS *pInst)
 void CChannelHandlerFDS::CheckWaveUpdate()
 {
 	// Check wave changes
-	if (m_iInstrument != MAX_INSTRUMENTS && theApp.GetSoundGenerator()->HasWaveChanged()) {
+	if (m_iInstrument != MAX_INSTRUMENTS && m_pSoundGen->HasWaveChanged()) {
 		CInstrumentFDS *pInst = dynamic_cast<CInstrumentFDS*>(m_pDocument->GetInstrument(m_iInstrument));
 		if (pInst != NULL && pInst->GetType() == INST_FDS) {
 			// Realtime update
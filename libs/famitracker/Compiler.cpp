@@ -105,10 +105,10 @@ const char CCompiler::LABEL_PATTERN[]			= "ft_s%i_p%i_c%i";			// three arguments
 
 // CCompiler
 
-CCompiler::CCompiler(CFamiTrackerDoc *pDoc, CEdit *pLogText) : m_pDocument(pDoc), m_iBanksUsed(0)
+CCompiler::CCompiler(CFamiTrackerDoc *pDoc, CCompilerLog *pLogger) : m_pDocument(pDoc), m_iBanksUsed(0)
 {
 	// Clear progress
-	m_pLogText = pLogText;
+	m_pLogger = pLogger;
 
 	m_iWaveTables = 0;
 
@@ -122,40 +122,37 @@ CCompiler::~CCompiler()
 {
 }
 
-void CCompiler::Print(char *text, ...) const
+void CCompiler::Print(const char *text, ...) const
 {
-	static char buf[256];
-	static DWORD CharsWritten;
-	CString WndTxt;
+	// Several compilers may run at once so the buffer must be local
+	char buf[256];
     va_list argp;
-    va_start(argp, text);
-    if (!text)
+    if (!text || !m_pLogger)
 		return;
+    va_start(argp, text);
     vsprintf_s(buf, 256, text, argp);
+	va_end(argp);
 
-	int len = (int)strlen(buf);
-
-	if (buf[len - 1] == '\n') {
-		buf[len - 1] = '\r';
-		buf[len] = '\n';
-		buf[len + 1] = 0;
-	}
-
-	if (m_pLogText) {
-		int Len = m_pLogText->GetWindowTextLength();
-		m_pLogText->SetSel(Len, Len, 0);
-		m_pLogText->ReplaceSel(buf, 0);
-		m_pLogText->RedrawWindow();
-	}
+	m_pLogger->WriteLog(buf);
 }
 
 void CCompiler::ClearLog() const
 {
-	if (m_pLogText)
-		m_pLogText->SetWindowText(_T(""));
+	if (m_pLogger)
+		m_pLogger->Clear();
 }
 
-void CCompiler::ExportNSF(CString FileName, int MachineType)
+void CCompiler::Error(LPCTSTR text) const
+{
+	// Errors go to the log as well, there may be no one to click the message box
+	if (m_pLogger) {
+		m_pLogger->WriteLog(text);
+		m_pLogger->WriteLog(_T("\n"));
+	}
+	AfxMessageBox(text, MB_OK | MB_ICONERROR);
+}
+
+bool CCompiler::ExportNSF(CString FileName, int MachineType)
 {
 	CFileException ex;
 	CFile OutputFile;
@@ -173,15 +170,15 @@ void CCompiler::ExportNSF(CString FileName, int MachineType)
 		ex.GetErrorMessage(szCause, 255);
 		strFormatted = _T("Could not open output file.\n\n");
 		strFormatted += szCause;
-		AfxMessageBox(strFormatted, MB_OK | MB_ICONERROR);
-		return;
+		Error(strFormatted);
+		return false;
 	}
 
 	// Build the music data
 	if (!CompileData()) {
 		// Failed
 		OutputFile.Close();
-		return;
+		return false;
 	}
 
 	if (m_bBankSwitched) {
@@ -233,16 +230,16 @@ void CCompiler::ExportNSF(CString FileName, int MachineType)
 	// Copy the Namco table, if used
 	if (m_pDocument->GetExpansionChip() & SNDCHIP_N163) {
 
-		CSoundGen *pSoundGen = theApp.GetSoundGenerator();
+		int NamcoChannels = m_pDocument->GetNamcoChannels();
 
 		for (int i = 0; i < 96; ++i) {
-			*(pDriver + m_iDriverSize - 258 - 192 + i * 2 + 0) = (unsigned char)(pSoundGen->ReadNamcoPeriodTable(i) & 0xFF);
-			*(pDriver + m_iDriverSize - 258 - 192 + i * 2 + 1) = (unsigned char)(pSoundGen->ReadNamcoPeriodTable(i) >> 8);
+			unsigned int Period = CSoundGen::CalculateNamcoPeriod(i, NamcoChannels);
+			*(pDriver + m_iDriverSize - 258 - 192 + i * 2 + 0) = (unsigned char)(Period & 0xFF);
+			*(pDriver + m_iDriverSize - 258 - 192 + i * 2 + 1) = (unsigned char)(Period >> 8);
 		}
 
 		// Patch the channel list
 		// TODO move this to the actual music data
-		int NamcoChannels = m_pDocument->GetNamcoChannels();
 		if (NamcoChannels != 8) {
 			/*
 			TRACE0("before\n");
@@ -337,9 +334,11 @@ void CCompiler::ExportNSF(CString FileName, int MachineType)
 	OutputFile.Close();
 
 	Cleanup();
+
+	return true;
 }
 
-void CCompiler::ExportNES(CString FileName, bool EnablePAL)
+bool CCompiler::ExportNES(CString FileName, bool EnablePAL)
 {
 	CFileException ex;
 	CFile OutputFile;
@@ -356,9 +355,8 @@ void CCompiler::ExportNES(CString FileName, bool EnablePAL)
 	ClearLog();
 
 	if (m_pDocument->GetExpansionChip() != SNDCHIP_NONE) {
-		Print("Expansion chips not supported.\n");
-		AfxMessageBox(_T("Error: Expansion chips is currently not supported when exporting to .NES!"), 0, 0);
-		return;
+		Error(_T("Error: Expansion chips is currently not supported when exporting to .NES!"));
+		return false;
 	}
 
 	if (!OutputFile.Open(FileName, CFile::modeWrite | CFile::modeCreate, &ex)) {
@@ -367,19 +365,18 @@ void CCompiler::ExportNES(CString FileName, bool EnablePAL)
 		ex.GetErrorMessage(szCause, 255);
 		strFormatted = _T("Could not open output file.\n\n");
 		strFormatted += szCause;
-		AfxMessageBox(strFormatted, MB_OK | MB_ICONERROR);
-		return;
+		Error(strFormatted);
+		return false;
 	}
 
 	// Build the music data
 	if (!CompileData())
-		return;
+		return false;
 
 	if (m_bBankSwitched) {
 		// Abort if larger than 32kb
-		Print("Song is too big, aborted.\n");
-		AfxMessageBox(_T("Error: Song is too big to fit!"), 0, 0);
-		return;
+		Error(_T("Error: Song is too big to fit!"));
+		return false;
 	}
 
 	AllocateData();
@@ -441,9 +438,11 @@ void CCompiler::ExportNES(CString FileName, bool EnablePAL)
 	OutputFile.Close();
 
 	Cleanup();
+
+	return true;
 }
 
-void CCompiler::ExportBIN(CString BIN_File, CString DPCM_File)
+bool CCompiler::ExportBIN(CString BIN_File, CString DPCM_File)
 {
 	CFileException ex;
 	CFile OutputFileBIN, OutputFileDPCM;
@@ -452,11 +451,11 @@ void CCompiler::ExportBIN(CString BIN_File, CString DPCM_File)
 
 	// Build the music data
 	if (!CompileData())
-		return;
+		return false;
 
 	if (m_bBankSwitched) {
 		Print("Error: Can't write bankswitched songs!\n");
-		return;
+		return false;
 	}
 
 	// Convert to binary
@@ -468,9 +467,9 @@ void CCompiler::ExportBIN(CString BIN_File, CString DPCM_File)
 		ex.GetErrorMessage(szCause, 255);
 		strFormatted = _T("Could not open music data file: ");
 		strFormatted += szCause;
-		AfxMessageBox(strFormatted, MB_OK | MB_ICONERROR);
+		Error(strFormatted);
 		OutputFileBIN.Close();
-		return;
+		return false;
 	}
 
 	if (DPCM_File.GetLength() != 0) {
@@ -480,10 +479,10 @@ void CCompiler::ExportBIN(CString BIN_File, CString DPCM_File)
 			ex.GetErrorMessage(szCause, 255);
 			strFormatted = _T("Could not open sample file: ");
 			strFormatted += szCause;
-			AfxMessageBox(strFormatted, MB_OK | MB_ICONERROR);
+			Error(strFormatted);
 			OutputFileBIN.Close();
 			OutputFileDPCM.Close();
-			return;
+			return false;
 		}
 	}
 
@@ -503,9 +502,11 @@ void CCompiler::ExportBIN(CString BIN_File, CString DPCM_File)
 		OutputFileDPCM.Close();
 
 	Cleanup();
+
+	return true;
 }
 
-void CCompiler::ExportPRG(CString FileName, bool EnablePAL)
+bool CCompiler::ExportPRG(CString FileName, bool EnablePAL)
 {
 	// Same as export to .NES but without the header
 
@@ -518,9 +519,8 @@ void CCompiler::ExportPRG(CString FileName, bool EnablePAL)
 	ClearLog();
 
 	if (m_pDocument->GetExpansionChip() != SNDCHIP_NONE) {
-		Print("Expansion chips not supported.\n");
-		AfxMessageBox(_T("Error: Expansion chips is currently not supported when exporting to PRG!"), 0, 0);
-		return;
+		Error(_T("Error: Expansion chips is currently not supported when exporting to PRG!"));
+		return false;
 	}
 
 	if (!OutputFile.Open(FileName, CFile::modeWrite | CFile::modeCreate, &ex)) {
@@ -529,19 +529,18 @@ void CCompiler::ExportPRG(CString FileName, bool EnablePAL)
 		ex.GetErrorMessage(szCause, 255);
 		strFormatted = _T("Could not open output file.\n\n");
 		strFormatted += szCause;
-		AfxMessageBox(strFormatted, MB_OK | MB_ICONERROR);
-		return;
+		Error(strFormatted);
+		return false;
 	}
 
 	// Build the music data
 	if (!CompileData())
-		return;
+		return false;
 
 	if (m_bBankSwitched) {
 		// Abort if larger than 32kb
-		Print("Song is too big, aborted.\n");
-		AfxMessageBox(_T("Error: Song is too big to fit!"), 0, 0);
-		return;
+		Error(_T("Error: Song is too big to fit!"));
+		return false;
 	}
 
 	AllocateData();
@@ -600,9 +599,11 @@ void CCompiler::ExportPRG(CString FileName, bool EnablePAL)
 	OutputFile.Close();
 
 	Cleanup();
+
+	return true;
 }
 
-void CCompiler::ExportASM(CString FileName)
+bool CCompiler::ExportASM(CString FileName)
 {
 	CFileException ex;
 	CFile OutputFile;
@@ -611,7 +612,7 @@ void CCompiler::ExportASM(CString FileName)
 
 	// Build the music data
 	if (!CompileData())
-		return;
+		return false;
 
 	if (m_bBankSwitched) {
 		AllocateDataBankswitched();
@@ -635,8 +636,8 @@ void CCompiler::ExportASM(CString FileName)
 		ex.GetErrorMessage(szCause, 255);
 		strFormatted = _T("Could not open output file.\n\n");
 		strFormatted += szCause;
-		AfxMessageBox(strFormatted, MB_OK | MB_ICONERROR);
-		return;
+		Error(strFormatted);
+		return false;
 	}
 
 	Print("Writing output files...\n");
@@ -653,6 +654,8 @@ void CCompiler::ExportASM(CString FileName)
 	Cleanup();
 
 	Print("Done\n");
+
+	return true;
 }
 
 unsigned char *CCompiler::LoadDriver(const driver_t *pDriver, unsigned short Origin) const
@@ -698,10 +701,12 @@ void CCompiler::SetDriverSongAddress(unsigned char *pDriver, unsigned short Addr
 void CCompiler::PatchVibratoTable(unsigned char *pDriver)
 {
 	// Copy the vibrato table, the stock one only works for new vibrato mode
-	CSoundGen *pSoundGen = theApp.GetSoundGenerator();
+	int VibratoTable[VIBRATO_LENGTH];
+
+	CSoundGen::CalculateVibratoTable(m_pDocument->GetVibratoStyle(), VibratoTable);
 
 	for (int i = 0; i < 256; ++i) {
-		*(pDriver + m_iVibratoTableLocation + i) = (char)pSoundGen->ReadVibratoTable(i);
+		*(pDriver + m_iVibratoTableLocation + i) = (char)VibratoTable[i];
 	}
 }
 
@@ -1444,7 +1449,7 @@ void CCompiler::CreateInstrumentList()
 		}
 
 		// Returns number of bytes 
-		iTotalSize += pInstrument->Compile(pChunk, iIndex);
+		iTotalSize += pInstrument->Compile(pChunk, iIndex, m_pDocument);
 	}
 
 	Print(" * Instruments used: %i (%i bytes)\n", m_iInstruments, iTotalSize);
@@ -1726,28 +1731,16 @@ void CCompiler::StorePatterns(unsigned int Track, int *pPatternSize, int *pPatte
 				bool StoreNew = true;
 
 #ifdef REMOVE_DUPLICATE_PATTERNS
-				unsigned int Hash = PatternCompiler.GetHash();
+				QByteArray Data((const char*)PatternCompiler.GetData(), PatternCompiler.GetDataSize());
 				
-				// Check for duplicate patterns
-				CChunk *pDuplicate = m_PatternMap[Hash];
+				// Check for duplicate patterns, the map compares the whole data
+				CChunk *pDuplicate = m_PatternMap.value(Data, NULL);
 
 				if (pDuplicate != NULL) {
-					// Hash only indicates that patterns may be equal, check exact data
-					if (pDuplicate->GetStringLength(0) == PatternCompiler.GetDataSize()) {
-						StoreNew = false;
-						for (unsigned int k = 0; k < PatternCompiler.GetDataSize(); ++k) {
-							if (pDuplicate->GetStringData(0, k) != PatternCompiler.GetData(k)) {
-								StoreNew = true;
-								break;
-							}
-						}
-					}
-
-					if (!StoreNew) {
-						// Duplicate was found, store a reference to existing pattern
-						m_DuplicateMap[label] = pDuplicate->GetLabel();
-						++m_iDuplicatePatterns;
-					}
+					// Duplicate was found, store a reference to existing pattern
+					StoreNew = false;
+					m_DuplicateMap[label] = pDuplicate->GetLabel();
+					++m_iDuplicatePatterns;
 				}
 #endif
 
@@ -1757,7 +1750,7 @@ void CCompiler::StorePatterns(unsigned int Track, int *pPatternSize, int *pPatte
 					m_vPatternChunks.push_back(pChunk);
 
 #ifdef REMOVE_DUPLICATE_PATTERNS
-					m_PatternMap[Hash] = pChunk;
+					m_PatternMap.insert(Data, pChunk);
 #endif
 
 					// Get size
@@ -1792,7 +1785,7 @@ void CCompiler::StorePatterns(unsigned int Track, int *pPatternSize, int *pPatte
 
 #ifdef LOCAL_DUPLICATE_PATTERN_REMOVAL
 	// Forget patterns when one whole track is stored
-	m_PatternMap.RemoveAll();
+	m_PatternMap.clear();
 	m_DuplicateMap.RemoveAll();
 #endif
 
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <QByteArray>
+#include <QHash>
 #include <QString>
 
 #include "Chunk.h"
@@ -62,20 +64,32 @@ public:
 
 struct driver_t;
 
+/*
+ * Logger interface, lets the compiler report progress to a dialog or a console
+ */
+class CCompilerLog
+{
+public:
+	virtual ~CCompilerLog() {};
+	virtual void WriteLog(LPCTSTR text) = 0;
+	virtual void Clear() = 0;
+};
+
 /*
  * The compiler
  */
 class CCompiler
 {
 public:
-	CCompiler(CFamiTrackerDoc *pDoc, CEdit *pLogText);
+	CCompiler(CFamiTrackerDoc *pDoc, CCompilerLog *pLogger);
 	~CCompiler();
 
-	void	ExportNSF(CString FileName, int MachineType);
-	void	ExportNES(CString FileName, bool EnablePAL);
-	void	ExportBIN(CString BIN_File, CString DPCM_File);
-	void	ExportPRG(CString FileName, bool EnablePAL);
-	void	ExportASM(CString FileName);
+	// These return false if the export failed, the reason is written to the log
+	bool	ExportNSF(CString FileName, int MachineType);
+	bool	ExportNES(CString FileName, bool EnablePAL);
+	bool	ExportBIN(CString BIN_File, CString DPCM_File);
+	bool	ExportPRG(CString FileName, bool EnablePAL);
+	bool	ExportASM(CString FileName);
 
 private:
 	void	CreateHeader(stNSFHeader *pHeader, int MachineType);
@@ -143,8 +157,9 @@ private:
 	void	WriteFileString(CFile *pFile, CString &str);
 
 	// Debugging
-	void	Print(char *text, ...) const;
+	void	Print(const char *text, ...) const;
 	void	ClearLog() const;
+	void	Error(LPCTSTR text) const;
 
 public:
 	static const int PAGE_SIZE;
@@ -247,9 +262,9 @@ private:
 	unsigned int	m_iWaveTables;
 
 	// Optimization
-	CMap<UINT, UINT, CChunk*, CChunk*>		 m_PatternMap;
+	QHash<QByteArray, CChunk*>				 m_PatternMap;		// Keyed by compiled pattern data
 	CMap<CString, LPCTSTR, CString, LPCTSTR> m_DuplicateMap;
 
 	// Debugging
-	CEdit			*m_pLogText;
+	CCompilerLog	*m_pLogger;
 };
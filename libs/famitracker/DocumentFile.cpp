@@ -19,6 +19,7 @@
 */
 
 #include "stdafx.h"
+#include <QFile>
 #include "DocumentFile.h"
 
 //
@@ -41,13 +42,17 @@ const unsigned int CDocumentFile::BLOCK_SIZE = 0x10000;
 
 CDocumentFile::CDocumentFile() : 
 	m_pBlockData(NULL),
-	m_cBlockID(new char[16])
+	m_cBlockID(new char[16]),
+	m_pMapData(NULL),
+	m_iNextBlock(0),
+	m_bMappedBlock(false)
 {
 }
 
 CDocumentFile::~CDocumentFile()
 {
-	SAFE_RELEASE_ARRAY(m_pBlockData);
+	if (!m_bMappedBlock)
+		SAFE_RELEASE_ARRAY(m_pBlockData);
 	SAFE_RELEASE_ARRAY(m_cBlockID);
 }
 
@@ -203,10 +208,131 @@ unsigned int CDocumentFile::GetFileVersion() const
 	return m_iFileVersion & 0xFFFF;
 }
 
+bool CDocumentFile::MapFile(LPCTSTR lpszFileName)
+{
+	// Maps the file and indexes all blocks following the header, call after CheckValidity()
+	// Blocks are then read straight from the mapping. If the file can't be mapped or
+	// the block chain is broken the regular reading is used instead.
+
+#if UNICODE
+	QSharedPointer<QFile> pFile(new QFile(QString::fromWCharArray(lpszFileName)));
+#else
+	QSharedPointer<QFile> pFile(new QFile(lpszFileName));
+#endif
+
+	if (!pFile->open(QIODevice::ReadOnly))
+		return false;
+
+	qint64 Size = pFile->size();
+	const char *pData = (const char*)pFile->map(0, Size);
+
+	if (pData == NULL)
+		return false;
+
+	std::vector<stBlockInfo> Index;
+	qint64 Pos = GetPosition();
+
+	while (Pos < Size) {
+		stBlockInfo Block;
+		qint64 Left = Size - Pos;
+
+		memset(Block.ID, 0, 16);
+		memcpy(Block.ID, pData + Pos, (size_t)qMin<qint64>(Left, 16));
+
+		if (Left < 24) {
+			// Only the end marker has no block header
+			if (memcmp(Block.ID, FILE_END_ID, strlen(FILE_END_ID) + 1) != 0)
+				return false;
+			Block.Version = 0;
+			Block.Size = 0;
+			Block.Offset = Size;
+			Index.push_back(Block);
+			break;
+		}
+
+		memcpy(&Block.Version, pData + Pos + 16, sizeof(int));
+		memcpy(&Block.Size, pData + Pos + 20, sizeof(int));
+		Block.Offset = Pos + 24;
+
+		if (Block.Size > Size - Block.Offset)
+			return false;
+
+		Index.push_back(Block);
+		Pos = Block.Offset + Block.Size;
+	}
+
+	m_pMapFile = pFile;
+	m_pMapData = pData;
+	m_vBlockIndex.swap(Index);
+	m_iNextBlock = 0;
+
+	return true;
+}
+
+QSharedPointer<QFile> CDocumentFile::GetMapping() const
+{
+	// The mapping stays valid as long as a reference to the file is held
+	return m_pMapFile;
+}
+
+QByteArray CDocumentFile::GetBlockData(int Size)
+{
+	// Returns a part of the block, without copying when the file is mapped
+	ASSERT(m_iBlockPointer + Size <= m_iBlockSize);
+
+	QByteArray Data;
+
+	if (m_bMappedBlock)
+		Data = QByteArray::fromRawData(m_pBlockData + m_iBlockPointer, Size);
+	else
+		Data = QByteArray(m_pBlockData + m_iBlockPointer, Size);
+
+	m_iBlockPointer += Size;
+
+	return Data;
+}
+
+bool CDocumentFile::ReadMappedBlock()
+{
+	m_iBlockPointer = 0;
+
+	if (m_iNextBlock >= m_vBlockIndex.size()) {
+		memset(m_cBlockID, 0, 16);
+		m_bFileDone = true;
+		return false;
+	}
+
+	const stBlockInfo &Block = m_vBlockIndex[m_iNextBlock++];
+
+	memcpy(m_cBlockID, Block.ID, 16);
+	m_iBlockVersion = Block.Version;
+	m_iBlockSize = Block.Size;
+
+	if (m_iBlockSize > 50000000) {
+		// File is probably corrupt
+		memset(m_cBlockID, 0, 16);
+		return true;
+	}
+
+	if (!m_bMappedBlock)
+		SAFE_RELEASE_ARRAY(m_pBlockData);
+
+	m_pBlockData = const_cast<char*>(m_pMapData + Block.Offset);
+	m_bMappedBlock = true;
+
+	if (strcmp(m_cBlockID, FILE_END_ID) == 0)
+		m_bFileDone = true;
+
+	return false;
+}
+
 bool CDocumentFile::ReadBlock()
 {
 	int BytesRead;
 
+	if (m_pMapData != NULL)
+		return ReadMappedBlock();
+
 	m_iBlockPointer = 0;
 	
 	memset(m_cBlockID, 0, 16);
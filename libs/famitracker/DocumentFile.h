@@ -20,6 +20,12 @@
 
 #pragma once
 
+#include <vector>
+#include <QByteArray>
+#include <QSharedPointer>
+
+class QFile;
+
 // CDocumentFile
 
 class CDocumentFile : public CFile
@@ -45,6 +51,10 @@ public:
 	bool		CheckValidity();
 	unsigned int GetFileVersion() const;
 
+	bool		MapFile(LPCTSTR lpszFileName);
+	QSharedPointer<QFile> GetMapping() const;
+	QByteArray	GetBlockData(int Size);
+
 	bool		ReadBlock();
 	void		GetBlock(void *Buffer, int Size);
 	int			GetBlockVersion() const;
@@ -73,8 +83,18 @@ public:
 	static const unsigned int MAX_BLOCK_SIZE;
 	static const unsigned int BLOCK_SIZE;
 
+protected:
+	// Location of a block in a mapped file
+	struct stBlockInfo {
+		char			ID[16];
+		unsigned int	Version;
+		unsigned int	Size;
+		qint64			Offset;
+	};
+
 protected:
 	void ReallocateBlock();
+	bool ReadMappedBlock();
 
 protected:
 	unsigned int	m_iFileVersion;
@@ -89,4 +109,11 @@ protected:
 	unsigned int	m_iMaxBlockSize;
 
 	unsigned int	m_iBlockPointer;	
+
+	// Memory mapped reading, block data points directly into the file
+	QSharedPointer<QFile>		m_pMapFile;
+	const char					*m_pMapData;
+	std::vector<stBlockInfo>	m_vBlockIndex;
+	unsigned int				m_iNextBlock;
+	bool						m_bMappedBlock;
 };
@@ -32,6 +32,43 @@
 #include "Compiler.h"
 #include "Settings.h"
 #include "CustomExporters.h"
+#include "SoundGen.h"
+#include "WavProgressDlg.h"
+
+// Compiler logger that writes to the output box of the dialog
+class CEditLog : public CCompilerLog
+{
+public:
+	CEditLog(CEdit *pEdit) : m_pEdit(pEdit) {};
+	void WriteLog(LPCTSTR text);
+	void Clear();
+private:
+	CEdit *m_pEdit;
+};
+
+void CEditLog::WriteLog(LPCTSTR text)
+{
+	// Edit boxes need CRLF line endings
+	TCHAR buf[512];
+	int Pos = 0;
+
+	for (int i = 0; text[i] && Pos < 510; ++i) {
+		if (text[i] == _T('\n') && (i == 0 || text[i - 1] != _T('\r')))
+			buf[Pos++] = _T('\r');
+		buf[Pos++] = text[i];
+	}
+	buf[Pos] = 0;
+
+	int Len = m_pEdit->GetWindowTextLength();
+	m_pEdit->SetSel(Len, Len, 0);
+	m_pEdit->ReplaceSel(buf, 0);
+	m_pEdit->RedrawWindow();
+}
+
+void CEditLog::Clear()
+{
+	m_pEdit->SetWindowText(_T(""));
+}
 
 
 // Define internal exporters
@@ -41,6 +78,7 @@ const LPTSTR CExportDialog::DEFAULT_EXPORT_NAMES[] = {
 	_T("BIN - Raw music data"),
 	_T("PRG - Clean 32kB ROM image"),
 	_T("ASM - Assembly source"),
+	_T("WAV - One file per channel"),
 };
 
 const exportFunc_t CExportDialog::DEFAULT_EXPORT_FUNCS[] = {
@@ -49,9 +87,10 @@ const exportFunc_t CExportDialog::DEFAULT_EXPORT_FUNCS[] = {
 	&CExportDialog::CreateBIN,
 	&CExportDialog::CreatePRG,
 	&CExportDialog::CreateASM,
+	&CExportDialog::CreateStems,
 };
 
-const int CExportDialog::DEFAULT_EXPORTERS = 5;
+const int CExportDialog::DEFAULT_EXPORTERS = 6;
 
 // Remember last option when dialog is closed
 int CExportDialog::m_iExportOption = 0;
@@ -62,6 +101,7 @@ LPCTSTR CExportDialog::NES_FILTER[]   = { _T("NES ROM image (*.nes)"), _T(".nes"
 LPCTSTR CExportDialog::RAW_FILTER[]   = { _T("Raw song data (*.bin)"), _T(".bin") };
 LPCTSTR CExportDialog::DPCMS_FILTER[] = { _T("DPCM sample bank (*.bin)"), _T(".bin") };
 LPCTSTR CExportDialog::PRG_FILTER[]   = { _T("NES program bank (*.prg)"), _T(".prg") };
+LPCTSTR CExportDialog::WAV_FILTER[]   = { _T("Microsoft PCM files (*.wav)"), _T(".wav") };
 
 // CExportDialog dialog
 
@@ -176,7 +216,8 @@ void CExportDialog::CreateNSF()
 {
 	CFamiTrackerDoc *pDoc = (CFamiTrackerDoc*)((CFrameWnd*) GetParent())->GetActiveDocument();
 	CString	DefFileName = pDoc->GetFileTitle();
-	CCompiler Compiler(pDoc, (CEdit*)GetDlgItem(IDC_OUTPUT));
+	CEditLog Log((CEdit*)GetDlgItem(IDC_OUTPUT));
+	CCompiler Compiler(pDoc, &Log);
 	CString Name, Artist, Copyright;
 	CString filter = LoadDefaultFilter(NSF_FILTER[0], NSF_FILTER[1]);
 	int MachineType = 0;
@@ -214,7 +255,8 @@ void CExportDialog::CreateNES()
 {
 	CFamiTrackerDoc *pDoc = (CFamiTrackerDoc*)((CFrameWnd*) GetParent())->GetActiveDocument();
 	CString	DefFileName = pDoc->GetFileTitle();
-	CCompiler Compiler(pDoc, (CEdit*)GetDlgItem(IDC_OUTPUT));
+	CEditLog Log((CEdit*)GetDlgItem(IDC_OUTPUT));
+	CCompiler Compiler(pDoc, &Log);
 	CString filter = LoadDefaultFilter(NES_FILTER[0], NES_FILTER[1]);
 
 	CFileDialog FileDialog(FALSE, NES_FILTER[1], DefFileName, OFN_HIDEREADONLY | OFN_OVERWRITEPROMPT, filter);
@@ -235,7 +277,8 @@ void CExportDialog::CreateNES()
 void CExportDialog::CreateBIN()
 {
 	CFamiTrackerDoc *pDoc = (CFamiTrackerDoc*)((CFrameWnd*) GetParent())->GetActiveDocument();
-	CCompiler Compiler(pDoc, (CEdit*)GetDlgItem(IDC_OUTPUT));
+	CEditLog Log((CEdit*)GetDlgItem(IDC_OUTPUT));
+	CCompiler Compiler(pDoc, &Log);
 	CString MusicFilter = LoadDefaultFilter(RAW_FILTER[0], RAW_FILTER[1]);
 	CString DPCMFilter = LoadDefaultFilter(DPCMS_FILTER[0], DPCMS_FILTER[1]);
 
@@ -263,7 +306,8 @@ void CExportDialog::CreateBIN()
 void CExportDialog::CreatePRG()
 {
 	CFamiTrackerDoc *pDoc = (CFamiTrackerDoc*)((CFrameWnd*) GetParent())->GetActiveDocument();
-	CCompiler Compiler(pDoc, (CEdit*)GetDlgItem(IDC_OUTPUT));
+	CEditLog Log((CEdit*)GetDlgItem(IDC_OUTPUT));
+	CCompiler Compiler(pDoc, &Log);
 	CString Filter = LoadDefaultFilter(PRG_FILTER[0], PRG_FILTER[1]);
 
 	CFileDialog FileDialog(FALSE, PRG_FILTER[1], _T("music.prg"), OFN_HIDEREADONLY | OFN_OVERWRITEPROMPT, Filter);
@@ -285,7 +329,8 @@ void CExportDialog::CreateASM()
 {
 	// Currently not included
 	CFamiTrackerDoc *pDoc = (CFamiTrackerDoc*)((CFrameWnd*) GetParent())->GetActiveDocument();
-	CCompiler Compiler(pDoc, (CEdit*)GetDlgItem(IDC_OUTPUT));
+	CEditLog Log((CEdit*)GetDlgItem(IDC_OUTPUT));
+	CCompiler Compiler(pDoc, &Log);
 
 	CFileDialog FileDialogMusic(FALSE, _T("asm"), _T("music.asm"), OFN_HIDEREADONLY | OFN_OVERWRITEPROMPT, _T("Song data in text format (*.asm)|*.asm|All files|*.*||"));
 
@@ -302,6 +347,44 @@ void CExportDialog::CreateASM()
 	theApp.GetSettings()->SetPath(FileDialogMusic.GetPathName(), PATH_NSF);
 }
 
+void CExportDialog::CreateStems()
+{
+	CFamiTrackerDoc *pDoc = (CFamiTrackerDoc*)((CFrameWnd*) GetParent())->GetActiveDocument();
+	CString	DefFileName = pDoc->GetFileTitle();
+	CEditLog Log((CEdit*)GetDlgItem(IDC_OUTPUT));
+	CString Filter = LoadDefaultFilter(WAV_FILTER[0], WAV_FILTER[1]);
+	CWavProgressDlg ProgressDlg;
+
+	CFileDialog FileDialog(FALSE, WAV_FILTER[1], DefFileName, OFN_HIDEREADONLY | OFN_OVERWRITEPROMPT, Filter);
+
+	FileDialog.m_pOFN->lpstrInitialDir = theApp.GetSettings()->GetPath(PATH_WAV);
+
+	if (FileDialog.DoModal() == IDCANCEL)
+		return;
+
+	// The selected track is played once, each channel is saved next to the chosen file
+	ProgressDlg.SetFile(FileDialog.GetPathName());
+	ProgressDlg.SetOptions(SONG_LOOP_LIMIT, 1);
+	ProgressDlg.SetStems(true);
+	ProgressDlg.DoModal();
+
+	CSoundGen *pSoundGen = theApp.GetSoundGenerator();
+
+	// In case the dialog was closed before the files were done, this
+	// only waits for the jobs to finish their current frame
+	pSoundGen->StopRenderingStems();
+	pSoundGen->EndRenderingStems();
+
+	int Done, Failed, Total;
+	pSoundGen->GetStemRenderStat(Done, Failed, Total);
+
+	CString Text;
+	Text.Format(_T("Saved %i of %i channel files\n"), Done - Failed, Total);
+	Log.WriteLog(Text);
+
+	theApp.GetSettings()->SetPath(FileDialog.GetPathName(), PATH_WAV);
+}
+
 void CExportDialog::CreateCustom( CString name )
 {
 	theApp.GetCustomExporters()->SetCurrentExporter( name );
@@ -334,7 +417,8 @@ void CExportDialog::OnBnClickedPlay()
 	char *file = "d:\\test.nsf";
 
 	CFamiTrackerDoc *pDoc = CFamiTrackerDoc::GetDoc();
-	CCompiler Compiler(pDoc, (CEdit*)GetDlgItem(IDC_OUTPUT));
+	CEditLog Log((CEdit*)GetDlgItem(IDC_OUTPUT));
+	CCompiler Compiler(pDoc, &Log);
 
 	Compiler.ExportNSF(file, (IsDlgButtonChecked(IDC_PAL) != 0));
 
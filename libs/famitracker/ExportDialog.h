@@ -60,6 +60,7 @@ protected:
 	static LPCTSTR RAW_FILTER[2];
 	static LPCTSTR DPCMS_FILTER[2];
 	static LPCTSTR PRG_FILTER[2];
+	static LPCTSTR WAV_FILTER[2];
 
 #ifdef _DEBUG
 	CString m_strFile;
@@ -72,6 +73,7 @@ protected:
 	void CreateBIN();
 	void CreatePRG();
 	void CreateASM();
+	void CreateStems();
 	void CreateCustom( CString name );
 
 	DECLARE_MESSAGE_MAP()
@@ -1,64 +1,79 @@
 //------------------------------------
 //  fft.cpp
-//  The implementation of the 
+//  The implementation of the
 //  Fast Fourier Transform algorithm
 //  (c) Reliable Software, 1996
 //------------------------------------
-#include <memory>
+#include <math.h>
 #include <string.h>
 #include "Fft.h"
-//#include "recorder.h"
 
-// log (1) = 0, log(2) = 1, log(3) = 2, log(4) = 2 ...
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FFT_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define FFT_NEON
+#endif
 
 #define PI (2.0 * asin(1.0))
 
 // Points must be a power of 2
+//
+// N real samples are packed into N/2 complex values (even samples
+// in the real part, odd in the imaginary part), transformed and then
+// split into the spectrum of the real signal:
+//
+//  X[k] = E[k] + W^k O[k],  W = exp (-2 PI i / N)
+//  E[k] = (Z[k] + Z*[N/2-k]) / 2
+//  O[k] = (Z[k] - Z*[N/2-k]) / 2i
+//
 
 Fft::Fft (int Points, long sampleRate)
 : _Points (Points), _sampleRate (sampleRate)
 {
-    _aTape = new double [_Points];
-#if 0
-    // 1 kHz calibration wave
-    for (int i = 0; i < _Points; i++)
-        _aTape[i] = 1600 * sin (2 * PI * 1000. * i / _sampleRate);
-#else
+    _halfPoints = _Points / 2;
+    _sqrtPoints = (float) sqrt((double)_Points);
+
+    _aTape = new float [_Points];
+    memset (_aTape, 0, _Points * sizeof(float));
+
+    // Hann window, scaled by 2 to keep the level of a sine wave
+    _aWindow = new float [_Points];
     for (int i = 0; i < _Points; i++)
-        _aTape[i] = 0;
-#endif
-    _sqrtPoints = sqrt((double)_Points);
-    // calculate binary log
-    _logPoints = 0;
-    Points--;
-    while (Points != 0)
-    {
-        Points >>= 1;
-        _logPoints++;
-    }
+        _aWindow[i] = (float) (1.0 - cos (2. * PI * i / _Points));
 
-    _aBitRev = new int [_Points];
-    _X = new Complex[_Points];
-    _W = new Complex* [_logPoints+1];
-    // Precompute complex exponentials
-    int _2_l = 2;
-    for (int l = 1; l <= _logPoints; l++)
-    {
-        _W[l] = new Complex [_Points];
+    _aRe = new float [_halfPoints];
+    _aIm = new float [_halfPoints];
+    _aMag = new float [_halfPoints + 1];
+    memset (_aMag, 0, (_halfPoints + 1) * sizeof(float));
 
-        for ( int i = 0; i < _Points; i++ )
+    // Precompute complex exponentials, the level with a step of s
+    // uses exp (-2 PI i k / 2s) for k < s stored at [s + k]
+    _aWRe = new float [_halfPoints];
+    _aWIm = new float [_halfPoints];
+    for (int step = 1; step < _halfPoints; step *= 2)
+    {
+        for (int k = 0; k < step; k++)
         {
-            double re =  cos (2. * PI * i / _2_l);
-            double im = -sin (2. * PI * i / _2_l);
-            _W[l][i] = Complex (re, im);
+            _aWRe[step + k] = (float)  cos (PI * k / step);
+            _aWIm[step + k] = (float) -sin (PI * k / step);
         }
-        _2_l *= 2;
+    }
+
+    _aSplitRe = new float [_halfPoints + 1];
+    _aSplitIm = new float [_halfPoints + 1];
+    for (int k = 0; k <= _halfPoints; k++)
+    {
+        _aSplitRe[k] = (float)  cos (2. * PI * k / _Points);
+        _aSplitIm[k] = (float) -sin (2. * PI * k / _Points);
     }
 
     // set up bit reverse mapping
+    _aBitRev = new int [_halfPoints];
     int rev = 0;
-    int halfPoints = _Points/2;
-    for (int i = 0; i < _Points - 1; i++)
+    int halfPoints = _halfPoints/2;
+    for (int i = 0; i < _halfPoints - 1; i++)
     {
         _aBitRev[i] = rev;
         int mask = halfPoints;
@@ -70,87 +85,125 @@ Fft::Fft (int Points, long sampleRate)
         }
         rev += mask;
     }
-    _aBitRev [_Points-1] = _Points-1;
+    _aBitRev [_halfPoints-1] = _halfPoints-1;
 }
 
 Fft::~Fft()
 {
     delete []_aTape;
+    delete []_aWindow;
     delete []_aBitRev;
-    for (int l = 1; l <= _logPoints; l++)
-    {
-        delete []_W[l];
-    }
-    delete []_W;
-    delete []_X;
+    delete []_aRe;
+    delete []_aIm;
+    delete []_aWRe;
+    delete []_aWIm;
+    delete []_aSplitRe;
+    delete []_aSplitIm;
+    delete []_aMag;
 }
 
-void Fft::CopyIn (/*SampleIter& iter*/ int SampleCount, int *Samples)
+void Fft::CopyIn (int SampleCount, const int *Samples)
 {
-//    int cSample = iter.Count();
-	int cSample = SampleCount;
-    if (cSample > _Points)
-        return;
+    // Only the last Points samples are needed
+    if (SampleCount > _Points)
+    {
+        Samples += SampleCount - _Points;
+        SampleCount = _Points;
+    }
 
-    // make space for cSample samples at the end of tape
+    // make space for SampleCount samples at the end of tape
     // shifting previous samples towards the beginning
-    memmove (_aTape, &_aTape[cSample], 
-              (_Points - cSample) * sizeof(double));
-    // copy samples from iterator to tail end of tape
-    int iTail  = _Points - cSample;
-    for (int i = 0; i < cSample; i++/*, iter.Advance()*/)
+    memmove (_aTape, &_aTape[SampleCount],
+              (_Points - SampleCount) * sizeof(float));
+    // copy samples to tail end of tape
+    int iTail  = _Points - SampleCount;
+    for (int i = 0; i < SampleCount; i++)
     {
-        _aTape [i + iTail] = (double) /*iter.GetSample()*/ Samples[i];
+        _aTape [i + iTail] = (float) Samples[i];
     }
-    // Initialize the FFT buffer
-    for (int i = 0; i < _Points; i++)
-        PutAt (i, _aTape[i]);
 }
 
-//
-//               0   1   2   3   4   5   6   7
-//  level   1
-//  step    1                                     0
-//  increm  2                                   W 
-//  j = 0        <--->   <--->   <--->   <--->   1
-//  level   2
-//  step    2
-//  increm  4                                     0
-//  j = 0        <------->       <------->      W      1
-//  j = 1            <------->       <------->   2   W
-//  level   3                                         2
-//  step    4
-//  increm  8                                     0
-//  j = 0        <--------------->              W      1
-//  j = 1            <--------------->           3   W      2
-//  j = 2                <--------------->            3   W      3
-//  j = 3                    <--------------->             3   W
-//                                                              3
-//
-
 void Fft::Transform ()
 {
-    // step = 2 ^ (level-1)
-    // increm = 2 ^ level;
-    int step = 1;
-    for (int level = 1; level <= _logPoints; level++)
+    // Window the tape into the FFT buffer
+    for (int i = 0; i < _halfPoints; i++)
+    {
+        int j = _aBitRev[i];
+        _aRe[j] = _aTape[2 * i] * _aWindow[2 * i];
+        _aIm[j] = _aTape[2 * i + 1] * _aWindow[2 * i + 1];
+    }
+
+    Butterflies ();
+
+    // Split into the real spectrum
+    for (int k = 0; k <= _halfPoints; k++)
+    {
+        int a = (k == _halfPoints) ? 0 : k;
+        int b = (k == 0) ? 0 : _halfPoints - k;
+        float zr = _aRe[a], zi = _aIm[a];
+        float cr = _aRe[b], ci = -_aIm[b];
+        float er = 0.5f * (zr + cr), ei = 0.5f * (zi + ci);
+        float dr = 0.5f * (zr - cr), di = 0.5f * (zi - ci);
+        // O = D / i
+        float or_ = di, oi = -dr;
+        float xr = er + _aSplitRe[k] * or_ - _aSplitIm[k] * oi;
+        float xi = ei + _aSplitRe[k] * oi + _aSplitIm[k] * or_;
+        _aMag[k] = sqrtf (xr * xr + xi * xi) / _sqrtPoints;
+    }
+}
+
+void Fft::Butterflies ()
+{
+    float *re = _aRe, *im = _aIm;
+
+    for (int step = 1; step < _halfPoints; step *= 2)
     {
         int increm = step * 2;
-        for (int j = 0; j < step; j++)
+        const float *wre = _aWRe + step;
+        const float *wim = _aWIm + step;
+
+        for (int i = 0; i < _halfPoints; i += increm)
         {
-            // U = exp ( - 2 PI j / 2 ^ level )
-            Complex U = _W [level][j];
-            for (int i = j; i < _Points; i += increm)
+            float *ar = re + i, *ai = im + i;
+            float *br = re + i + step, *bi = im + i + step;
+            int j = 0;
+#if defined(FFT_SSE2)
+            for (; j + 4 <= step; j += 4)
+            {
+                __m128 ur = _mm_loadu_ps (wre + j), ui = _mm_loadu_ps (wim + j);
+                __m128 xr = _mm_loadu_ps (br + j), xi = _mm_loadu_ps (bi + j);
+                __m128 tr = _mm_sub_ps (_mm_mul_ps (xr, ur), _mm_mul_ps (xi, ui));
+                __m128 ti = _mm_add_ps (_mm_mul_ps (xr, ui), _mm_mul_ps (xi, ur));
+                __m128 yr = _mm_loadu_ps (ar + j), yi = _mm_loadu_ps (ai + j);
+                _mm_storeu_ps (br + j, _mm_sub_ps (yr, tr));
+                _mm_storeu_ps (bi + j, _mm_sub_ps (yi, ti));
+                _mm_storeu_ps (ar + j, _mm_add_ps (yr, tr));
+                _mm_storeu_ps (ai + j, _mm_add_ps (yi, ti));
+            }
+#elif defined(FFT_NEON)
+            for (; j + 4 <= step; j += 4)
+            {
+                float32x4_t ur = vld1q_f32 (wre + j), ui = vld1q_f32 (wim + j);
+                float32x4_t xr = vld1q_f32 (br + j), xi = vld1q_f32 (bi + j);
+                float32x4_t tr = vmlsq_f32 (vmulq_f32 (xr, ur), xi, ui);
+                float32x4_t ti = vmlaq_f32 (vmulq_f32 (xr, ui), xi, ur);
+                float32x4_t yr = vld1q_f32 (ar + j), yi = vld1q_f32 (ai + j);
+                vst1q_f32 (br + j, vsubq_f32 (yr, tr));
+                vst1q_f32 (bi + j, vsubq_f32 (yi, ti));
+                vst1q_f32 (ar + j, vaddq_f32 (yr, tr));
+                vst1q_f32 (ai + j, vaddq_f32 (yi, ti));
+            }
+#endif
+            for (; j < step; j++)
             {
                 // butterfly
-                Complex T = U;
-                T *= _X [i+step];
-                _X [i+step] = _X[i];
-                _X [i+step] -= T;
-                _X [i] += T;
+                float tr = br[j] * wre[j] - bi[j] * wim[j];
+                float ti = br[j] * wim[j] + bi[j] * wre[j];
+                br[j] = ar[j] - tr;
+                bi[j] = ai[j] - ti;
+                ar[j] += tr;
+                ai[j] += ti;
             }
         }
-        step *= 2;
     }
 }
-
@@ -4,13 +4,11 @@
 //  fft.h
 //  Fast Fourier Transform
 //  (c) Reliable Software, 1996
+//
+//  Real input version: the tape is windowed and
+//  transformed as a half size complex FFT
 //------------------------------------
 
-#include "Complex.h"
-//#include "assert.h"
-
-class SampleIter;
-
 class Fft
 {
 public:
@@ -18,50 +16,52 @@ public:
     ~Fft ();
     int     Points () const { return _Points; }
     void    Transform ();
-    void    CopyIn (/*SampleIter& iter*/int SampleCount, int *Samples);
+    void    CopyIn (int SampleCount, const int *Samples);
 
     double  GetIntensity (int i) const
-    { 
-  //      Assert (i < _Points);
-        return _X[i].Mod()/_sqrtPoints; 
+    {
+        // Spectrum of real input is symmetric
+        if (i > _Points / 2)
+            i = _Points - i;
+        return _aMag[i];
     }
 
     int     GetFrequency (int point) const
     {
         // return frequency in Hz of a given point
-//        Assert (point < _Points);
         long x =_sampleRate * point;
         return x / _Points;
     }
 
-    int     HzToPoint (int freq) const 
-    { 
-        return (long)_Points * freq / _sampleRate; 
+    int     HzToPoint (int freq) const
+    {
+        return (long)_Points * freq / _sampleRate;
     }
 
     int     MaxFreq() const { return _sampleRate; }
 
     int     Tape (int i) const
     {
-//        Assert (i < _Points);
         return (int) _aTape[i];
     }
 
 private:
+    void    Butterflies ();
 
-    void PutAt ( int i, double val )
-    {
-        _X [_aBitRev[i]] = Complex (val);
-    }
-
-    int			_Points;
-    long		_sampleRate;
-    int			_logPoints;
-    double		_sqrtPoints;
-    int		   *_aBitRev;       // bit reverse vector
-    Complex	   *_X;             // in-place fft array
-    Complex	  **_W;             // exponentials
-    double     *_aTape;         // recording tape
+    int         _Points;
+    long        _sampleRate;
+    int         _halfPoints;
+    float       _sqrtPoints;
+    int        *_aBitRev;       // bit reverse vector, half size
+    float      *_aWindow;       // analysis window
+    float      *_aTape;         // recording tape
+    float      *_aRe;           // in-place fft arrays, half size
+    float      *_aIm;
+    float      *_aWRe;          // butterfly twiddles, level with step s at [s, 2s)
+    float      *_aWIm;
+    float      *_aSplitRe;      // twiddles for splitting the real spectrum
+    float      *_aSplitIm;
+    float      *_aMag;          // magnitudes, 0 to Points/2
 };
 
 #endif
@@ -49,9 +49,6 @@
 #include "SoundGen.h"
 #include "ChannelMap.h"
 
-// Self-referential static
-CFamiTrackerDoc* CFamiTrackerDoc::_this = NULL;
-
 #define GET_PATTERN(Frame, Channel) m_pSelectedTune->GetFramePattern(Frame, Channel)
 
 // Defaults when creating new modules
@@ -247,9 +244,6 @@ static int GetChipFromInstrument(int Type)
 CFamiTrackerDoc::CFamiTrackerDoc(QObject* parent)
 	: QObject(parent),m_iVersion(CLASS_VERSION), m_bFileLoaded(false), m_bFileLoadFailed(false), m_iRegisteredChannels(0), m_iNamcoChannels(DEFAULT_NAMCO_CHANS)
 {
-   // Initialize object
-   _this = this;
-
 	for (int i = 0; i < MAX_DSAMPLES; ++i) {
 		m_DSamples[i].SampleSize = 0;
 		m_DSamples[i].SampleData = NULL;
@@ -426,9 +420,14 @@ void CFamiTrackerDoc::DeleteContents()
 
 	UpdateAllViews(NULL, CLOSE_DOCUMENT);
 
-	// Make sure player is stopped
-	theApp.OnTrackerStop();
-	theApp.GetSoundGenerator()->WaitForStop();
+	// Make sure player is stopped. Only the document assigned to the sound
+	// generator is played, imported documents may be cleared on any thread.
+	CSoundGen *pSoundGen = theApp.GetSoundGenerator();
+
+	if (pSoundGen && pSoundGen->GetDocument() == this) {
+		theApp.OnTrackerStop();
+		pSoundGen->WaitForStop();
+	}
 
    // DPCM samples
 	for (int i = 0; i < MAX_DSAMPLES; ++i) {
@@ -863,6 +862,12 @@ BOOL CFamiTrackerDoc::SaveDocument(LPCTSTR lpszPathName) const
 		return FALSE;
 	}
 
+	// Patterns not yet decoded may point into the file that is about to be overwritten
+	for (unsigned int i = 0; i <= m_iTracks; ++i) {
+		if (m_pTunes[i] != NULL)
+			m_pTunes[i]->DetachPackedPatterns();
+	}
+
 	// First write to a temp file (if saving fails, the original is not destroyed)
 //	GetTempPath(MAX_PATH, TempPath);
 //	GetTempFileName(TempPath, _T("FTM"), 0, TempFile);
@@ -1371,6 +1376,17 @@ bool CFamiTrackerDoc::WriteBlock_Patterns(CDocumentFile *pDocFile) const
 			for (unsigned x = 0; x < MAX_PATTERN; ++x) {
 				unsigned Items = 0;
 
+				// Patterns that haven't been touched since loading are written back as they were
+				const stPackedPattern *pPacked = m_pTunes[t]->GetPackedPattern(i, x);
+				if (pPacked != NULL && pPacked->EffColumns == unsigned(m_pTunes[t]->GetEffectColumnCount(i) + 1)) {
+					pDocFile->WriteBlockInt(t);
+					pDocFile->WriteBlockInt(i);
+					pDocFile->WriteBlockInt(x);
+					pDocFile->WriteBlockInt(pPacked->Items);
+					pDocFile->WriteBlock(pPacked->Data.constData(), pPacked->Data.size());
+					continue;
+				}
+
 				// Save all rows
 				unsigned int PatternLen = MAX_PATTERN_LENGTH;
 				//unsigned int PatternLen = m_pTunes[t]->GetPatternLength();
@@ -1495,6 +1511,9 @@ BOOL CFamiTrackerDoc::OpenDocument(LPCTSTR lpszPathName)
 		if (!OpenDocumentOld(&OpenFile))
 			return FALSE;
 
+		// Old files are 2A03 only, register the channels here since the header block is missing
+		SetupChannels(SNDCHIP_NONE);
+
 		// Create a backup of this file, since it's an old version
 		// and something might go wrong when converting
 		//bForceBackup = true;
@@ -1507,6 +1526,9 @@ BOOL CFamiTrackerDoc::OpenDocument(LPCTSTR lpszPathName)
 	else if (iVersion >= 0x0200) {
 		// New file version
 
+		// Read blocks from a mapping of the file when possible
+		OpenFile.MapFile(lpszPathName);
+
 		// Try to open file, create new if it fails
 		if (!OpenDocumentNew(OpenFile))
 			return FALSE;
@@ -2358,6 +2380,13 @@ bool CFamiTrackerDoc::ReadBlock_Patterns(CDocumentFile *pDocFile)
 {
 	unsigned int Version = pDocFile->GetBlockVersion();
 
+	// Patterns in the current format are kept packed until used, older versions are converted here
+#ifdef TRANSPOSE_FDS
+	bool bPacked = (Version >= 5) && (m_iFileVersion != 0x0200);
+#else
+	bool bPacked = (Version >= 4) && (m_iFileVersion != 0x0200);
+#endif
+
 	if (Version == 1) {
 		int PatternLen = pDocFile->GetBlockInt();
 		ASSERT_FILE_DATA(PatternLen <= MAX_PATTERN_LENGTH);
@@ -2385,6 +2414,31 @@ bool CFamiTrackerDoc::ReadBlock_Patterns(CDocumentFile *pDocFile)
 
 		SwitchToTrack(Track);
 
+		if (bPacked) {
+			unsigned int EffColumns = m_pSelectedTune->GetEffectColumnCount(Channel) + 1;
+			unsigned int ItemSize = sizeof(int) + 4 + EffColumns * 2;
+
+			ASSERT_FILE_DATA(Items * ItemSize <= unsigned(pDocFile->GetBlockSize() - pDocFile->GetBlockPos()));
+
+			QByteArray Data = pDocFile->GetBlockData(Items * ItemSize);
+
+			// Only the rows are checked here
+			for (unsigned i = 0; i < Items; ++i) {
+				unsigned Row;
+				memcpy(&Row, Data.constData() + i * ItemSize, sizeof(int));
+				ASSERT_FILE_DATA(Row < MAX_PATTERN_LENGTH);
+			}
+
+			stPackedPattern *pPacked = new stPackedPattern;
+			pPacked->Data = Data;
+			pPacked->Items = Items;
+			pPacked->EffColumns = EffColumns;
+			pPacked->File = pDocFile->GetMapping();
+
+			m_pSelectedTune->SetPackedPattern(Channel, Pattern, pPacked);
+			continue;
+		}
+
 		for (unsigned i = 0; i < Items; ++i) {
 			unsigned Row;
 			if (m_iFileVersion == 0x0200)
@@ -2536,7 +2590,8 @@ bool CFamiTrackerDoc::ReadBlock_DSamples(CDocumentFile *pDocFile)
 
 CFamiTrackerDoc *CFamiTrackerDoc::LoadImportFile(LPCTSTR lpszPathName)
 {
-	// Import a module as new subtunes
+	// Load a module into a new document, for importing as new subtunes
+	// or for command line tools that have no GUI document
 	CFamiTrackerDoc *pImported = new CFamiTrackerDoc();
 
 	pImported->DeleteContents();
@@ -3518,6 +3573,15 @@ void CFamiTrackerDoc::GetDataAtPattern(unsigned int Track, unsigned int Pattern,
 	memcpy(Data, m_pTunes[Track]->GetPatternData(Channel, Pattern, Row), sizeof(stChanNote));
 }
 
+void CFamiTrackerDoc::UnpackTrackPatterns(unsigned int Track)
+{
+	ASSERT(Track < MAX_TRACKS);
+
+	// Patterns are decoded on first access, do it up front before the track is read from other threads
+	AllocateSong(Track);
+	m_pTunes[Track]->UnpackFramePatterns();
+}
+
 unsigned int CFamiTrackerDoc::GetNoteEffectType(unsigned int Frame, unsigned int Channel, unsigned int Row, int Index) const
 {
 	ASSERT(Frame < MAX_FRAMES);
@@ -4050,7 +4114,12 @@ void CFamiTrackerDoc::SetupChannels(unsigned char Chip)
 	m_iExpansionChip = Chip;
 
 	// Register the channels
-	theApp.GetSoundGenerator()->RegisterChannels(Chip, this); 
+	CSoundGen *pSoundGen = theApp.GetSoundGenerator();
+
+	if (pSoundGen)
+		pSoundGen->RegisterChannels(Chip, this); 
+	else
+		RegisterChannelTypes(Chip);
 
 	m_iChannelsAvailable = GetChannelCount();
 
@@ -4061,13 +4130,44 @@ void CFamiTrackerDoc::SetupChannels(unsigned char Chip)
 	// Must call ApplyExpansionChip after this
 }
 
+void CFamiTrackerDoc::RegisterChannelTypes(unsigned char Chip)
+{
+	// Used when there is no sound generator (command line tools), channel types and
+	// chips are registered the same way the sound generator does but without tracker channels
+
+	// Chip for each channel ID
+	static const int CHANNEL_CHIP[CHANNELS] = {
+		SNDCHIP_NONE, SNDCHIP_NONE, SNDCHIP_NONE, SNDCHIP_NONE, SNDCHIP_NONE,
+		SNDCHIP_VRC6, SNDCHIP_VRC6, SNDCHIP_VRC6,
+		SNDCHIP_MMC5, SNDCHIP_MMC5, SNDCHIP_MMC5,
+		SNDCHIP_N163, SNDCHIP_N163, SNDCHIP_N163, SNDCHIP_N163, SNDCHIP_N163, SNDCHIP_N163, SNDCHIP_N163, SNDCHIP_N163,
+		SNDCHIP_FDS,
+		SNDCHIP_VRC7, SNDCHIP_VRC7, SNDCHIP_VRC7, SNDCHIP_VRC7, SNDCHIP_VRC7, SNDCHIP_VRC7,
+		SNDCHIP_S5B, SNDCHIP_S5B, SNDCHIP_S5B
+	};
+
+	ResetChannels();
+
+	for (int i = 0; i < CHANNELS; ++i) {
+		// The MMC5 voice channel is not available in the tracker
+		if (i == CHANID_MMC5_VOICE)
+			continue;
+		if ((CHANNEL_CHIP[i] & Chip) || (i < 5))
+			RegisterChannel(NULL, i, CHANNEL_CHIP[i]);
+	}
+}
+
 void CFamiTrackerDoc::ApplyExpansionChip()
 {
-	// Tell the sound emulator to switch expansion chip
-	theApp.GetSoundGenerator()->SelectChip(m_iExpansionChip);
+	CSoundGen *pSoundGen = theApp.GetSoundGenerator();
 
-	// Change period tables
-	theApp.GetSoundGenerator()->LoadMachineSettings(m_iMachine, m_iEngineSpeed);
+	if (pSoundGen) {
+		// Tell the sound emulator to switch expansion chip
+		pSoundGen->SelectChip(m_iExpansionChip);
+
+		// Change period tables
+		pSoundGen->LoadMachineSettings(m_iMachine, m_iEngineSpeed);
+	}
 
 	SetModifiedFlag();
 	// Resize the frame editor
@@ -4288,7 +4388,7 @@ int CFamiTrackerDoc::GetChipType(int Channel) const
 {
 	ASSERT(m_iRegisteredChannels != 0);
 	ASSERT(Channel < m_iRegisteredChannels);
-	return m_pChannels[Channel]->GetChip();
+	return m_iChannelChip[Channel];
 }
 
 int CFamiTrackerDoc::GetChannelCount() const
@@ -4340,7 +4440,8 @@ int CFamiTrackerDoc::GetVibratoStyle() const
 void CFamiTrackerDoc::SetVibratoStyle(int Style)
 {
 	m_iVibratoStyle = Style;
-	theApp.GetSoundGenerator()->GenerateVibratoTable(Style);
+	if (theApp.GetSoundGenerator())
+		theApp.GetSoundGenerator()->GenerateVibratoTable(Style);
 }
 
 // Linear pitch slides
@@ -4543,7 +4644,7 @@ int CFamiTrackerDoc::ScanActualLength(int Track, int Count) const
 		for (int j = 0; j < GetChannelCount() && JumpTo == -1; ++j) {
 			for (unsigned k = 0; k < GetPatternLength(Track) && JumpTo == -1; ++k) {
 				stChanNote Note;
-				GetNoteData(i, j, k, &Note);
+				GetDataAtPattern(Track, GetPatternAtFrame(Track, i, j), j, k, &Note);
 				for (unsigned l = 0; l < GetEffColumns(Track, j) + 1; ++l) {
 					switch (Note.EffNumber[l]) {
 						case EF_JUMP:
@@ -165,7 +165,7 @@ public:
 	bool HasLastLoadFailed() const;
 
 	// Import
-	CFamiTrackerDoc *LoadImportFile(LPCTSTR lpszPathName);
+	static CFamiTrackerDoc *LoadImportFile(LPCTSTR lpszPathName);
 	bool ImportInstruments(CFamiTrackerDoc *pImported, int *pInstTable);
 	bool ImportTrack(int Track, CFamiTrackerDoc *pImported, int *pInstTable);
 
@@ -229,6 +229,7 @@ public:
 
 	void			SetDataAtPattern(unsigned int Track, unsigned int Pattern, unsigned int Channel, unsigned int Row, stChanNote *Data);
 	void			GetDataAtPattern(unsigned int Track, unsigned int Pattern, unsigned int Channel, unsigned int Row, stChanNote *Data) const;
+	void			UnpackTrackPatterns(unsigned int Track);
 
 	unsigned int	GetNoteEffectType(unsigned int Frame, unsigned int Channel, unsigned int Row, int Index) const;
 	unsigned int	GetNoteEffectParam(unsigned int Frame, unsigned int Channel, unsigned int Row, int Index) const;
@@ -433,6 +434,7 @@ protected:
 	void			AllocateSong(unsigned int Song);
 
 	void			SetupChannels(unsigned char Chip);
+	void			RegisterChannelTypes(unsigned char Chip);
 	void			ApplyExpansionChip();
 
 	//
@@ -537,9 +539,6 @@ public:
    virtual void UpdateAllViews(void* ptr,long hint = 0) { emit updateViews(hint); }
    virtual CString GetTitle() { return m_docTitle; }
 
-   // HACKS
-   static CFamiTrackerDoc* _this;
-   
 // Implementation
 public:
 	virtual ~CFamiTrackerDoc();
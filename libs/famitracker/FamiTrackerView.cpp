@@ -2700,7 +2700,7 @@ bool CFamiTrackerView::DoRelease() const
 	if (!pInstrument)
 		return false;
 	
-	return pInstrument->CanRelease();
+	return pInstrument->CanRelease(GetDocument());
 }
 
 void CFamiTrackerView::HandleKeyboardNote(char nChar, bool Pressed) 
@@ -59,8 +59,8 @@ public:
 	virtual bool Load(CDocumentFile *pDocFile) = 0;									// Loads the instrument from a module
 	virtual void SaveFile(CFile *pFile, CFamiTrackerDoc *pDoc) = 0;					// Saves to an FTI file
 	virtual bool LoadFile(CFile *pFile, int iVersion, CFamiTrackerDoc *pDoc) = 0;	// Loads from an FTI file
-	virtual int Compile(CChunk *pChunk, int Index) = 0;								// Compiles the instrument for NSF generation
-	virtual bool CanRelease() const = 0;
+	virtual int Compile(CChunk *pChunk, int Index, CFamiTrackerDoc *pDoc) = 0;		// Compiles the instrument for NSF generation
+	virtual bool CanRelease(CFamiTrackerDoc *pDoc) const = 0;
 protected:
 	void InstrumentChanged() const;
 private:
@@ -78,8 +78,8 @@ public:
 	virtual bool Load(CDocumentFile *pDocFile);
 	virtual void SaveFile(CFile *pFile, CFamiTrackerDoc *pDoc);
 	virtual bool LoadFile(CFile *pFile, int iVersion, CFamiTrackerDoc *pDoc);
-	virtual int Compile(CChunk *pChunk, int Index);
-	virtual bool CanRelease() const;
+	virtual int Compile(CChunk *pChunk, int Index, CFamiTrackerDoc *pDoc);
+	virtual bool CanRelease(CFamiTrackerDoc *pDoc) const;
 
 public:
 	// Sequences
@@ -126,8 +126,8 @@ public:
 	virtual bool Load(CDocumentFile *pDocFile);
 	virtual void SaveFile(CFile *pFile, CFamiTrackerDoc *pDoc);
 	virtual bool LoadFile(CFile *pFile, int iVersion, CFamiTrackerDoc *pDoc);
-	virtual int Compile(CChunk *pChunk, int Index);
-	virtual bool CanRelease() const;
+	virtual int Compile(CChunk *pChunk, int Index, CFamiTrackerDoc *pDoc);
+	virtual bool CanRelease(CFamiTrackerDoc *pDoc) const;
 
 public:
 	int		GetSeqEnable(int Index) const;
@@ -154,8 +154,8 @@ public:
 	virtual bool Load(CDocumentFile *pDocFile);
 	virtual void SaveFile(CFile *pFile, CFamiTrackerDoc *pDoc);
 	virtual bool LoadFile(CFile *pFile, int iVersion, CFamiTrackerDoc *pDoc);
-	virtual int Compile(CChunk *pChunk, int Index);
-	virtual bool CanRelease() const;
+	virtual int Compile(CChunk *pChunk, int Index, CFamiTrackerDoc *pDoc);
+	virtual bool CanRelease(CFamiTrackerDoc *pDoc) const;
 
 public:
 	void		 SetPatch(unsigned int Patch);
@@ -179,8 +179,8 @@ public:
 	virtual bool Load(CDocumentFile *pDocFile);
 	virtual void SaveFile(CFile *pFile, CFamiTrackerDoc *pDoc);
 	virtual bool LoadFile(CFile *pFile, int iVersion, CFamiTrackerDoc *pDoc);
-	virtual int Compile(CChunk *pChunk, int Index);
-	virtual bool CanRelease() const;
+	virtual int Compile(CChunk *pChunk, int Index, CFamiTrackerDoc *pDoc);
+	virtual bool CanRelease(CFamiTrackerDoc *pDoc) const;
 
 public:
 	unsigned char GetSample(int Index) const;
@@ -232,8 +232,8 @@ public:
 	virtual bool Load(CDocumentFile *pDocFile);
 	virtual void SaveFile(CFile *pFile, CFamiTrackerDoc *pDoc);
 	virtual bool LoadFile(CFile *pFile, int iVersion, CFamiTrackerDoc *pDoc);
-	virtual int Compile(CChunk *pChunk, int Index);
-	virtual bool CanRelease() const;
+	virtual int Compile(CChunk *pChunk, int Index, CFamiTrackerDoc *pDoc);
+	virtual bool CanRelease(CFamiTrackerDoc *pDoc) const;
 
 public:
 	int		GetSeqEnable(int Index) const;
@@ -281,8 +281,8 @@ public:
 	virtual bool Load(CDocumentFile *pDocFile);
 	virtual void SaveFile(CFile *pFile, CFamiTrackerDoc *pDoc);
 	virtual bool LoadFile(CFile *pFile, int iVersion, CFamiTrackerDoc *pDoc);
-	virtual int Compile(CChunk *pChunk, int Index);
-	virtual bool CanRelease() const;
+	virtual int Compile(CChunk *pChunk, int Index, CFamiTrackerDoc *pDoc);
+	virtual bool CanRelease(CFamiTrackerDoc *pDoc) const;
 
 public:
 	int		GetSeqEnable(int Index) const;
@@ -373,13 +373,11 @@ bool CInstrument2A03::LoadFile(CFile *pFile, int iVersion, CFamiTrackerDoc *pDoc
 	return true;
 }
 
-int CInstrument2A03::Compile(CChunk *pChunk, int Index)
+int CInstrument2A03::Compile(CChunk *pChunk, int Index, CFamiTrackerDoc *pDoc)
 {
 	int ModSwitch = 0;
 	int StoredBytes = 0;
 
-	CFamiTrackerDoc *pDoc = CFamiTrackerDoc::GetDoc();
-
 	for (int i = 0; i < SEQUENCE_COUNT; ++i) {
 		ModSwitch = (ModSwitch >> 1) | ((GetSeqEnable(i) && (pDoc->GetSequence(GetSeqIndex(i), i)->GetItemCount() > 0)) ? 0x10 : 0);
 	}
@@ -399,11 +397,11 @@ int CInstrument2A03::Compile(CChunk *pChunk, int Index)
 	return StoredBytes;
 }
 
-bool CInstrument2A03::CanRelease() const
+bool CInstrument2A03::CanRelease(CFamiTrackerDoc *pDoc) const
 {
 	if (GetSeqEnable(0) != 0) {
 		int index = GetSeqIndex(SEQ_VOLUME);
-		return CFamiTrackerDoc::GetDoc()->GetSequence(SNDCHIP_NONE, index, SEQ_VOLUME)->GetReleasePoint() != -1;
+		return pDoc->GetSequence(SNDCHIP_NONE, index, SEQ_VOLUME)->GetReleasePoint() != -1;
 	}
 
 	return false;
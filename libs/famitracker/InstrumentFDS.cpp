@@ -318,7 +318,7 @@ bool CInstrumentFDS::LoadFile(CFile *pFile, int iVersion, CFamiTrackerDoc *pDoc)
 	return true;
 }
 
-int CInstrumentFDS::Compile(CChunk *pChunk, int Index)
+int CInstrumentFDS::Compile(CChunk *pChunk, int Index, CFamiTrackerDoc *pDoc)
 {
 	CString str;
 
@@ -367,7 +367,7 @@ int CInstrumentFDS::Compile(CChunk *pChunk, int Index)
 	return size;
 }
 
-bool CInstrumentFDS::CanRelease() const
+bool CInstrumentFDS::CanRelease(CFamiTrackerDoc *pDoc) const
 {
 	if (m_pVolume->GetItemCount() > 0) {
 		if (m_pVolume->GetReleasePoint() != -1)
@@ -262,13 +262,11 @@ bool CInstrumentN163::LoadFile(CFile *pFile, int iVersion, CFamiTrackerDoc *pDoc
 	return true;
 }
 
-int CInstrumentN163::Compile(CChunk *pChunk, int Index)
+int CInstrumentN163::Compile(CChunk *pChunk, int Index, CFamiTrackerDoc *pDoc)
 {
 	int ModSwitch = 0;
 	int StoredBytes = 0;
 
-	CFamiTrackerDoc *pDoc = CFamiTrackerDoc::GetDoc();
-
 	// Store wave info
 	pChunk->StoreByte(m_iWaveSize >> 1);
 	pChunk->StoreByte(/*m_bAutoWavePos ? 0xFF :*/ m_iWavePos);
@@ -315,11 +313,11 @@ int CInstrumentN163::StoreWave(CChunk *pChunk) const
 	return m_iWaveCount * (m_iWaveSize >> 1);
 }
 
-bool CInstrumentN163::CanRelease() const
+bool CInstrumentN163::CanRelease(CFamiTrackerDoc *pDoc) const
 {
 	if (GetSeqEnable(0) != 0) {
 		int index = GetSeqIndex(SEQ_VOLUME);
-		return CFamiTrackerDoc::GetDoc()->GetSequence(SNDCHIP_N163, index, SEQ_VOLUME)->GetReleasePoint() != -1;
+		return pDoc->GetSequence(SNDCHIP_N163, index, SEQ_VOLUME)->GetReleasePoint() != -1;
 	}
 
 	return false;
@@ -85,12 +85,12 @@ bool CInstrumentS5B::LoadFile(CFile *pFile, int iVersion, CFamiTrackerDoc *pDoc)
 	return false;
 }
 
-int CInstrumentS5B::Compile(CChunk *pChunk, int Index)
+int CInstrumentS5B::Compile(CChunk *pChunk, int Index, CFamiTrackerDoc *pDoc)
 {
 	return 0;
 }
 
-bool CInstrumentS5B::CanRelease() const
+bool CInstrumentS5B::CanRelease(CFamiTrackerDoc *pDoc) const
 {
 	return false; // TODO
 }
@@ -182,13 +182,11 @@ bool CInstrumentVRC6::LoadFile(CFile *pFile, int iVersion, CFamiTrackerDoc *pDoc
 	return true;
 }
 
-int CInstrumentVRC6::Compile(CChunk *pChunk, int Index)
+int CInstrumentVRC6::Compile(CChunk *pChunk, int Index, CFamiTrackerDoc *pDoc)
 {
 	int ModSwitch = 0;
 	int StoredBytes = 0;
 
-	CFamiTrackerDoc *pDoc = CFamiTrackerDoc::GetDoc();
-
 	for (int i = 0; i < SEQUENCE_COUNT; ++i) {
 		ModSwitch = (ModSwitch >> 1) | (GetSeqEnable(i) && (pDoc->GetSequence(SNDCHIP_VRC6, GetSeqIndex(i), i)->GetItemCount() > 0) ? 0x10 : 0);
 	}
@@ -208,11 +206,11 @@ int CInstrumentVRC6::Compile(CChunk *pChunk, int Index)
 	return StoredBytes;
 }
 
-bool CInstrumentVRC6::CanRelease() const
+bool CInstrumentVRC6::CanRelease(CFamiTrackerDoc *pDoc) const
 {
 	if (GetSeqEnable(0) != 0) {
 		int index = GetSeqIndex(SEQ_VOLUME);
-		return CFamiTrackerDoc::GetDoc()->GetSequence(SNDCHIP_VRC6, index, SEQ_VOLUME)->GetReleasePoint() != -1;
+		return pDoc->GetSequence(SNDCHIP_VRC6, index, SEQ_VOLUME)->GetReleasePoint() != -1;
 	}
 
 	return false;
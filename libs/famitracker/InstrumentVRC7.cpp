@@ -101,7 +101,7 @@ bool CInstrumentVRC7::LoadFile(CFile *pFile, int iVersion, CFamiTrackerDoc *pDoc
 	return true;
 }
 
-int CInstrumentVRC7::Compile(CChunk *pChunk, int Index)
+int CInstrumentVRC7::Compile(CChunk *pChunk, int Index, CFamiTrackerDoc *pDoc)
 {
 	int Patch = GetPatch();
 
@@ -117,7 +117,7 @@ int CInstrumentVRC7::Compile(CChunk *pChunk, int Index)
 	return (Patch == 0) ? 9 : 1;
 }
 
-bool CInstrumentVRC7::CanRelease() const
+bool CInstrumentVRC7::CanRelease(CFamiTrackerDoc *pDoc) const
 {
 	return false;	// This can use release but disable it when previewing notes
 }
@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <cmath>
 #include "resampler/resample.hpp"
+#include "resampler/polyphase.hpp"
 #include "stdafx.h"
 #include <mmsystem.h>
 #include "FamiTracker.h"
@@ -33,6 +34,12 @@
 #include "APU/DPCM.h"
 #include "resampler/resample.inl"
 
+#include <QMap>
+#include <QMutexLocker>
+#include <QRunnable>
+#include <QSharedPointer>
+#include <QWaitCondition>
+
 
 const int CPCMImport::MAX_QUALITY = 15;
 const int CPCMImport::MIN_QUALITY = 0;
@@ -44,101 +51,191 @@ const int CPCMImport::VOLUME_RANGE = 12;		// +/- dB
 LPCTSTR CPCMImport::QUALITY_FORMAT = _T("Quality: %i");
 LPCTSTR CPCMImport::GAIN_FORMAT	   = _T("Gain: %+.0f dB");
 
+// Resampling kernels are shared by all imports, one per rate ratio
+static const float RESAMPLE_CUTOFF = .9f;		// TODO: make it modifiable
+static const jarh::sinc ResampleSinc(512, 32);	// TODO: parametrise
+
+static QMutex KernelLock;
+static QMap<float, QSharedPointer<jarh::polyphase> > KernelCache;
+
+static QSharedPointer<jarh::polyphase> GetKernel(float Ratio)
+{
+	QMutexLocker Lock(&KernelLock);
+	QSharedPointer<jarh::polyphase> &pKernel = KernelCache[Ratio];
+	if (pKernel.isNull())
+		pKernel = QSharedPointer<jarh::polyphase>(new jarh::polyphase(ResampleSinc, Ratio, RESAMPLE_CUTOFF));
+	return pKernel;
+}
+
+static float GetResampleRatio(int Quality, int SamplesPerSec)
+{
+	float base_freq = (float)CAPU::BASE_FREQ_NTSC / (float)CDPCM::DMC_PERIODS_NTSC[Quality];
+	return base_freq / (float)SamplesPerSec;
+}
+
+// Decodes the wave data to mono samples in blocks, resamplers wait for the samples they need
+class CWaveDecoder : public QRunnable
+{
+public:
+	CWaveDecoder(CFile &File, ULONGLONG Start, int Frames, int Channels, int SampleSize, int BlockAlign, volatile bool *pCancel) :
+		m_File(File), m_ullStart(Start), m_iChannels(Channels), m_iSampleSize(SampleSize), m_iBlockAlign(BlockAlign),
+		m_vData(Frames), m_iDecoded(0), m_bDone(false), m_pCancel(pCancel)
+	{
+		setAutoDelete(false);
+	}
+
+	void run() {
+		static const int BLOCK_FRAMES = 0x4000;
+
+		const int Frames = (int)m_vData.size();
+		std::vector<unsigned char> Block(BLOCK_FRAMES * m_iBlockAlign);
+		int Decoded = 0;
+
+		m_File.Seek(m_ullStart, CFile::begin);
+
+		while (Decoded < Frames && !*m_pCancel) {
+			int Count = std::min(BLOCK_FRAMES, Frames - Decoded);
+			int Read = m_File.Read(&Block[0], Count * m_iBlockAlign) / m_iBlockAlign;
+
+			for (int i = 0; i < Read; ++i)
+				m_vData[Decoded + i] = (float)DecodeFrame(&Block[i * m_iBlockAlign]);
+
+			Decoded += Read;
+
+			m_Lock.lock();
+			m_iDecoded = Decoded;
+			m_Available.wakeAll();
+			m_Lock.unlock();
+
+			if (Read < Count)
+				break;
+		}
+
+		m_Lock.lock();
+		m_bDone = true;
+		m_Available.wakeAll();
+		m_Lock.unlock();
+	}
+
+	// Returns the number of decoded samples up to Frames, less only at the end of file
+	int WaitFrames(int Frames) {
+		QMutexLocker Lock(&m_Lock);
+		while (m_iDecoded < Frames && !m_bDone)
+			m_Available.wait(&m_Lock);
+		return std::min(Frames, m_iDecoded);
+	}
+
+	// Samples below the count returned by WaitFrames are never changed
+	const float *GetData() const {
+		return m_vData.empty() ? NULL : &m_vData[0];
+	}
+
+private:
+	int DecodeFrame(const unsigned char *pFrame) const {
+		const bool Stereo = (m_iChannels == 2);
+		const int Next = m_iSampleSize;
+
+		if (m_iSampleSize == 2) {
+			// 16 bit samples
+			short Left = (short)(pFrame[0] | (pFrame[1] << 8));
+			if (Stereo) {
+				short Right = (short)(pFrame[Next] | (pFrame[Next + 1] << 8));
+				return (Left + Right) / 2;
+			}
+			return Left;
+		}
+		else if (m_iSampleSize == 1) {
+			// 8 bit samples
+			// convert to a proper signed representation
+			// shift left only by 7 for stereo; because we want a mean
+			if (Stereo)
+				return ((int)pFrame[0] + (int)pFrame[Next] - 256) << 7;
+			return ((int)pFrame[0] - 128) << 8;
+		}
+		else if (m_iSampleSize == 3) {
+			// 24 bit samples, only the upper 16 bits are used
+			short Left = (short)(pFrame[1] | (pFrame[2] << 8));
+			if (Stereo) {
+				short Right = (short)(pFrame[Next + 1] | (pFrame[Next + 2] << 8));
+				return (Left + Right) / 2;
+			}
+			return Left;
+		}
+		else if (m_iSampleSize == 4) {
+			// 32 bit samples
+			int Left = (int)(pFrame[0] | (pFrame[1] << 8) | (pFrame[2] << 16) | ((unsigned)pFrame[3] << 24));
+			if (Stereo) {
+				int Right = (int)(pFrame[Next] | (pFrame[Next + 1] << 8) | (pFrame[Next + 2] << 16) | ((unsigned)pFrame[Next + 3] << 24));
+				return ((Left >> 16) + (Right >> 16)) / 2;
+			}
+			return Left >> 16;
+		}
+
+		return 0;
+	}
+
+	CFile			&m_File;
+	ULONGLONG		m_ullStart;
+	int				m_iChannels;
+	int				m_iSampleSize;
+	int				m_iBlockAlign;
+	std::vector<float> m_vData;
+	int				m_iDecoded;
+	bool			m_bDone;
+	QMutex			m_Lock;
+	QWaitCondition	m_Available;
+	volatile bool	*m_pCancel;
+};
+
 // Implement a resampler using CRTP idiom
 class resampler : public jarh::resample<resampler>
 {
     typedef jarh::resample<resampler> base;
 public:
-    resampler(const jarh::sinc &sinc, float ratio, int channels, int smpsize,
-              size_t nbsamples, CFile &cfile)
-    // TODO: cutoff is currently fixed to a value (.9f), make it modifiable.
-     : base(sinc), channels_(channels), smpsize_(smpsize),
-       nbsamples_(nbsamples), remain_(nbsamples), cfile_(cfile)
+    resampler(const jarh::sinc &sinc, const jarh::polyphase *k, float ratio, CWaveDecoder &decoder)
+     : base(sinc), decoder_(decoder), pos_(0)
     {
-        init(ratio, .9f);
+        init(ratio, RESAMPLE_CUTOFF);
+        kernel(k);
     }
 
     bool initstream()
     {
-        // Don't seek to the begin of wave chunk, as it is already done.
-        // This stream will not be reinitialized, then.
-        remain_ = nbsamples_;
+        pos_ = 0;
         return true;
     }
 
     float *fill(float *first, float *end)
     {
-        int val;
-        for(;first != end && remain_ && ReadSample(val); ++first, --remain_)
+        // Waits for the decoder, a short fill means end of stream
+        const int avail = decoder_.WaitFrames(pos_ + (int)(end - first));
+        if (avail > pos_)
         {
-            *first = (float)val;
+            const float *data = decoder_.GetData();
+            first = std::copy(data + pos_, data + avail, first);
+            pos_ = avail;
         }
         return first;
     }
 
 private:
-    bool ReadSample(int &v)
-    {
-        int ret, nbytes;
-        if (smpsize_ == 2) {
-            // 16 bit samples
-            short sample_word[2];
-            if (channels_ == 2) {
-                ret = cfile_.Read(sample_word, nbytes = 2*sizeof(short));
-                v = (sample_word[0] + sample_word[1]) / 2;
-            }
-            else {
-                ret = cfile_.Read(sample_word, nbytes = sizeof(short));
-                v = *sample_word;
-            }
-        }
-        else if (smpsize_ == 1) {
-            // 8 bit samples
-            unsigned char sample_byte[2];
-            if (channels_ == 2) {
-                ret = cfile_.Read(sample_byte, nbytes = 2);
-                // convert to a proper signed representation
-                // shift left only by 7; because we want a mean
-                v = ((int)sample_byte[0] + (int)sample_byte[1] - 256) << 7;
-            }
-            else {
-                ret = cfile_.Read(sample_byte, nbytes = 1);
-				v = ((int)(*sample_byte) - 128) << 8;
-            }
-        }
-		else if (smpsize_ == 3) {
-			// 24 bit samples
-	        unsigned char sample_byte[6];
-            if (channels_ == 2) {
-				ret = cfile_.Read(sample_byte, nbytes = 6);
-				v = (*((signed short*)(sample_byte + 1)) + *((signed short*)(sample_byte + 4))) / 2;
-			}
-			else {
-				ret = cfile_.Read(sample_byte, nbytes = 3);
-				v = *((signed short*)(sample_byte + 1));
-			}
-		}
-		else if (smpsize_ == 4) {
-			// 32 bit samples
-	        int sample_word[2];
-            if (channels_ == 2) {
-				ret = cfile_.Read(sample_word, nbytes = 8);
-				v = ((sample_word[0] >> 16) + (sample_word[1] >> 16)) / 2;
-			}
-			else {
-				ret = cfile_.Read(sample_word, nbytes = 4);
-				v = sample_word[0] >> 16;
-			}
-		}
+    CWaveDecoder &decoder_;
+    int pos_;
+};
 
-        return ret == nbytes;
-    }
+// Resamples the wave for one quality setting
+class CPCMResampleJob : public QRunnable
+{
+public:
+	CPCMResampleJob(CPCMImport *pParent, int Quality) : m_pParent(pParent), m_iQuality(Quality) {}
+
+	void run() {
+		m_pParent->ResampleWave(m_iQuality);
+	}
 
-    CFile &cfile_;
-    int    channels_;
-    int    smpsize_;
-    size_t nbsamples_;
-    size_t remain_;
+private:
+	CPCMImport	*m_pParent;
+	int			m_iQuality;
 };
 
 // Derive a new class from CFileDialog with implemented preview of audio files
@@ -183,13 +280,20 @@ void CFileSoundDialog::OnFileNameChange()
 IMPLEMENT_DYNAMIC(CPCMImport, CDialog)
 CPCMImport::CPCMImport(CWnd* pParent /*=NULL*/)
 	: CDialog(CPCMImport::IDD, pParent),
-	m_psinc(new jarh::sinc(512, 32)) // sinc object. TODO: parametrise
+	m_pDecoder(NULL),
+	m_iRequestedQuality(-1),
+	m_bCancel(false),
+	m_iPending(PENDING_NONE),
+	m_iEncodedQuality(-1),
+	m_iEncodedVolume(0)
 {
+	// Resampling jobs report back on this thread
+	QObject::connect(this,SIGNAL(resampled()),this,SLOT(resample_done()),Qt::QueuedConnection);
 }
 
 CPCMImport::~CPCMImport()
 {
-	SAFE_RELEASE(m_psinc);
+	StopConversion();
 }
 
 void CPCMImport::DoDataExchange(CDataExchange* pDX)
@@ -222,6 +326,21 @@ void CPCMImport::volume_valueChanged(int value)
    OnHScroll(SB_HORZ,value,dynamic_cast<CScrollBar*>(GetDlgItem(IDC_VOLUME)));
 }
 
+void CPCMImport::resample_done()
+{
+	// Finish the button press that waited for this quality
+	if (m_iPending == PENDING_NONE || !IsResampled(m_iQuality))
+		return;
+
+	int Pending = m_iPending;
+	m_iPending = PENDING_NONE;
+
+	if (Pending == PENDING_OK)
+		OnBnClickedOk();
+	else
+		OnBnClickedPreview();
+}
+
 //BEGIN_MESSAGE_MAP(CPCMImport, CDialog)
 //	ON_WM_HSCROLL()
 //	ON_BN_CLICKED(IDCANCEL, OnBnClickedCancel)
@@ -250,8 +369,13 @@ CDSample *CPCMImport::ShowDialog()
 	if (!OpenWaveFile())
 		return NULL;
 
+	StartDecoder();
+
 	CDialog::DoModal();
 
+	// Workers must be done with the file
+	StopConversion();
+
 	// Close file
 	m_fSampleFile.Close();
 
@@ -287,6 +411,9 @@ BOOL CPCMImport::OnInitDialog()
 
 	UpdateFileInfo();
 
+	// Have the default quality ready when preview is clicked
+	StartResample(m_iQuality);
+
 	CString WinTitle;
    WinTitle.Format(_T("PCM Import - [%s]"), m_strFileName.GetString());
 	SetWindowText(WinTitle);
@@ -312,6 +439,9 @@ void CPCMImport::OnHScroll(UINT nSBCode, UINT nPos, CScrollBar* pScrollBar)
 
 	UpdateFileInfo();
 
+	// Resample in the background, a gain change only needs encoding
+	StartResample(m_iQuality);
+
 	CDialog::OnHScroll(nSBCode, nPos, pScrollBar);
 }
 
@@ -325,6 +455,11 @@ void CPCMImport::OnBnClickedCancel()
 
 void CPCMImport::OnBnClickedOk()
 {
+	if (!IsResampled(m_iQuality)) {
+		WaitResampled(PENDING_OK);
+		return;
+	}
+
 	CDSample *pSample = ConvertFile();
 
 	if (pSample == NULL)
@@ -343,6 +478,11 @@ void CPCMImport::OnBnClickedOk()
 
 void CPCMImport::OnBnClickedPreview()
 {
+	if (!IsResampled(m_iQuality)) {
+		WaitResampled(PENDING_PREVIEW);
+		return;
+	}
+
 	CDSample *pSample = ConvertFile();
 
 	if (!pSample)
@@ -365,73 +505,164 @@ void CPCMImport::UpdateFileInfo()
 	SetDlgItemText(IDC_RESAMPLING, Resampling);
 }
 
+void CPCMImport::StartDecoder()
+{
+	m_bCancel = false;
+	m_vResampled.assign(MAX_QUALITY + 1, stResampled());
+	m_iRequestedQuality = -1;
+	m_iPending = PENDING_NONE;
+	m_iEncodedQuality = -1;
+
+	// Lowest quality needs the most input, decoding stops there
+	int Frames = (m_iBlockAlign > 0) ? m_iWaveSize / m_iBlockAlign : 0;
+	float MinRatio = GetResampleRatio(MIN_QUALITY, m_iSamplesPerSec);
+	int MaxFrames = (int)((SAMPLES_MAX * 8 + 32) / MinRatio);
+	if (Frames > MaxFrames)
+		Frames = MaxFrames;
+
+	m_pDecoder = new CWaveDecoder(m_fSampleFile, m_ullSampleStart, Frames, m_iChannels, m_iSampleSize, m_iBlockAlign, &m_bCancel);
+	m_ThreadPool.start(m_pDecoder);
+}
+
+void CPCMImport::StopConversion()
+{
+	m_bCancel = true;
+	m_ThreadPool.waitForDone();
+
+	SAFE_RELEASE(m_pDecoder);
+}
+
+void CPCMImport::StartResample(int Quality)
+{
+	QMutexLocker Lock(&m_ResampleLock);
+
+	m_iRequestedQuality = Quality;
+
+	stResampled &Result = m_vResampled[Quality];
+	if (!Result.Ready && !Result.Queued) {
+		Result.Queued = true;
+		m_ThreadPool.start(new CPCMResampleJob(this, Quality));
+	}
+}
+
+bool CPCMImport::IsResampled(int Quality)
+{
+	QMutexLocker Lock(&m_ResampleLock);
+	return m_vResampled[Quality].Ready;
+}
+
+void CPCMImport::WaitResampled(int Pending)
+{
+	// The button is pressed again from resample_done() when the wave is ready
+	m_iPending = Pending;
+
+	// Display wait cursor
+	SetCursor(AfxGetApp()->LoadStandardCursor(IDC_WAIT));
+
+	StartResample(m_iQuality);
+}
+
+void CPCMImport::ResampleWave(int Quality)
+{
+	stResampled &Result = m_vResampled[Quality];
+
+	// Skip qualities that were passed while dragging the slider
+	m_ResampleLock.lock();
+	bool bSkip = m_bCancel || (Quality != m_iRequestedQuality);
+	if (bSkip)
+		Result.Queued = false;
+	m_ResampleLock.unlock();
+
+	if (bSkip)
+		return;
+
+	float resample_factor = GetResampleRatio(Quality, m_iSamplesPerSec);
+	QSharedPointer<jarh::polyphase> pKernel = GetKernel(resample_factor);
+
+	resampler resmpler(ResampleSinc, pKernel.data(), resample_factor, *m_pDecoder);
+	std::vector<float> Data;
+	float val;
+
+	// Each DPCM byte holds 8 samples
+	Data.reserve(SAMPLES_MAX * 8);
+	while ((int)Data.size() < SAMPLES_MAX * 8 && !m_bCancel && resmpler.get(val))
+		Data.push_back(val);
+
+	// TODO: error handling with the file
+	// if (!resmpler.eof())
+	//      throw ?? or something else.
+
+	m_ResampleLock.lock();
+	Result.Data.swap(Data);
+	Result.Ready = !m_bCancel;
+	Result.Queued = false;
+	m_ResampleLock.unlock();
+
+	if (Result.Ready)
+		emit resampled();
+}
+
 CDSample *CPCMImport::ConvertFile()
 {
 	// Converts a WAV file to a DPCM sample
 	static const int DMC_BIAS = 32;
 
 	unsigned char DeltaAcc = 0;	// DPCM sample accumulator
-	int Sample = 0;				// PCM sample
 	int Delta = DMC_BIAS;		// Delta counter
 	int AccReady = 8;
 
-	float resample_factor;
-
 	float volume = powf(10, float(m_iVolume) / 20.0f);		// Convert dB to linear
 
-	// Display wait cursor
-	SetCursor(AfxGetApp()->LoadStandardCursor(IDC_WAIT));
+	// Only called once the wave is resampled, the data is never changed once ready
+	const std::vector<float> &Resampled = m_vResampled[m_iQuality].Data;
+	const int Count = (int)Resampled.size();
 
-	// Seek to start of samples
-	m_fSampleFile.Seek(m_ullSampleStart, CFile::begin);
+	// Preview followed by OK gives the same sample, encode again only when quality or gain changed
+	if (m_iEncodedQuality != m_iQuality || m_iEncodedVolume != m_iVolume) {
+		m_vEncoded.clear();
 
-	// Allocate space
-	char *pSamples = new char[SAMPLES_MAX];
-	int iSamples = 0;
+		// Conversion
+		for (int i = 0; i < Count; ++i) {
+			// when resampling we must clip because of possible ringing.
+			static const int MAX_AMP =  (1 << 16) - 1;
+			static const int MIN_AMP = -(1 << 16) + 1; // just being symetric
+			float val = (std::max<float>(std::min<float>(Resampled[i], (float)MAX_AMP), (float)MIN_AMP));
 
-	// Determine resampling factor
-	float base_freq = (float)CAPU::BASE_FREQ_NTSC / (float)CDPCM::DMC_PERIODS_NTSC[m_iQuality];
-	resample_factor = base_freq / (float)m_iSamplesPerSec;
-
-    resampler resmpler(*m_psinc, resample_factor, m_iChannels, m_iSampleSize, m_iWaveSize, m_fSampleFile);
-    float val;
-	// Conversion
-	while (resmpler.get(val) && (iSamples < SAMPLES_MAX)) {
-
-		// when resampling we must clip because of possible ringing.
-		static const int MAX_AMP =  (1 << 16) - 1;
-		static const int MIN_AMP = -(1 << 16) + 1; // just being symetric
-		val = (std::max<float>(std::min<float>(val, (float)MAX_AMP), (float)MIN_AMP));
-
-        // Volume done this way so it acts as before
-        Sample = (int)((val * volume) / 1024.f)
-                  + DMC_BIAS;
-
-		DeltaAcc >>= 1;
-
-		// PCM -> DPCM
-		if (Sample >= Delta) {
-			++Delta;
-			if (Delta > 63)
-				Delta = 63;
-			DeltaAcc |= 0x80;
-		}
-		else if (Sample < Delta) {
-			--Delta;
-			if (Delta < 0)
-				Delta = 0;
-		}
+			// Volume done this way so it acts as before
+			int Sample = (int)((val * volume) / 1024.f) + DMC_BIAS;
+
+			DeltaAcc >>= 1;
 
-		if (--AccReady == 0) {
-			// Store sample
-			pSamples[iSamples++] = DeltaAcc;
-			AccReady = 8;
+			// PCM -> DPCM
+			if (Sample >= Delta) {
+				++Delta;
+				if (Delta > 63)
+					Delta = 63;
+				DeltaAcc |= 0x80;
+			}
+			else if (Sample < Delta) {
+				--Delta;
+				if (Delta < 0)
+					Delta = 0;
+			}
+
+			if (--AccReady == 0) {
+				// Store sample
+				m_vEncoded.push_back(DeltaAcc);
+				AccReady = 8;
+			}
 		}
+
+		m_iEncodedQuality = m_iQuality;
+		m_iEncodedVolume = m_iVolume;
 	}
 
-    // TODO: error handling with th efile
-    // if (!resmpler.eof())
-    //      throw ?? or something else.
+	// Allocate space
+	char *pSamples = new char[SAMPLES_MAX];
+	int iSamples = (int)m_vEncoded.size();
+
+	if (iSamples > 0)
+		memcpy(pSamples, &m_vEncoded[0], iSamples);
 
 	// Adjust sample until size is x * $10 + 1 bytes
 	while (iSamples < SAMPLES_MAX && ((iSamples & 0x0F) - 1) != 0)
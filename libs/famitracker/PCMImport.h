@@ -23,11 +23,13 @@
 #include "cqtmfc.h"
 #include "resource.h"
 
+#include <vector>
+#include <QMutex>
+#include <QThreadPool>
+
 #include "FamiTrackerDoc.h"
 
-namespace jarh {
-	class sinc;
-}
+class CWaveDecoder;
 
 class CPCMImport : public CDialog
 {
@@ -39,6 +41,9 @@ public slots:
    void preview_clicked();
    void quality_valueChanged(int value);
    void volume_valueChanged(int value);
+   void resample_done();
+signals:
+   void resampled();
    
 public:
 	DECLARE_DYNAMIC(CPCMImport)
@@ -52,6 +57,9 @@ public:
 
 	CDSample *ShowDialog();
 
+	// Called by the worker threads
+	void ResampleWave(int Quality);
+
 protected:
 	CDSample *m_pImported;
 
@@ -68,7 +76,29 @@ protected:
 	int m_iAvgBytesPerSec;
 	int m_iSamplesPerSec;
 
-	jarh::sinc *m_psinc;
+	// Conversion pipeline, the decoder streams the wave file to the resampling jobs
+	struct stResampled {
+		stResampled() : Queued(false), Ready(false) {}
+		bool Queued;
+		bool Ready;
+		std::vector<float> Data;
+	};
+
+	CWaveDecoder		*m_pDecoder;
+	QThreadPool			m_ThreadPool;
+	QMutex				m_ResampleLock;
+	std::vector<stResampled> m_vResampled;		// One per quality
+	int					m_iRequestedQuality;
+	volatile bool		m_bCancel;
+
+	// Button waiting for the resampled wave
+	enum { PENDING_NONE, PENDING_OK, PENDING_PREVIEW };
+	int					m_iPending;
+
+	// Last conversion, used again while quality and gain are unchanged
+	int					m_iEncodedQuality;
+	int					m_iEncodedVolume;
+	std::vector<char>	m_vEncoded;
 
 protected:
 	static const int MAX_QUALITY;
@@ -85,6 +115,11 @@ protected:
 	CDSample *ConvertFile();
 	//int ReadSample(void);
 	bool OpenWaveFile();
+	void StartDecoder();
+	void StopConversion();
+	void StartResample(int Quality);
+	bool IsResampled(int Quality);
+	void WaitResampled(int Pending);
 	void UpdateFileInfo();
 
 protected:
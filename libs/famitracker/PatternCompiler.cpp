@@ -19,6 +19,9 @@
 */
 
 #include "stdafx.h"
+#include <QCryptographicHash>
+#include <QHash>
+#include <QMutex>
 #include "FamiTrackerDoc.h"
 #include "PatternCompiler.h"
 #include "TrackerChannel.h"
@@ -85,6 +88,23 @@ const unsigned char CMD_LOOP_POINT			= DEF_CMD(26);	// Currently not in use
 #define OPTIMIZE_DURATIONS		// Remove note durations when possible
 #define QUICK_INST				// Remove instrument switch command for instrument 0 - 15
 
+// Compiled patterns are kept for the session, keyed by a SHA-1 of everything
+// the compiled string depends on. The key itself is stored too, a digest
+// match is only used after the keys compare equal.
+struct stCachedPattern {
+	QByteArray Key;
+	QByteArray Data;
+	QByteArray CompressedData;
+	QByteArray SamplesUsed;
+	bool Empty;
+	unsigned int Hash;
+};
+
+static const int PATTERN_CACHE_SIZE = 16384;	// Cache is dropped when this many patterns are stored
+
+static QHash<QByteArray, stCachedPattern> PatternCache;
+static QMutex PatternCacheLock;
+
 CPatternCompiler::CPatternCompiler() :
 	m_iDataPointer(0),
 	m_iCompressedDataPointer(0),
@@ -113,6 +133,125 @@ void CPatternCompiler::CleanUp()
 }
 
 void CPatternCompiler::CompileData(CFamiTrackerDoc *pDoc, int Track, int Pattern, int Channel, unsigned char (*DPCM_LookUp)[MAX_INSTRUMENTS][OCTAVE_RANGE][NOTE_RANGE], unsigned int *iAssignedInstruments)
+{
+	// Only compile patterns that haven't been seen before in this session
+	QByteArray Key = GetPatternKey(pDoc, Track, Pattern, Channel, DPCM_LookUp, iAssignedInstruments);
+	QByteArray Digest = QCryptographicHash::hash(Key, QCryptographicHash::Sha1);
+
+	if (LoadCached(Digest, Key))
+		return;
+
+	CompilePattern(pDoc, Track, Pattern, Channel, DPCM_LookUp, iAssignedInstruments);
+	StoreCached(Digest, Key);
+}
+
+QByteArray CPatternCompiler::GetPatternKey(CFamiTrackerDoc *pDoc, int Track, int Pattern, int Channel, unsigned char (*DPCM_LookUp)[MAX_INSTRUMENTS][OCTAVE_RANGE][NOTE_RANGE], unsigned int *iAssignedInstruments)
+{
+	// Collects the compiler input: channel properties, the pattern rows with
+	// instruments mapped to their exported index, and for the DPCM channel
+	// the sample assignments of every instrument the pattern may use
+	QByteArray Key;
+	stChanNote ChanNote;
+	bool bInstrumentUsed[MAX_INSTRUMENTS];
+
+	int EffColumns = pDoc->GetEffColumns(Track, Channel) + 1;
+	unsigned int iPatternLen = pDoc->GetPatternLength(Track);
+	int ChanID = pDoc->GetChannelType(Channel);
+
+	Key.reserve(8 + iPatternLen * (5 + EffColumns * 2));
+
+	Key.append((char)ChanID);
+	Key.append((char)pDoc->GetChipType(Channel));
+	Key.append((char)(Channel < 5));
+	Key.append((char)EffColumns);
+	Key.append((char)(iPatternLen & 0xFF));
+	Key.append((char)(iPatternLen >> 8));
+
+	memset(bInstrumentUsed, 0, sizeof(bool) * MAX_INSTRUMENTS);
+	bInstrumentUsed[0] = true;
+
+	for (unsigned int i = 0; i < iPatternLen; ++i) {
+		pDoc->GetDataAtPattern(Track, Pattern, Channel, i, &ChanNote);
+
+		Key.append((char)ChanNote.Note);
+		Key.append((char)ChanNote.Octave);
+		Key.append((char)ChanNote.Vol);
+		Key.append((char)ChanNote.Instrument);
+		Key.append((char)FindInstrument(ChanNote.Instrument, iAssignedInstruments));
+
+		for (int j = 0; j < EffColumns; ++j) {
+			Key.append((char)ChanNote.EffNumber[j]);
+			Key.append((char)ChanNote.EffParam[j]);
+		}
+
+		if (ChanNote.Instrument < MAX_INSTRUMENTS)
+			bInstrumentUsed[ChanNote.Instrument] = true;
+	}
+
+	if (ChanID == CHANID_DPCM) {
+		for (int i = 0; i < MAX_INSTRUMENTS; ++i) {
+			if (!bInstrumentUsed[i])
+				continue;
+			CInstrument2A03 *pInstrument = NULL;
+			if (pDoc->GetInstrumentType(i) == INST_2A03)
+				pInstrument = (CInstrument2A03*)pDoc->GetInstrument(i);
+			Key.append((char)i);
+			Key.append((const char*)(*DPCM_LookUp)[i], OCTAVE_RANGE * NOTE_RANGE);
+			for (int o = 0; o < OCTAVE_RANGE; ++o) {
+				for (int n = 0; n < NOTE_RANGE; ++n)
+					Key.append(pInstrument != NULL ? pInstrument->GetSample(o, n) : (char)0);
+			}
+		}
+	}
+
+	return Key;
+}
+
+bool CPatternCompiler::LoadCached(const QByteArray &Digest, const QByteArray &Key)
+{
+	QMutexLocker Locker(&PatternCacheLock);
+
+	QHash<QByteArray, stCachedPattern>::const_iterator it = PatternCache.constFind(Digest);
+
+	if (it == PatternCache.constEnd() || it->Key != Key)
+		return false;
+
+	CleanUp();
+
+	m_iDataPointer = it->Data.size();
+	memcpy(m_pData, it->Data.constData(), m_iDataPointer);
+	m_iCompressedDataPointer = it->CompressedData.size();
+	memcpy(m_pCompressedData, it->CompressedData.constData(), m_iCompressedDataPointer);
+	m_bEmpty = it->Empty;
+	m_iHash = it->Hash;
+	m_SamplesUsed = it->SamplesUsed;
+
+	for (int i = 0; i < m_SamplesUsed.size(); ++i)
+		m_bDSamplesAccessed[(unsigned char)m_SamplesUsed[i]] = true;
+
+	return true;
+}
+
+void CPatternCompiler::StoreCached(const QByteArray &Digest, const QByteArray &Key)
+{
+	stCachedPattern Entry;
+
+	Entry.Key = Key;
+	Entry.Data = QByteArray((const char*)m_pData, m_iDataPointer);
+	Entry.CompressedData = QByteArray((const char*)m_pCompressedData, m_iCompressedDataPointer);
+	Entry.SamplesUsed = m_SamplesUsed;
+	Entry.Empty = m_bEmpty;
+	Entry.Hash = m_iHash;
+
+	QMutexLocker Locker(&PatternCacheLock);
+
+	if (PatternCache.size() >= PATTERN_CACHE_SIZE)
+		PatternCache.clear();
+
+	PatternCache.insert(Digest, Entry);
+}
+
+void CPatternCompiler::CompilePattern(CFamiTrackerDoc *pDoc, int Track, int Pattern, int Channel, unsigned char (*DPCM_LookUp)[MAX_INSTRUMENTS][OCTAVE_RANGE][NOTE_RANGE], unsigned int *iAssignedInstruments)
 {
 	unsigned int iPatternLen;
 	unsigned char NESNote, Note, Octave, Instrument, LastInstrument, Volume;
@@ -131,6 +270,7 @@ void CPatternCompiler::CompileData(CFamiTrackerDoc *pDoc, int Track, int Pattern
 	// Global init
 	m_bEmpty = true;
 	m_iHash = 0;
+	m_SamplesUsed.clear();
 
 	m_iZeroes = 0;
 	m_iCurrentDefaultDuration = 0xFF;
@@ -150,9 +290,8 @@ void CPatternCompiler::CompileData(CFamiTrackerDoc *pDoc, int Track, int Pattern
 		Volume		= ChanNote.Vol;
 		Action		= false;
 
-		CTrackerChannel *pTrackerChannel = pDoc->GetChannel(Channel);
-		int ChanID = pTrackerChannel->GetID();
-		int ChipID = pTrackerChannel->GetChip();
+		int ChanID = pDoc->GetChannelType(Channel);
+		int ChipID = pDoc->GetChipType(Channel);
 
 		// Check for delays, must come first
 		for (int j = 0; j < EffColumns; ++j) {
@@ -251,6 +390,7 @@ void CPatternCompiler::CompileData(CFamiTrackerDoc *pDoc, int Track, int Pattern
 					NESNote = LookUp << 1;
 					int Sample = ((CInstrument2A03*)pDoc->GetInstrument(DPCMInst))->GetSample(Octave, Note - 1) - 1;
 					m_bDSamplesAccessed[Sample] = true;
+					m_SamplesUsed.append((char)Sample);
 				}
 				else
 					NESNote = 0xFF;		// Invalid sample, skip
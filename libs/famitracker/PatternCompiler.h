@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <QByteArray>
+
 class CFamiTrackerDoc;
 
 struct stSpacingInfo {
@@ -47,6 +49,10 @@ public:
 	unsigned int	GetHash() const;
 
 private:
+	void CompilePattern(CFamiTrackerDoc *pDoc, int Track, int Pattern, int Channel, unsigned char (*DPCM_LookUp)[MAX_INSTRUMENTS][OCTAVE_RANGE][NOTE_RANGE], unsigned int *iAssignedInstruments);
+	QByteArray GetPatternKey(CFamiTrackerDoc *pDoc, int Track, int Pattern, int Channel, unsigned char (*DPCM_LookUp)[MAX_INSTRUMENTS][OCTAVE_RANGE][NOTE_RANGE], unsigned int *iAssignedInstruments);
+	bool LoadCached(const QByteArray &Digest, const QByteArray &Key);
+	void StoreCached(const QByteArray &Digest, const QByteArray &Key);
 	unsigned int FindInstrument(int Instrument, unsigned int *pInstList);
 	void WriteData(unsigned char Value);
 	void DispatchZeroes();
@@ -65,4 +71,5 @@ private:
 	bool			m_bDSamplesAccessed[OCTAVE_RANGE * NOTE_RANGE]; // <- check the range, its not optimal right now
 	bool			m_bEmpty;
 	unsigned int	m_iHash;
+	QByteArray		m_SamplesUsed;		// Samples accessed by this pattern
 };
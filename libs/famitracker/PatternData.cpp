@@ -30,6 +30,7 @@ CPatternData::CPatternData(unsigned int PatternLength, unsigned int Speed, unsig
 	// Clear memory
 	memset(m_iFrameList, 0, sizeof(short) * MAX_FRAMES * MAX_CHANNELS);
 	memset(m_pPatternData, 0, sizeof(stChanNote*) * MAX_CHANNELS * MAX_PATTERN);
+	memset(m_pPackedData, 0, sizeof(stPackedPattern*) * MAX_CHANNELS * MAX_PATTERN);
 	memset(m_iEffectColumns, 0, sizeof(int) * MAX_CHANNELS);
 
 	m_iPatternLength = PatternLength;
@@ -48,6 +49,7 @@ CPatternData::~CPatternData()
 	for (int i = 0; i < MAX_CHANNELS; ++i) {
 		for (int j = 0; j < MAX_PATTERN; ++j) {
 			SAFE_RELEASE_ARRAY(m_pPatternData[i][j]);
+			SAFE_RELEASE(m_pPackedData[i][j]);
 		}
 	}
 }
@@ -112,8 +114,11 @@ bool CPatternData::IsPatternInUse(unsigned int Channel, unsigned int Pattern)
 
 stChanNote *CPatternData::GetPatternData(int Channel, int Pattern, int Row)
 {
-	if (!m_pPatternData[Channel][Pattern])		// Allocate pattern if accessed for the first time
+	if (!m_pPatternData[Channel][Pattern]) {	// Allocate pattern if accessed for the first time
 		AllocatePattern(Channel, Pattern);
+		if (m_pPackedData[Channel][Pattern])	// and decode it if loaded from a file
+			UnpackPattern(Channel, Pattern);
+	}
 
 	return m_pPatternData[Channel][Pattern] + Row;
 }
@@ -137,6 +142,82 @@ void CPatternData::AllocatePattern(int Channel, int Pattern)
 	}
 }
 
+void CPatternData::UnpackPattern(int Channel, int Pattern)
+{
+	stPackedPattern *pPacked = m_pPackedData[Channel][Pattern];
+	const unsigned char *pData = (const unsigned char*)pPacked->Data.constData();
+
+	m_pPackedData[Channel][Pattern] = NULL;
+
+	// Rows were validated when the file was loaded
+	for (unsigned int i = 0; i < pPacked->Items; ++i) {
+		int Row;
+		memcpy(&Row, pData, sizeof(int));
+		pData += sizeof(int);
+
+		stChanNote *Note = m_pPatternData[Channel][Pattern] + Row;
+		memset(Note, 0, sizeof(stChanNote));
+
+		Note->Note		 = *pData++;
+		Note->Octave	 = *pData++;
+		Note->Instrument = *pData++;
+		Note->Vol		 = *pData++;
+
+		for (unsigned int n = 0; n < pPacked->EffColumns; ++n) {
+			Note->EffNumber[n] = *pData++;
+			Note->EffParam[n]  = *pData++;
+		}
+
+		if (Note->Vol > 0x10)
+			Note->Vol &= 0x0F;
+	}
+
+	delete pPacked;
+}
+
+void CPatternData::SetPackedPattern(int Channel, int Pattern, stPackedPattern *pPacked)
+{
+	// Takes ownership of pPacked
+
+	// Drop the empty pre-allocated pattern
+	if (m_pPatternData[Channel][Pattern] && IsPatternEmpty(Channel, Pattern))
+		SAFE_RELEASE_ARRAY(m_pPatternData[Channel][Pattern]);
+
+	// Same pattern stored twice, decode the first one
+	if (m_pPackedData[Channel][Pattern])
+		GetPatternData(Channel, Pattern, 0);
+
+	m_pPackedData[Channel][Pattern] = pPacked;
+
+	// Rows are already in memory, add these on top
+	if (m_pPatternData[Channel][Pattern])
+		UnpackPattern(Channel, Pattern);
+}
+
+void CPatternData::DetachPackedPatterns()
+{
+	// Copy packed patterns out of the mapped file, needed before the file is overwritten
+	for (int i = 0; i < MAX_CHANNELS; ++i) {
+		for (int j = 0; j < MAX_PATTERN; ++j) {
+			stPackedPattern *pPacked = m_pPackedData[i][j];
+			if (pPacked && !pPacked->File.isNull()) {
+				pPacked->Data = QByteArray(pPacked->Data.constData(), pPacked->Data.size());
+				pPacked->File.clear();
+			}
+		}
+	}
+}
+
+void CPatternData::UnpackFramePatterns()
+{
+	// Decode and allocate every pattern in the frame list, reading them
+	// after this doesn't modify anything so other threads can do it
+	for (unsigned int i = 0; i < m_iFrameCount; ++i) {
+		for (int j = 0; j < MAX_CHANNELS; ++j)
+			GetPatternData(j, m_iFrameList[i][j], 0);
+	}
+}
+
 void CPatternData::ClearEverything()
 {
 	// Resets everything
@@ -151,6 +232,7 @@ void CPatternData::ClearEverything()
 				delete [] m_pPatternData[i][j];
 				m_pPatternData[i][j] = NULL;
 			}
+			SAFE_RELEASE(m_pPackedData[i][j]);
 		}
 	}
 
@@ -161,6 +243,7 @@ void CPatternData::ClearPattern(int Channel, int Pattern)
 {
 	// Deletes a specified pattern in a channel
 	SAFE_RELEASE_ARRAY(m_pPatternData[Channel][Pattern]);
+	SAFE_RELEASE(m_pPackedData[Channel][Pattern]);
 }
 
 unsigned short CPatternData::GetFramePattern(int Frame, int Channel) const
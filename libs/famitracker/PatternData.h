@@ -21,6 +21,11 @@
 
 #pragma once
 
+#include <QByteArray>
+#include <QSharedPointer>
+
+class QFile;
+
 // Channel note struct, holds the data for each row in patterns
 struct stChanNote {
 	unsigned char Note;
@@ -31,6 +36,14 @@ struct stChanNote {
 	unsigned char EffParam[MAX_EFFECT_COLUMNS];
 };
 
+// A pattern kept in its file form until it's accessed, items are stored as in the PATTERNS block
+struct stPackedPattern {
+	QByteArray Data;					// Row (int), note, octave, instrument, volume and effects
+	unsigned int Items;
+	unsigned int EffColumns;
+	QSharedPointer<QFile> File;			// Keeps the mapped file open while Data points into it
+};
+
 // CPatternData holds all notes in the patterns
 class CPatternData {
 public:
@@ -76,6 +89,13 @@ public:
 	void ClearEverything();
 	void ClearPattern(int Channel, int Pattern);
 
+	// Packed patterns, these are decoded when first accessed
+	void SetPackedPattern(int Channel, int Pattern, stPackedPattern *pPacked);
+	const stPackedPattern *GetPackedPattern(int Channel, int Pattern) const
+		{ return m_pPackedData[Channel][Pattern]; };
+	void DetachPackedPatterns();
+	void UnpackFramePatterns();
+
 	stChanNote *GetPatternData(int Channel, int Pattern, int Row);
 
 	unsigned int GetPatternLength() const		{ return m_iPatternLength;	 };
@@ -93,6 +113,7 @@ public:
 
 private:
 	void AllocatePattern(int Channel, int Patterns);
+	void UnpackPattern(int Channel, int Pattern);
 
 	// Pattern data
 private:
@@ -110,4 +131,7 @@ private:
 
 	// All accesses to m_pPatternData must go through GetPatternData()
 	stChanNote *m_pPatternData[MAX_CHANNELS][MAX_PATTERN];
+
+	// Patterns not yet decoded from the file, only set where m_pPatternData is NULL
+	stPackedPattern *m_pPackedData[MAX_CHANNELS][MAX_PATTERN];
 };
@@ -121,8 +121,11 @@ CPatternView::CPatternView() :
 	m_iFastRedraws(0),
 	m_iErases(0),
 	m_iBuffers(0),
+	m_iRowsDrawn(0),
 	m_bForcePlayRowUpdate(false)
 {
+   memset(&m_LayoutState, 0, sizeof(LayoutDrawState_t));
+
    m_iPatternFontSize = ROW_HEIGHT;
    m_iRowHeight = m_iPatternFontSize;
    m_pBackDC = new CDC();
@@ -466,8 +469,8 @@ void CPatternView::Invalidate(bool bEntire)
 
 void CPatternView::Modified()
 {
-	// Marks the module as edited, forces a full redraw
-	m_bForceFullRedraw = true;
+	// Marks the module as edited, rows with changed cells are found when drawing
+	m_bUpdated = true;
 }
 
 void CPatternView::AdjustCursor()
@@ -599,15 +602,12 @@ CString patternEditorText;
 void CPatternView::DrawScreen(CDC *pDC, CFamiTrackerView *pView)
 {
 	static int Redraws = 0;
-	static bool WasSelecting;
 
 #ifdef _DEBUG
 	LARGE_INTEGER StartTime, EndTime;
 	LARGE_INTEGER Freq;
 #endif
 
-	bool bFast = false;
-
 	// Return if the back buffer isn't created
 	if (!m_pBackDC)
 		return;
@@ -623,28 +623,23 @@ void CPatternView::DrawScreen(CDC *pDC, CFamiTrackerView *pView)
 		AdjustCursor();
 		AdjustCursorChannel();
 
-		// See if a fast redraw is possible
-		if (m_iDrawCursorRow == (m_cpCursorPos.m_iRow - 1) && !m_bSelecting && !WasSelecting && !theApp.GetSettings()->General.bFreeCursorEdit && !m_bErasedBg) {
-			bFast = true;
-		}
+		// Save these as those could change during drawing
+		m_iDrawCursorRow = m_cpCursorPos.m_iRow;
+		m_iDrawMiddleRow = m_iMiddleRow;
 
-		if (m_bForceFullRedraw)
-			bFast = false;
+		LayoutDrawState_t Layout;
+		GetLayoutState(&Layout);
 
-		// Fast scrolling down
-		if (bFast) {
-			// TODO: Fails when jumping and skipping
-			m_iDrawCursorRow = m_cpCursorPos.m_iRow;
-			m_iDrawMiddleRow = m_iMiddleRow;
-			FastScrollDown(m_pBackDC);
-			m_pBackDC->SetWindowOrg(0, 0);
+		// Only redraw changed rows if the back buffer has the same layout
+		if (!m_bForceFullRedraw && !m_bErasedBg && !memcmp(&Layout, &m_LayoutState, sizeof(LayoutDrawState_t))) {
+			DrawHeader(m_pBackDC);
+			UpdateRowArea(m_pBackDC);
+			DrawMeters(m_pBackDC);
 			m_iFastRedraws++;
-		} 
+		}
 		else {
-			// Save these as those could change during drawing
-			m_iDrawCursorRow = m_cpCursorPos.m_iRow;
-			m_iDrawMiddleRow = m_iMiddleRow;
 			PaintEditor();
+			m_LayoutState = Layout;
 			m_iRedraws++;
 		}
 	}
@@ -652,19 +647,14 @@ void CPatternView::DrawScreen(CDC *pDC, CFamiTrackerView *pView)
 	m_bForceFullRedraw = false;
 	m_bUpdated = false;
 
-	if (bFast)
-		// Skip header
-		pDC->BitBlt(0, HEADER_HEIGHT, m_iVisibleWidth + ROW_COL_WIDTH, m_iWinHeight - HEADER_HEIGHT, m_pBackDC, 0, HEADER_HEIGHT, SRCCOPY);
-	else {
-		// Copy the back buffer to screen
-		if (m_bDrawEntire)
-			DrawUnbufferedArea(pDC);
-		
-		pDC->BitBlt(0, 0, m_iVisibleWidth + ROW_COL_WIDTH, m_iWinHeight, m_pBackDC, 0, 0, SRCCOPY);
+	// Copy the back buffer to screen
+	if (m_bDrawEntire)
+		DrawUnbufferedArea(pDC);
+	
+	pDC->BitBlt(0, 0, m_iVisibleWidth + ROW_COL_WIDTH, m_iWinHeight, m_pBackDC, 0, 0, SRCCOPY);
 
-		// Auto-reset this
-		m_bDrawEntire = false;
-	}
+	// Auto-reset this
+	m_bDrawEntire = false;
 
 #ifdef _DEBUG
 	pDC->SetBkColor(DEFAULT_COLOR_SCHEME.CURSOR);
@@ -695,6 +685,8 @@ void CPatternView::DrawScreen(CDC *pDC, CFamiTrackerView *pView)
 	pDC->TextOut(m_iWinWidth - 150, PosY, Text); PosY += 20;
 	Text.Format(_T("%i chars drawn"), m_iCharsDrawn);
 	pDC->TextOut(m_iWinWidth - 150, PosY, Text); PosY += 20;
+	Text.Format(_T("%i rows drawn"), m_iRowsDrawn);
+	pDC->TextOut(m_iWinWidth - 150, PosY, Text); PosY += 20;
 	Text.Format(_T("%i rows visible"), m_iVisibleRows);
 	pDC->TextOut(m_iWinWidth - 150, PosY, Text); PosY += 20;
 
@@ -745,7 +737,6 @@ void CPatternView::DrawScreen(CDC *pDC, CFamiTrackerView *pView)
 	pDC->DrawText(patternEditorText, CRect(m_iPatternWidth + 50, m_iWinHeight / 2, m_iWinWidth , m_iWinHeight), DT_WORDBREAK);
 #endif
 
-	WasSelecting = m_bSelecting;
 	m_bErasedBg = false;
 
 	UpdateVerticalScroll();
@@ -931,41 +922,15 @@ void CPatternView::DrawRowArea(CDC *pDC)
 	COLORREF ColBg = theApp.GetSettings()->Appearance.iColBackground;
 	CFont *OldFont = pDC->SelectObject(&m_fontPattern);
 
-	int Row = m_iDrawMiddleRow - m_iVisibleRows / 2;
 	int Channels = m_pDocument->GetAvailableChannels();
 
 	pDC->SetBkMode(TRANSPARENT);
 
-	// TODO: call some function recursively to preview more than just two frames
+	m_vRowState.resize(m_iVisibleRows > 0 ? m_iVisibleRows : 0);
 
 	for (int i = 0; i < m_iVisibleRows; ++i) {
-		if (Row >= 0 && Row < m_iPatternLength) {
-			DrawRow(pDC, Row, i, m_iDrawFrame, false);
-		}
-		else if (theApp.GetSettings()->General.bFramePreview) {
-			// Next frame
-			if (m_iDrawFrame < signed(m_pDocument->GetFrameCount() - 1) && Row >= m_iPatternLength) {
-				int PatternRow = (Row - m_iPatternLength);
-				if (PatternRow >= 0 && PatternRow < m_iNextPatternLength)
-					DrawRow(pDC, PatternRow, i, m_iDrawFrame + 1, true);
-				else
-					ClearRow(pDC, i);
-			}
-			// Previous frame
-			else if (m_iDrawFrame > 0 && Row < 0) {
-				int PatternRow = (m_iPrevPatternLength + Row);
-				if (PatternRow >= 0 && PatternRow < m_iPrevPatternLength)
-					DrawRow(pDC, PatternRow, i, m_iDrawFrame - 1, true);
-				else
-					ClearRow(pDC, i);
-			}
-			else
-				ClearRow(pDC, i);
-		}
-		else {
-			ClearRow(pDC, i);
-		}
-		++Row;
+		GetRowState(i, &m_vRowState[i]);
+		DrawLine(pDC, m_vRowState[i], i);
 	}
 
 	// Last unvisible row
@@ -991,6 +956,214 @@ void CPatternView::DrawRowArea(CDC *pDC)
 	pDC->SelectObject(OldFont);
 }
 
+void CPatternView::UpdateRowArea(CDC *pDC)
+{
+	// Draw only rows that changed since last time, the back buffer is scrolled first if the rows moved
+
+	const int Lines = m_iVisibleRows > 0 ? m_iVisibleRows : 0;
+
+	std::vector<RowDrawState_t> NewState(Lines);
+
+	for (int i = 0; i < Lines; ++i)
+		GetRowState(i, &NewState[i]);
+
+	m_vRowState.resize(Lines);
+
+	// Find the number of lines the rows has moved by
+	int Shift = 0;
+	bool bFound = false;
+
+	for (int i = 0; i < Lines && !bFound; ++i) {
+		if (NewState[i].Row < 0)
+			continue;
+		for (int j = 0; j < Lines; ++j) {
+			const RowDrawState_t &Old = m_vRowState[j];
+			if (Old.Valid && Old.Row == NewState[i].Row && Old.Frame == NewState[i].Frame) {
+				Shift = j - i;
+				bFound = true;
+				break;
+			}
+		}
+	}
+
+	if (Shift != 0 && abs(Shift) < Lines) {
+		ScrollRowArea(pDC, Shift);
+		if (Shift > 0) {
+			for (int i = 0; i < Lines - Shift; ++i)
+				m_vRowState[i] = m_vRowState[i + Shift];
+			for (int i = Lines - Shift; i < Lines; ++i)
+				m_vRowState[i].Valid = 0;
+		}
+		else {
+			for (int i = Lines - 1; i >= -Shift; --i)
+				m_vRowState[i] = m_vRowState[i + Shift];
+			for (int i = 0; i < -Shift; ++i)
+				m_vRowState[i].Valid = 0;
+		}
+	}
+
+	CFont *OldFont = pDC->SelectObject(&m_fontPattern);
+	pDC->SetBkMode(TRANSPARENT);
+
+	for (int i = 0; i < Lines; ++i) {
+		if (IsRowChanged(m_vRowState[i], NewState[i])) {
+			DrawLine(pDC, NewState[i], i);
+			m_vRowState[i] = NewState[i];
+		}
+	}
+
+	pDC->SetWindowOrg(0, 0);
+	pDC->SelectObject(OldFont);
+}
+
+void CPatternView::ScrollRowArea(CDC *pDC, int Lines)
+{
+	// Move the row area in the back buffer, positive is up
+	int Width = ROW_COL_WIDTH + m_iPatternWidth - 1;
+	int Step = abs(Lines) * m_iRowHeight;
+	int Height = (m_iVisibleRows - abs(Lines)) * m_iRowHeight;
+
+	pDC->SetWindowOrg(0, 0);
+
+	if (Lines > 0) {
+		// Copying upwards can be done at once
+		pDC->BitBlt(1, HEADER_HEIGHT, Width, Height, pDC, 1, HEADER_HEIGHT + Step, SRCCOPY);
+	}
+	else {
+		// Copying downwards is done in parts starting from the bottom to not overwrite the source
+		for (int y = Height; y > 0; y -= Step) {
+			int Part = (y < Step) ? y : Step;
+			pDC->BitBlt(1, HEADER_HEIGHT + Step + y - Part, Width, Part, pDC, 1, HEADER_HEIGHT + y - Part, SRCCOPY);
+		}
+	}
+}
+
+void CPatternView::DrawLine(CDC *pDC, const RowDrawState_t &State, int Line)
+{
+	if (State.Row >= 0)
+		DrawRow(pDC, State.Row, Line, State.Frame, State.Preview != 0);
+	else
+		ClearRow(pDC, Line);
+
+	++m_iRowsDrawn;
+}
+
+static int GetSelectionKey(const CSelection &sel, int Row)
+{
+	// Everything that decides how a selection is drawn on a row
+	if (Row < sel.GetRowStart() || Row > sel.GetRowEnd())
+		return 0;
+
+	return 1 | ((Row == sel.GetRowStart()) << 1) | ((Row == sel.GetRowEnd()) << 2) |
+		(sel.GetChanStart() << 3) | (sel.GetColStart() << 8) | (sel.GetChanEnd() << 13) | (sel.GetColEnd() << 18);
+}
+
+void CPatternView::GetRowState(int Line, RowDrawState_t *pState) const
+{
+	// Find out what is drawn on a line
+
+	int Row = m_iDrawMiddleRow - m_iVisibleRows / 2 + Line;
+	int Frame = m_iDrawFrame;
+	bool bPreview = false;
+
+	memset(pState, 0, sizeof(RowDrawState_t));
+
+	pState->Valid = 1;
+	pState->Cursor = -1;
+
+	// TODO: call some function recursively to preview more than just two frames
+
+	if (Row < 0 || Row >= m_iPatternLength) {
+		int PatternRow = -1;
+
+		if (theApp.GetSettings()->General.bFramePreview) {
+			// Next frame
+			if (m_iDrawFrame < signed(m_pDocument->GetFrameCount() - 1) && Row >= m_iPatternLength) {
+				if ((Row - m_iPatternLength) < m_iNextPatternLength)
+					PatternRow = Row - m_iPatternLength;
+				Frame = m_iDrawFrame + 1;
+			}
+			// Previous frame
+			else if (m_iDrawFrame > 0 && Row < 0) {
+				if ((m_iPrevPatternLength + Row) >= 0)
+					PatternRow = m_iPrevPatternLength + Row;
+				Frame = m_iDrawFrame - 1;
+			}
+		}
+
+		Row = PatternRow;
+		bPreview = true;
+	}
+
+	if (Row < 0) {
+		// Empty line
+		pState->Frame = -1;
+		pState->Row = -1;
+		return;
+	}
+
+	pState->Frame = Frame;
+	pState->Row = Row;
+	pState->Preview = bPreview;
+	pState->PlayRow = !m_bFollowMode && Row == m_iPlayRow && Frame == m_iPlayFrame && theApp.IsPlaying();
+
+	if (!bPreview) {
+		if (Row == m_iDrawCursorRow)
+			pState->Cursor = (m_cpCursorPos.m_iChannel << 8) | m_cpCursorPos.m_iColumn;
+		if (m_bSelecting)
+			pState->Selection = GetSelectionKey(m_selection, Row);
+		if (m_bDragging)
+			pState->Drag = GetSelectionKey(m_selDrag, Row);
+	}
+
+	if (Frame < signed(m_pDocument->GetFrameCount())) {
+		for (int i = m_iFirstChannel; i < m_iFirstChannel + m_iChannelsVisible; ++i) {
+			m_pDocument->GetNoteData(Frame, i, Row, &pState->Notes[i]);
+			int Instrument = pState->Notes[i].Instrument;
+			if (Instrument < MAX_INSTRUMENTS && !m_pDocument->IsInstrumentUsed(Instrument))
+				pState->Missing |= 1 << i;
+		}
+	}
+}
+
+void CPatternView::GetLayoutState(LayoutDrawState_t *pState) const
+{
+	const CSettings *pSettings = theApp.GetSettings();
+
+	memset(pState, 0, sizeof(LayoutDrawState_t));
+
+	pState->FirstChannel	= m_iFirstChannel;
+	pState->ChannelsVisible	= m_iChannelsVisible;
+	pState->PatternWidth	= m_iPatternWidth;
+	pState->VisibleRows		= m_iVisibleRows;
+	pState->RowHeight		= m_iRowHeight;
+	pState->Highlight		= m_iHighlight;
+	pState->HighlightSecond	= m_iHighlightSecond;
+	pState->Focus			= m_bHasFocus;
+	pState->EditMode		= m_pView->GetEditMode();
+	pState->RowInHex		= pSettings->General.bRowInHex;
+	pState->PatternColor	= pSettings->General.bPatternColor;
+	pState->FramePreview	= pSettings->General.bFramePreview;
+
+	for (int i = m_iFirstChannel; i < m_iFirstChannel + m_iChannelsVisible; ++i)
+		pState->ChannelWidths[i] = m_iChannelWidths[i];
+}
+
+bool CPatternView::IsRowChanged(const RowDrawState_t &Old, const RowDrawState_t &New) const
+{
+	if (!Old.Valid || Old.Frame != New.Frame || Old.Row != New.Row || Old.Preview != New.Preview)
+		return true;
+
+	if (Old.Cursor != New.Cursor || Old.PlayRow != New.PlayRow || Old.Selection != New.Selection || Old.Drag != New.Drag)
+		return true;
+
+	if (Old.Missing != New.Missing)
+		return true;
+
+	// Only visible channels are stored
+	return memcmp(Old.Notes + m_iFirstChannel, New.Notes + m_iFirstChannel, sizeof(stChanNote) * m_iChannelsVisible) != 0;
+}
+
 void CPatternView::ClearRow(CDC *pDC, int Line) 
 {
 	int ColBg = m_colEmptyBg;
@@ -1791,50 +1964,6 @@ void CPatternView::DrawChar(int x, int y, TCHAR c, COLORREF Color, CDC *pDC)
 ////////////////////////////////////////////////////////////////////////////////////
 
 // TODO: change this to universal scroll up and down any number of steps
-void CPatternView::FastScrollDown(CDC *pDC)
-{
-	CFont *OldFont = pDC->SelectObject(&m_fontPattern);
-	pDC->SetBkMode(TRANSPARENT);
-
-	int Top = HEADER_HEIGHT + ((m_iVisibleRows / 2) + 2) * m_iRowHeight;
-	int Width = ROW_COL_WIDTH + m_iPatternWidth - 1;
-	int Height = (m_iVisibleRows / 2) * m_iRowHeight - 1;
-	int Row;
-
-	// Save cursor position
-	m_iDrawCursorRow = m_cpCursorPos.m_iRow;
-
-	// Bottom section
-	pDC->BitBlt(1, Top - m_iRowHeight, Width, Height - m_iRowHeight + 1, pDC, 1, Top, SRCCOPY); 
-
-	// Top section
-	Top = HEADER_HEIGHT + m_iRowHeight;
-	pDC->BitBlt(1, Top - m_iRowHeight, Width, Height, pDC, 1, Top, SRCCOPY); 
-
-	// Bottom row
-	Row = m_iDrawCursorRow + (m_iVisibleRows / 2) - ((m_iVisibleRows & 1) ? 0 : 1);
-	if (Row < m_iPatternLength) 
-		DrawRow(pDC, Row, m_iVisibleRows - 1, m_iCurrentFrame, false);
-	else if ((Row - m_iPatternLength) < m_iNextPatternLength && unsigned(m_iCurrentFrame) < (m_pDocument->GetFrameCount() - 1))
-		DrawRow(pDC, (Row - m_iPatternLength), m_iVisibleRows - 1, m_iCurrentFrame + 1, true);
-	else
-		ClearRow(pDC, m_iVisibleRows - 1);
-
-	// Middle row
-	Row = m_iDrawCursorRow;
-	if (Row < m_iPatternLength && Row >= 0)
-		DrawRow(pDC, Row, m_iVisibleRows / 2, m_iCurrentFrame, false);
-
-	// Above middle row
-	Row = m_iDrawCursorRow - 1;
-	if (Row < m_iPatternLength && Row >= 0)
-		DrawRow(pDC, Row, m_iVisibleRows / 2 - 1, m_iCurrentFrame, false);
-
-	pDC->SelectObject(OldFont);
-
-	UpdateVerticalScroll();
-}
-
 // Cursor movement
 
 void CPatternView::ResetSelection()
@@ -2062,9 +2191,6 @@ void CPatternView::MoveToRow(int Row)
 		}
 	}
 
-	if (m_bSelecting)
-		m_bForceFullRedraw = true;
-
 	if (Row < 0)
 		Row = 0;
 	if (Row > (int)m_pDocument->GetPatternLength())
@@ -2104,7 +2230,6 @@ void CPatternView::MoveToFrame(int Frame)
 
 	m_iCurrentFrame = Frame;
 	m_bSelecting = false;
-	m_bForceFullRedraw = true;
 }
 
 void CPatternView::MoveToChannel(int Channel)
@@ -2208,7 +2333,6 @@ bool CPatternView::StepRow()
 
 bool CPatternView::StepFrame()
 {
-	m_bForceFullRedraw = true;
 	m_iPlayFrame++;
 	if (m_iPlayFrame >= (signed)m_pDocument->GetFrameCount()) {
 		m_iPlayFrame = 0;
@@ -26,6 +26,8 @@
 
 enum {TRANSPOSE_DEC_NOTES, TRANSPOSE_INC_NOTES, TRANSPOSE_DEC_OCTAVES, TRANSPOSE_INC_OCTAVES};
 
+#include <vector>
+
 #include "cqtmfc.h"
 
 // Graphical layout of pattern editor
@@ -62,6 +64,37 @@ struct RowColorInfo_t {
 	COLORREF Shaded;
 };
 
+// Drawn state of a row in the back buffer, a row is only redrawn when this changes
+struct RowDrawState_t {
+	int Valid;
+	int Frame;
+	int Row;				// -1 for empty lines
+	int Preview;
+	int Cursor;				// Cursor channel and column, -1 if not on this row
+	int PlayRow;
+	int Selection;			// Selection and drag area on this row
+	int Drag;
+	unsigned int Missing;	// Channels referring to a missing instrument
+	stChanNote Notes[MAX_CHANNELS];
+};
+
+// Settings that affect every row, changing any of these redraws everything
+struct LayoutDrawState_t {
+	int FirstChannel;
+	int ChannelsVisible;
+	int PatternWidth;
+	int VisibleRows;
+	int RowHeight;
+	int Highlight;
+	int HighlightSecond;
+	int Focus;
+	int EditMode;
+	int RowInHex;
+	int PatternColor;
+	int FramePreview;
+	int ChannelWidths[MAX_CHANNELS];
+};
+
 // Cursor position
 class CCursorPos {
 public:
@@ -138,7 +171,6 @@ public:
 	void UpdateScreen(CDC *pDC);
 	void DrawHeader(CDC *pDC);
 	void DrawMeters(CDC *pDC);
-	void FastScrollDown(CDC *pDC);
 
 	void SetDPCMState(stDPCMState State);
 
@@ -252,6 +284,11 @@ public:
 	int GetChannelWidth(int i) const { return m_iChannelWidths[i]; }
 	int GetVisibleWidth() const { return m_iVisibleWidth; }
 
+	// Benchmarking, full and incremental redraws and the total number of rows drawn
+	int GetRedrawCount() const { return m_iRedraws; }
+	int GetFastRedrawCount() const { return m_iFastRedraws; }
+	int GetRowsDrawnCount() const { return m_iRowsDrawn; }
+
 	CSelection GetSelection() const;
 	void SetSelection(CSelection &selection);
 
@@ -278,7 +315,14 @@ private:
 
 	void ClearRow(CDC *pDC, int Line);
 	void DrawRowArea(CDC *pDC);
+	void UpdateRowArea(CDC *pDC);
+	void ScrollRowArea(CDC *pDC, int Lines);
 	void DrawRow(CDC *pDC, int Row, int Line, int Frame, bool bPreview);
+	void DrawLine(CDC *pDC, const RowDrawState_t &State, int Line);
+
+	void GetRowState(int Line, RowDrawState_t *pState) const;
+	void GetLayoutState(LayoutDrawState_t *pState) const;
+	bool IsRowChanged(const RowDrawState_t &Old, const RowDrawState_t &New) const;
 
 	void DrawCell(int PosX, int Column, int Channel, bool bInvert, stChanNote *pNoteData, CDC *pDC, RowColorInfo_t *pColorInfo);
 	void DrawChar(int x, int y, TCHAR c, COLORREF Color, CDC *pDC);
@@ -358,6 +402,10 @@ private:
 	bool m_bForceFullRedraw;
 	bool m_bDrawEntire;
 
+	// What's currently in the back buffer
+	std::vector<RowDrawState_t> m_vRowState;
+	LayoutDrawState_t m_LayoutState;
+
 	int	m_iActualLengths[MAX_FRAMES];
 	int	m_iNextPreviewFrame[MAX_FRAMES];
 
@@ -417,5 +465,5 @@ private:
 	int		m_iCurrentHScrollPos;
 
 	// Benchmarking
-	int m_iRedraws, m_iFastRedraws, m_iErases, m_iBuffers, m_iCharsDrawn;
+	int m_iRedraws, m_iFastRedraws, m_iErases, m_iBuffers, m_iCharsDrawn, m_iRowsDrawn;
 };
@@ -74,10 +74,9 @@ void CSWSpectrum::SetSampleRate(int SampleRate)
 
 	m_pFftObject = new Fft(FFT_POINTS, SampleRate);
 
-	memset(m_iFftPoint, 0, sizeof(int) * FFT_POINTS);
+	memset(m_iFftPoint, 0, sizeof(int) * WIN_WIDTH);
 
 	m_iCount = 0;
-	m_iFillPos = 0;
 }
 
 void CSWSpectrum::SetSampleData(int *pSamples, unsigned int iCount)
@@ -85,28 +84,9 @@ void CSWSpectrum::SetSampleData(int *pSamples, unsigned int iCount)
 	m_iCount = iCount;
 	m_pSamples = pSamples;
 
-	int size, offset = 0;
-
-	if (m_iFillPos > 0) {
-		size = FFT_POINTS - m_iFillPos;
-		memcpy(m_pSampleBuffer + m_iFillPos, pSamples, size*4);
-		m_pFftObject->CopyIn(FFT_POINTS, m_pSampleBuffer);
-		m_pFftObject->Transform();
-		offset += size;
-		iCount -= size;
-	}
-
-	while (iCount >= FFT_POINTS) {
-		m_pFftObject->CopyIn(FFT_POINTS, pSamples + offset);
-		m_pFftObject->Transform();
-		offset += FFT_POINTS;
-		iCount -= FFT_POINTS;
-	}
-
-	// Copy rest
-	size = iCount;
-	memcpy(m_pSampleBuffer, pSamples + offset, size*4);
-	m_iFillPos = size;
+	// The FFT keeps the last FFT_POINTS samples, analysis windows overlap when fewer samples arrive
+	m_pFftObject->CopyIn(iCount, pSamples);
+	m_pFftObject->Transform();
 }
 
 void CSWSpectrum::Draw(CDC *pDC, bool bMessage)
@@ -116,23 +96,36 @@ void CSWSpectrum::Draw(CDC *pDC, bool bMessage)
 	if (bMessage)
 		return;
 
+	// Levels grow with the square root of the FFT size, scale to the 256 point display
+	const float Scale = 400.0f * sqrtf(float(FFT_POINTS) / 256.0f);
+
 	float Stepping = (float)(FFT_POINTS) / (float(WIN_WIDTH) * 4.0f);
 	float Step = 0;
 
 	for (i = 0; i < WIN_WIDTH; i++) {
-		bar = (int)m_pFftObject->GetIntensity(int(Step)) / 400;
+		// Use the strongest of the points covered by this bar
+		int First = int(Step);
+		int Last = int(Step + Stepping);
+		double Intensity = m_pFftObject->GetIntensity(First);
+
+		for (int j = First + 1; j < Last; ++j) {
+			if (m_pFftObject->GetIntensity(j) > Intensity)
+				Intensity = m_pFftObject->GetIntensity(j);
+		}
+
+		bar = int(Intensity / Scale);
 
 		if (bar < 0)
 			bar = 0;
 		if (bar > WIN_HEIGHT)
 			bar = WIN_HEIGHT;
 
-		if (bar > m_iFftPoint[(int)Step])
-			m_iFftPoint[(int)Step] = bar;
+		if (bar > m_iFftPoint[i])
+			m_iFftPoint[i] = bar;
 		else
-			m_iFftPoint[(int)Step] -= 2;
+			m_iFftPoint[i] -= 2;
 
-		bar = m_iFftPoint[(int)Step];
+		bar = m_iFftPoint[i];
 
 		for (y = 0; y < WIN_HEIGHT; y++) {
 			if (y < bar)
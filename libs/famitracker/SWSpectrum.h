@@ -23,7 +23,7 @@
 #include "SampleWindow.h"
 #include "FFT/Fft.h"
 
-const int FFT_POINTS = 256;
+const int FFT_POINTS = 1024;
 
 class CSWSpectrum : public CSampleWinState
 {
@@ -46,12 +46,8 @@ private:
 
 	int	m_iLogTable[WIN_HEIGHT];
 
-	int m_iFillPos;
-
 	BITMAPINFO bmi;
 
 	Fft	*m_pFftObject;
-	int	m_iFftPoint[FFT_POINTS];
-
-	int m_pSampleBuffer[FFT_POINTS];
+	int	m_iFftPoint[WIN_WIDTH];
 };
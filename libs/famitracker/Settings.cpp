@@ -41,6 +41,17 @@
 #define SETTING_STRING(Section, Entry, Default, Variable)	\
 	AddSetting(new CSettingString(_T(Section), _T(Entry), Default, Variable))	\
 
+// Registry entries of the channel pan settings, in CHANID_* order
+static LPCTSTR PAN_ENTRIES[CHANNELS] = {
+	_T("Square 1"), _T("Square 2"), _T("Triangle"), _T("Noise"), _T("DPCM"),
+	_T("VRC6 Pulse 1"), _T("VRC6 Pulse 2"), _T("VRC6 Sawtooth"),
+	_T("MMC5 Square 1"), _T("MMC5 Square 2"), _T("MMC5 Voice"),
+	_T("N163 1"), _T("N163 2"), _T("N163 3"), _T("N163 4"), _T("N163 5"), _T("N163 6"), _T("N163 7"), _T("N163 8"),
+	_T("FDS"),
+	_T("VRC7 1"), _T("VRC7 2"), _T("VRC7 3"), _T("VRC7 4"), _T("VRC7 5"), _T("VRC7 6"),
+	_T("S5B 1"), _T("S5B 2"), _T("S5B 3")
+};
+
 // CSettings
 
 CSettings::CSettings() : m_iAddedSettings(0)
@@ -109,6 +120,11 @@ void CSettings::SetupSettings()
 	SETTING_INT("Sound", "Treble filter freq", 12000, &Sound.iTrebleFilter);
 	SETTING_INT("Sound", "Treble filter damping", 24, &Sound.iTrebleDamping);
 	SETTING_INT("Sound", "Volume", 100, &Sound.iMixVolume);
+	SETTING_BOOL("Sound", "Stereo", false, &Sound.bStereo);
+
+	// Channel panning, used for stereo output
+	for (int i = 0; i < CHANNELS; ++i)
+		AddSetting(new CSettingInt(_T("Panning"), PAN_ENTRIES[i], PAN_CENTER, &Sound.iChannelPan[i]));
 
 	// Midi
 	SETTING_INT("MIDI", "Device", 0, &Midi.iMidiDevice);
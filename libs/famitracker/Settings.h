@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "APU/Mixer.h"
+
 // CSettings command target
 
 enum EDIT_STYLES {
@@ -142,6 +144,8 @@ public:
 		int		iTrebleFilter;
 		int		iTrebleDamping;
 		int		iMixVolume;
+		bool	bStereo;
+		int		iChannelPan[CHANNELS];		// PAN_LEFT to PAN_RIGHT, by CHANID_*
 	} Sound;
 
 	struct {
@@ -24,6 +24,10 @@
 
 #include "stdafx.h"
 #include <cmath>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QRunnable>
+#include <QThreadPool>
 #include "FamiTracker.h"
 #include "FamiTrackerDoc.h"
 #include "FamiTrackerView.h"
@@ -54,6 +58,64 @@
 // Write a file with the volume table
 //#define WRITE_VOLUME_FILE
 
+// Offline rendering runs frames back to back for this long (ms) before
+// returning to the event loop
+const int RENDER_SLICE_TIME = 50;
+
+// Offline generators have no sound card, they collect this many ms of
+// audio before writing it to the wave file
+const int OFFLINE_BUFFER_LENGTH = 100;
+
+// The FDS sound emulation and the 5B channel handlers keep their state in
+// globals so only one generator using those chips may run at a time
+static QMutex ExclusiveChipLock;
+
+// Renders one stem export job on a pool thread
+class CStemRenderJob : public QRunnable
+{
+public:
+	CStemRenderJob(CSoundGen *pParent, CFamiTrackerDoc *pDoc, const stStemJob &Job, int SongEndType, int SongEndParam, QReadWriteLock *pDocumentLock, QAtomicInt *pCancel) :
+		m_pParent(pParent), m_pDocument(pDoc), m_Settings(pParent->GetSoundSettings()), m_Job(Job), m_iSongEndType(SongEndType), m_iSongEndParam(SongEndParam), m_pDocumentLock(pDocumentLock), m_pCancel(pCancel) {}
+
+	void run() {
+		bool bSuccess = false;
+
+		// The jobs only read the document, anything that changes it
+		// takes the write side through LockDocument
+		m_pDocumentLock->lockForRead();
+
+		if (!m_pCancel->fetchAndAddOrdered(0)) {
+			bool bExclusive = (m_pDocument->GetExpansionChip() & (SNDCHIP_FDS | SNDCHIP_S5B)) != 0;
+
+			if (bExclusive)
+				ExclusiveChipLock.lock();
+
+			// The generator is created here so it belongs to this thread
+			{
+				CSoundGen Renderer(m_pDocument, m_Settings);
+				bSuccess = Renderer.RenderStem(m_Job, m_iSongEndType, m_iSongEndParam, m_pCancel);
+			}
+
+			if (bExclusive)
+				ExclusiveChipLock.unlock();
+		}
+
+		m_pDocumentLock->unlock();
+
+		m_pParent->StemIsDone(bSuccess);
+	}
+
+private:
+	CSoundGen		*m_pParent;
+	CFamiTrackerDoc	*m_pDocument;
+	stSoundSettings	m_Settings;
+	stStemJob		m_Job;
+	int				m_iSongEndType;
+	int				m_iSongEndParam;
+	QReadWriteLock	*m_pDocumentLock;
+	QAtomicInt		*m_pCancel;
+};
+
 // The depth of each vibrato level
 const double CSoundGen::NEW_VIBRATO_DEPTH[] = {
 	1.0, 1.5, 2.5, 4.0, 5.0, 7.0, 10.0, 12.0, 14.0, 17.0, 22.0, 30.0, 44.0, 64.0, 96.0, 128.0
@@ -95,7 +157,15 @@ CSoundGen::CSoundGen() :
 	m_iTempo(0),
 	m_bPlayerHalted(false),
 	m_bWaveChanged(false),
-	m_iMachineType(NTSC)
+	m_iMachineType(NTSC),
+	m_bOffline(false),
+	m_iPlayTrack(0),
+	m_iChannelMask(~0u),
+	m_iPlayFrame(0),
+	m_iPlayRow(0),
+	m_bRenderingStems(0),
+	m_bStopStems(0),
+	m_iStemsTotal(0)
 {
    pThread = new QThread();
 
@@ -120,7 +190,61 @@ CSoundGen::CSoundGen() :
 	// Create all kinds of channels
 	CreateChannels();
 
-	m_pAPU->SetNamcoMixing(theApp.GetSettings()->m_bNamcoMixing);
+	m_Settings = CaptureSoundSettings();
+
+	m_pAPU->SetNamcoMixing(m_Settings.NamcoMixing);
+}
+
+CSoundGen::CSoundGen(CFamiTrackerDoc *pDoc, const stSoundSettings &Settings) : 
+	m_pAPU(NULL),
+	m_pSampleMem(NULL),
+	m_pDSound(NULL),
+	m_pDSoundChannel(NULL),
+	m_pAccumBuffer(NULL),
+	m_iGraphBuffer(NULL),
+	m_pDocument(pDoc),
+	m_pTrackerView(NULL),
+	m_bRendering(false),
+	m_bPlaying(false),
+	m_pPreviewSample(NULL),
+	m_pSampleWnd(NULL),
+	m_iSpeed(0),
+	m_iTempo(0),
+	m_bPlayerHalted(false),
+	m_bWaveChanged(false),
+	m_iMachineType(NTSC),
+	m_Settings(Settings),
+	m_bOffline(true),
+	m_iPlayTrack(0),
+	m_iChannelMask(~0u),
+	m_iPlayFrame(0),
+	m_iPlayRow(0),
+	m_bRenderingStems(0),
+	m_bStopStems(0),
+	m_iStemsTotal(0)
+{
+	// An offline generator renders the document straight to a wave file on
+	// the calling thread. It has no sound card, view or player thread and
+	// does not touch the application object.
+
+	pThread = NULL;
+
+	m_pSampleMem = new CSampleMem();
+	m_pAPU = new CAPU(this, m_pSampleMem);
+
+	CreateChannels();
+
+	m_pAPU->SetNamcoMixing(m_Settings.NamcoMixing);
+
+	// Same setup as the interactive generator gets when the document is loaded
+	ResetSound();
+	SetupChannels();
+	m_pAPU->SetExternalSound(pDoc->GetExpansionChip());
+	LoadMachineSettings(pDoc->GetMachine(), pDoc->GetEngineSpeed());
+	GenerateVibratoTable(pDoc->GetVibratoStyle());
+	ResetAPU();
+
+	m_iDelayedStart = 0;
 }
 
 CSoundGen::~CSoundGen()
@@ -134,6 +258,12 @@ CSoundGen::~CSoundGen()
 		SAFE_RELEASE(m_pChannels[i]);
 		SAFE_RELEASE(m_pTrackerChannels[i]);
 	}
+
+	// Offline generators never run ExitInstance
+	if (m_bOffline) {
+		SAFE_RELEASE_ARRAY(m_iGraphBuffer);
+		SAFE_RELEASE_ARRAY(m_pAccumBuffer);
+	}
 }
 
 void CSoundGen::onIdleSlot()
@@ -221,7 +351,7 @@ void CSoundGen::SetupChannels()
 	// Initialize channels
 	for (int i = 0; i < CHANNELS; ++i) {
 		if (m_pChannels[i]) {
-			m_pChannels[i]->InitChannel(m_pAPU, m_iVibratoTable, m_pDocument);
+			m_pChannels[i]->InitChannel(m_pAPU, m_iVibratoTable, m_pDocument, this);
 			m_pChannels[i]->MakeSilent();
 		}
 	}
@@ -251,7 +381,7 @@ void CSoundGen::AssignDocument(CFamiTrackerDoc *pDoc)
 	// Setup all channels
 	for (int i = 0; i < CHANNELS; ++i) {
 		if (m_pChannels[i])
-			m_pChannels[i]->InitChannel(m_pAPU, m_iVibratoTable, m_pDocument);
+			m_pChannels[i]->InitChannel(m_pAPU, m_iVibratoTable, m_pDocument, this);
 	}
 }
 
@@ -277,6 +407,10 @@ void CSoundGen::RemoveDocument()
 	if (!m_pDocument || !m_hThread)
 		return;
 
+	// Stem jobs read the document
+	StopRenderingStems();
+	EndRenderingStems();
+
 	// Player cannot play when removing the document
 	StopPlayer();
 
@@ -460,46 +594,56 @@ bool CSoundGen::ResetSound()
 	// Called from player thread
 	ASSERT(GetCurrentThreadId() == m_nThreadID);
 
-	CSettings *pSettings = theApp.GetSettings();
+	// Offline generators keep the settings they were created with
+	if (!m_bOffline)
+		m_Settings = CaptureSoundSettings();
 
-	unsigned int SampleSize = pSettings->Sound.iSampleSize;
-	unsigned int SampleRate = pSettings->Sound.iSampleRate;
-	unsigned int BufferLen	= pSettings->Sound.iBufferLength;
+	unsigned int SampleSize = m_Settings.SampleSize;
+	unsigned int SampleRate = m_Settings.SampleRate;
+	unsigned int Channels = m_Settings.Stereo ? 2 : 1;
 
 	m_iSampleSize = SampleSize;
 	m_iAudioUnderruns = 0;
 	m_iBufferPtr = 0;
 
-	// Close the old sound channel
-	if (m_pDSoundChannel) {
-		m_pDSound->CloseChannel(m_pDSoundChannel);
-		m_pDSoundChannel = NULL;
+	if (m_bOffline) {
+		m_iBufSizeSamples = (SampleRate * OFFLINE_BUFFER_LENGTH) / 1000 * Channels;
+		m_iBufSizeBytes	  = m_iBufSizeSamples * (SampleSize / 8);
 	}
+	else {
+		unsigned int BufferLen = theApp.GetSettings()->Sound.iBufferLength;
 
-	// Reinitialize direct sound
-	if (!m_pDSound->Init(m_hWnd, m_hNotificationEvent, theApp.GetSettings()->Sound.iDevice)) {
-		AfxMessageBox(_T("Direct sound error!"));
-		return false;
-	}
+		// Close the old sound channel
+		if (m_pDSoundChannel) {
+			m_pDSound->CloseChannel(m_pDSoundChannel);
+			m_pDSoundChannel = NULL;
+		}
 
-	int iBlocks = 1;	// default = 2
+		// Reinitialize direct sound
+		if (!m_pDSound->Init(m_hWnd, m_hNotificationEvent, theApp.GetSettings()->Sound.iDevice)) {
+			AfxMessageBox(_T("Direct sound error!"));
+			return false;
+		}
 
-	// Create more blocks if a bigger buffer than 100ms is used to enhance program response
-	if (BufferLen > 100)
-		iBlocks = (BufferLen / 66);
+		int iBlocks = 1;	// default = 2
 
-	// Create channel
-	m_pDSoundChannel = m_pDSound->OpenChannel(SampleRate, SampleSize, 1, BufferLen, iBlocks);
+		// Create more blocks if a bigger buffer than 100ms is used to enhance program response
+		if (BufferLen > 100)
+			iBlocks = (BufferLen / 66);
 
-	// Channel failed
-	if (m_pDSoundChannel == NULL) {
-		AfxMessageBox(_T("Direct sound error: Could not create buffer!"));
-		return false;
-	}
+		// Create channel
+		m_pDSoundChannel = m_pDSound->OpenChannel(SampleRate, SampleSize, Channels, BufferLen, iBlocks);
+
+		// Channel failed
+		if (m_pDSoundChannel == NULL) {
+			AfxMessageBox(_T("Direct sound error: Could not create buffer!"));
+			return false;
+		}
 
-	// Create a buffer
-	m_iBufSizeBytes	  = m_pDSoundChannel->GetBlockSize();
-	m_iBufSizeSamples = m_iBufSizeBytes / (SampleSize / 8);
+		// Create a buffer
+		m_iBufSizeBytes	  = m_pDSoundChannel->GetBlockSize();
+		m_iBufSizeSamples = m_iBufSizeBytes / (SampleSize / 8);
+	}
 
 	// Temp. audio buffer
 	SAFE_RELEASE(m_pAccumBuffer);
@@ -509,7 +653,7 @@ bool CSoundGen::ResetSound()
 	if (!m_pAccumBuffer)
 		return false;
 
-	// Sample graph buffer
+	// Sample graph buffer, stereo is drawn as the mix of both sides
 	SAFE_RELEASE(m_iGraphBuffer);
 	m_iGraphBuffer = new int32[m_iBufSizeSamples];
 
@@ -522,9 +666,12 @@ bool CSoundGen::ResetSound()
 		m_pSampleWnd->SetSampleRate(SampleRate);
 	}
 
-	if (!m_pAPU->SetupSound(SampleRate, 1, (m_iMachineType == NTSC) ? MACHINE_NTSC : MACHINE_PAL))
+	if (!m_pAPU->SetupSound(SampleRate, Channels, (m_iMachineType == NTSC) ? MACHINE_NTSC : MACHINE_PAL))
 		return false;
 
+	for (int i = 0; i < CHANNELS; ++i)
+		m_pAPU->SetChannelPan(i, m_Settings.Stereo ? m_Settings.ChannelPan[i] : PAN_CENTER);
+
 	m_pAPU->SetChipLevel(SNDCHIP_NONE, 0);//pSettings->ChipLevels.iLevel2A03);
 	m_pAPU->SetChipLevel(SNDCHIP_VRC6, 0);//pSettings->ChipLevels.iLevelVRC6);
 	m_pAPU->SetChipLevel(SNDCHIP_VRC7, 0);//pSettings->ChipLevels.iLevelVRC7);
@@ -534,11 +681,32 @@ bool CSoundGen::ResetSound()
 //	m_pAPU->SetChipLevel(SNDCHIP_S5B, pSettings->ChipLevels.iLevelS5B);
 
 	// Update blip-buffer filtering 
-	m_pAPU->SetupMixer(pSettings->Sound.iBassFilter, pSettings->Sound.iTrebleFilter,  pSettings->Sound.iTrebleDamping, pSettings->Sound.iMixVolume);
+	m_pAPU->SetupMixer(m_Settings.BassFilter, m_Settings.TrebleFilter, m_Settings.TrebleDamping, m_Settings.MixVolume);
 
 	return true;
 }
 
+stSoundSettings CSoundGen::CaptureSoundSettings()
+{
+	CSettings *pSettings = theApp.GetSettings();
+	stSoundSettings Settings;
+
+	Settings.SampleRate	   = pSettings->Sound.iSampleRate;
+	Settings.SampleSize	   = pSettings->Sound.iSampleSize;
+	Settings.BassFilter	   = pSettings->Sound.iBassFilter;
+	Settings.TrebleFilter  = pSettings->Sound.iTrebleFilter;
+	Settings.TrebleDamping = pSettings->Sound.iTrebleDamping;
+	Settings.MixVolume	   = pSettings->Sound.iMixVolume;
+	Settings.NamcoMixing   = pSettings->m_bNamcoMixing;
+	Settings.NoDPCMReset   = pSettings->General.bNoDPCMReset;
+	Settings.Stereo		   = pSettings->Sound.bStereo;
+
+	for (int i = 0; i < CHANNELS; ++i)
+		Settings.ChannelPan[i] = pSettings->Sound.iChannelPan[i];
+
+	return Settings;
+}
+
 void CSoundGen::CloseSound()
 {
 	// Called from player thread
@@ -582,7 +750,7 @@ void CSoundGen::FlushBuffer(int16 *pBuffer, uint32 Size)
 	const int SAMPLE_MAX = 32767;
 	const int SAMPLE_MIN = -32768;
 
-	if (!m_pDSoundChannel)
+	if (!m_pAccumBuffer || (!m_pDSoundChannel && !m_bRendering))
 		return;
 
 	BOOL bLocked = m_csDocumentLock.Unlock();
@@ -616,7 +784,12 @@ void CSoundGen::FlushBuffer(int16 *pBuffer, uint32 Size)
 		ASSERT(m_iBufferPtr < m_iBufSizeSamples);
 
 		// Sample scope
-		m_iGraphBuffer[m_iBufferPtr] = Sample;
+		if (!m_Settings.Stereo)
+			m_iGraphBuffer[m_iBufferPtr] = Sample;
+		else if (m_iBufferPtr & 1)
+			m_iGraphBuffer[m_iBufferPtr >> 1] = (m_iGraphBuffer[m_iBufferPtr >> 1] + Sample) / 2;
+		else
+			m_iGraphBuffer[m_iBufferPtr >> 1] = Sample;
 
 		// Convert sample and store in temp buffer
 		//if (m_iBufferPtr < m_iBufSizeBytes)
@@ -631,9 +804,9 @@ void CSoundGen::FlushBuffer(int16 *pBuffer, uint32 Size)
 		if (m_iBufferPtr >= m_iBufSizeSamples) {
 
 			if (m_bRendering) {
-//				// Output to file
-//				m_wfWaveFile.WriteWave((char*)m_pAccumBuffer, m_iBufSizeBytes);
-//				m_iBufferPtr = 0;
+				// Output to file, no need to wait for the sound card
+				m_wfWaveFile.WriteWave((char*)m_pAccumBuffer, m_iBufSizeBytes);
+				m_iBufferPtr = 0;
 			}
 			else {
 				// Output to direct sound
@@ -674,7 +847,7 @@ void CSoundGen::FlushBuffer(int16 *pBuffer, uint32 Size)
 				m_csSampleWndLock.Lock();
 
 				if (m_pSampleWnd)
-               emit DrawSamples((int*)m_iGraphBuffer, m_iBufSizeSamples);
+               emit DrawSamples((int*)m_iGraphBuffer, m_Settings.Stereo ? m_iBufSizeSamples / 2 : m_iBufSizeSamples);
 //					m_pSampleWnd->DrawSamples((int*)m_iGraphBuffer, m_iBufSizeSamples);
 
 				m_csSampleWndLock.Unlock();
@@ -708,7 +881,7 @@ void CSoundGen::FlushBuffer(int16 *pBuffer, uint32 Size)
 
 //// Tracker playing routines //////////////////////////////////////////////////////////////////////////////
 
-void CSoundGen::GenerateVibratoTable(int Type)
+void CSoundGen::CalculateVibratoTable(int Type, int *pTable)
 {
 	for (int i = 0; i < 16; ++i) {	// depth 
 		for (int j = 0; j < 16; ++j) {	// phase
@@ -721,9 +894,29 @@ void CSoundGen::GenerateVibratoTable(int Type)
 				value = (int)((double(j * OLD_VIBRATO_DEPTH[i]) / 16.0) + 1);
 			}
 
-			m_iVibratoTable[i * 16 + j] = value;
+			pTable[i * 16 + j] = value;
 		}
 	}
+}
+
+unsigned int CSoundGen::CalculateNamcoPeriod(int Note, int NamcoChannels)
+{
+	const double BASE_FREQ = 32.7032;
+	double clock_ntsc = CAPU::BASE_FREQ_NTSC / 16.0;
+
+	double Freq = BASE_FREQ * pow(2.0, double(Note) / 12.0);
+	double Pitch = (Freq * double(NamcoChannels) * 983040.0) / clock_ntsc;
+	unsigned int Period = (unsigned int)(Pitch) / 4;
+
+	if (Period > 0xFFFF)	// 0x3FFFF
+		Period = 0xFFFF;	// 0x3FFFF
+
+	return Period;
+}
+
+void CSoundGen::GenerateVibratoTable(int Type)
+{
+	CalculateVibratoTable(Type, m_iVibratoTable);
 
 #ifdef _DEBUG
 /*
@@ -765,29 +958,33 @@ void CSoundGen::BeginPlayer(int Mode)
 	// Called from player thread
 	ASSERT(GetCurrentThreadId() == m_nThreadID);
 
-	if (!m_pDSoundChannel || !m_pDocument || !m_pDocument->IsFileLoaded())
+	if ((!m_pDSoundChannel && !m_bOffline) || !m_pDocument || !m_pDocument->IsFileLoaded())
+		return;
+
+	// Stem jobs have the sound chips to themselves
+	if (IsRenderingStems())
 		return;
 
 	switch (Mode) {
 		// Play from top of pattern
 		case MODE_PLAY:
 			m_bPlayLooping = false;
-			m_pTrackerView->PlayerCommand(CMD_MOVE_TO_TOP, 0);
+			PlayerCommand(CMD_MOVE_TO_TOP, 0);
 			break;
 		// Repeat pattern
 		case MODE_PLAY_REPEAT:
 			m_bPlayLooping = true;
-			m_pTrackerView->PlayerCommand(CMD_MOVE_TO_TOP, 0);
+			PlayerCommand(CMD_MOVE_TO_TOP, 0);
 			break;
 		// Start of song
 		case MODE_PLAY_START:
 			m_bPlayLooping = false;
-			m_pTrackerView->PlayerCommand(CMD_MOVE_TO_START, 0);
+			PlayerCommand(CMD_MOVE_TO_START, 0);
 			break;
 		// From cursor
 		case MODE_PLAY_CURSOR:
 			m_bPlayLooping = false;
-			m_pTrackerView->PlayerCommand(CMD_MOVE_TO_CURSOR, 0);
+			PlayerCommand(CMD_MOVE_TO_CURSOR, 0);
 			break;
 	}
 
@@ -804,7 +1001,8 @@ void CSoundGen::BeginPlayer(int Mode)
 
 //	LoadMachineSettings(m_pDocument->GetMachine(), m_pDocument->GetEngineSpeed());
 
-	theApp.SilentEverything();
+	if (!m_bOffline)
+		theApp.SilentEverything();
 }
 
 void CSoundGen::HaltPlayer()
@@ -845,6 +1043,13 @@ void CSoundGen::AddCycles(int Count)
 	m_pAPU->AddTime(Count);
 }
 
+void CSoundGen::RegisterKeyState(int Channel, int Note)
+{
+	// Called from player thread
+	if (m_pTrackerView)
+		m_pTrackerView->RegisterKeyState(Channel, Note);
+}
+
 void CSoundGen::MakeSilent()
 {
 	// Called from player thread
@@ -871,8 +1076,8 @@ void CSoundGen::ResetTempo()
 	if (!m_pDocument)
 		return;
 
-	m_iSpeed = m_pDocument->GetSongSpeed();
-	m_iTempo = m_pDocument->GetSongTempo();
+	m_iSpeed = m_pDocument->GetSongSpeed(GetPlayTrack());
+	m_iTempo = m_pDocument->GetSongTempo(GetPlayTrack());
 
 	m_iTempoAccum = 0;
 	m_iTempoDecrement = (m_iTempo * 24) / m_iSpeed;
@@ -893,7 +1098,7 @@ void CSoundGen::RunFrame()
 
 	int TicksPerSec = m_pDocument->GetFrameRate();
 
-	m_pTrackerView->PlayerCommand(CMD_TICK, 0);
+	PlayerCommand(CMD_TICK, 0);
 
 	if (m_bPlaying) {
 		
@@ -910,7 +1115,7 @@ void CSoundGen::RunFrame()
 		}
 
 		// Calculate playtime
-		m_pTrackerView->PlayerCommand(CMD_TIME, (m_iPlayTime * 10) / TicksPerSec);
+		PlayerCommand(CMD_TIME, (m_iPlayTime * 10) / TicksPerSec);
 
 		m_iStepRows = 0;
 
@@ -922,7 +1127,7 @@ void CSoundGen::RunFrame()
 				m_iStepRows++;
 //			}
 			m_bUpdateRow = true;
-			m_pTrackerView->PlayerCommand(CMD_READ_ROW, 0);
+			PlayerCommand(CMD_READ_ROW, 0);
 		}
 		else {
 			m_bUpdateRow = false;
@@ -938,22 +1143,22 @@ void CSoundGen::CheckControl()
 		// If looping, halt when a jump or skip command are encountered
 		if (m_bPlayLooping) {
 			if (m_iJumpToPattern != -1 || m_iSkipToRow != -1)
-				m_pTrackerView->PlayerCommand(CMD_MOVE_TO_TOP, 0);
+				PlayerCommand(CMD_MOVE_TO_TOP, 0);
 			else
 				while (m_iStepRows--)
-					m_pTrackerView->PlayerCommand(CMD_STEP_DOWN, 1);
+					PlayerCommand(CMD_STEP_DOWN, 1);
 		}
 		else {
 			// Jump
 			if (m_iJumpToPattern != -1)
-				m_pTrackerView->PlayerCommand(CMD_JUMP_TO, m_iJumpToPattern - 1);
+				PlayerCommand(CMD_JUMP_TO, m_iJumpToPattern - 1);
 			// Skip
 			else if (m_iSkipToRow != -1)
-				m_pTrackerView->PlayerCommand(CMD_SKIP_TO, m_iSkipToRow);
+				PlayerCommand(CMD_SKIP_TO, m_iSkipToRow);
 			// or just move on
 			else
 				while (m_iStepRows--)
-					m_pTrackerView->PlayerCommand(CMD_STEP_DOWN, 0);
+					PlayerCommand(CMD_STEP_DOWN, 0);
 		}
 
 		m_iJumpToPattern = -1;
@@ -961,6 +1166,103 @@ void CSoundGen::CheckControl()
 	}
 }
 
+int CSoundGen::PlayerCommand(char Command, int Value)
+{
+	// The view keeps the play position of the interactive generator,
+	// offline generators follow the same rules on their own track
+
+	if (m_pTrackerView)
+		return m_pTrackerView->PlayerCommand(Command, Value);
+
+	if (!m_bOffline)
+		return 0;
+
+	int Frames = m_pDocument->GetFrameCount(m_iPlayTrack);
+	int PatternLength = m_pDocument->GetPatternLength(m_iPlayTrack);
+
+	switch (Command) {
+		case CMD_MOVE_TO_TOP:
+			m_iPlayRow = 0;
+			break;
+		case CMD_MOVE_TO_START:
+		case CMD_MOVE_TO_CURSOR:
+			m_iPlayFrame = 0;
+			m_iPlayRow = 0;
+			break;
+		case CMD_STEP_DOWN:
+			// Value = 1: looping
+			if (++m_iPlayRow >= PatternLength) {
+				m_iPlayRow = 0;
+				FrameIsDone(1);
+				if (!Value && ++m_iPlayFrame >= Frames)
+					m_iPlayFrame = 0;
+			}
+			break;
+		case CMD_JUMP_TO:
+			FrameIsDone(1);
+			m_iPlayFrame = (Value + 1 < Frames) ? Value + 1 : Frames - 1;
+			m_iPlayRow = 0;
+			break;
+		case CMD_SKIP_TO:
+			FrameIsDone(1);
+			if (++m_iPlayFrame >= Frames)
+				m_iPlayFrame = 0;
+			m_iPlayRow = (Value < PatternLength) ? Value : PatternLength - 1;
+			break;
+		case CMD_READ_ROW:
+			ReadRow();
+			break;
+		case CMD_GET_FRAME:
+			return m_iPlayFrame;
+	}
+
+	return 0;
+}
+
+void CSoundGen::ReadRow()
+{
+	// Feed the notes of the current row to the channels, channels outside
+	// the mask only get the effects that control the player
+
+	const int PASS_EFFECTS[] = {EF_HALT, EF_JUMP, EF_SPEED, EF_SKIP};
+
+	for (unsigned int i = 0; i < m_pDocument->GetAvailableChannels(); ++i) {
+		stChanNote NoteData;
+		unsigned int Pattern = m_pDocument->GetPatternAtFrame(m_iPlayTrack, m_iPlayFrame, i);
+		CTrackerChannel *pChannel = m_pTrackerChannels[m_pDocument->GetChannelType(i)];
+
+		m_pDocument->GetDataAtPattern(m_iPlayTrack, Pattern, i, m_iPlayRow, &NoteData);
+
+		if (m_iChannelMask & (1 << i)) {
+			pChannel->SetNote(NoteData);
+		}
+		else {
+			bool ValidCommand = false;
+			NoteData.Note		= HALT;
+			NoteData.Octave		= 0;
+			NoteData.Instrument = 0;
+			for (unsigned int j = 0; j < (m_pDocument->GetEffColumns(m_iPlayTrack, i) + 1); ++j) {
+				bool bPass = false;
+				for (int k = 0; k < 4; ++k) {
+					if (NoteData.EffNumber[j] == PASS_EFFECTS[k])
+						bPass = true;
+				}
+				if (bPass)
+					ValidCommand = true;
+				else
+					NoteData.EffNumber[j] = EF_NONE;
+			}
+			if (ValidCommand)
+				pChannel->SetNote(NoteData);
+		}
+	}
+}
+
+int CSoundGen::GetPlayTrack() const
+{
+	return m_bOffline ? m_iPlayTrack : m_pDocument->GetSelectedTrack();
+}
+
 void CSoundGen::LoadMachineSettings(int Machine, int Rate)
 {
 	// Setup machine-type and speed
@@ -990,7 +1292,7 @@ void CSoundGen::LoadMachineSettings(int Machine, int Rate)
 	double clock_ntsc = CAPU::BASE_FREQ_NTSC / 16.0;
 	double clock_pal = CAPU::BASE_FREQ_PAL / 16.0;
 	
-	double NamcoChannels = (double)m_pDocument->GetNamcoChannels();
+	int NamcoChannels = m_pDocument->GetNamcoChannels();
 
 	for (int i = 0; i < NOTE_COUNT; ++i) {
 		// Frequency (in Hz)
@@ -1017,11 +1319,7 @@ void CSoundGen::LoadMachineSettings(int Machine, int Rate)
 		m_iNoteLookupTableFDS[i] = (unsigned int)Pitch;
 
 		// N163
-		Pitch = (Freq * NamcoChannels * 983040.0) / clock_ntsc;
-		m_iNoteLookupTableN163[i] = (unsigned int)(Pitch) / 4;
-
-		if (m_iNoteLookupTableN163[i] > 0xFFFF)	// 0x3FFFF
-			m_iNoteLookupTableN163[i] = 0xFFFF;	// 0x3FFFF
+		m_iNoteLookupTableN163[i] = CalculateNamcoPeriod(i, NamcoChannels);
 
 		// Sunsoft 5B
 		Pitch = (clock_ntsc / Freq) - 0.5;
@@ -1265,24 +1563,15 @@ bool CSoundGen::RenderToFile(LPTSTR pFile, int SongEndType, int SongEndParam)
 	// Called from player thread
 	//ASSERT(GetCurrentThreadId() == m_nThreadID);
 
-	CFamiTrackerDoc *pDoc = CFamiTrackerDoc::GetDoc();
+	if (!m_pDocument || IsRenderingStems())
+		return false;
 
 	if (m_bPlaying)
 		HaltPlayer();
 
-	m_iRenderEndWhen = (RENDER_END)SongEndType;
-	m_iRenderEndParam = SongEndParam;
-	m_iRenderedFrames = 0;
+	InitRenderEnd(SongEndType, SongEndParam);
 
-	if (m_iRenderEndWhen == SONG_TIME_LIMIT) {
-		// This variable is stored in seconds, convert to frames
-		m_iRenderEndParam *= pDoc->GetFrameRate();
-	}
-	else if (m_iRenderEndWhen == SONG_LOOP_LIMIT) {
-		m_iRenderEndParam = pDoc->ScanActualLength(pDoc->GetSelectedTrack(), m_iRenderEndParam);
-	}
-
-	if (!m_wfWaveFile.OpenFile(pFile, theApp.GetSettings()->Sound.iSampleRate, theApp.GetSettings()->Sound.iSampleSize, 1)) {
+	if (!m_wfWaveFile.OpenFile(pFile, m_Settings.SampleRate, m_Settings.SampleSize, m_Settings.Stereo ? 2 : 1)) {
 		AfxMessageBox(IDS_FILE_OPEN_ERROR);
 		return false;
 	}
@@ -1300,10 +1589,13 @@ void CSoundGen::StopRendering()
 	m_bPlaying = false;
 	m_bPlayerHalted = false;
 
+	// Write out what's left in the buffer and finish the file
+	if (m_iBufferPtr > 0)
+		m_wfWaveFile.WriteWave((char*)m_pAccumBuffer, m_iBufferPtr * (m_iSampleSize / 8));
+	m_wfWaveFile.CloseFile();
+
 	m_bRendering = false;
-	m_pTrackerView->PlayerCommand(CMD_MOVE_TO_START, 0);
-   qDebug("rendering to wav needs to be implemented...");
-//	m_wfWaveFile.CloseFile();
+	PlayerCommand(CMD_MOVE_TO_START, 0);
 
 	MakeSilent();
 	ResetBuffer();
@@ -1312,7 +1604,7 @@ void CSoundGen::StopRendering()
 void CSoundGen::GetRenderStat(int &Frame, int &Time, bool &Done, int &FramesToRender)
 {
 	Frame = m_iRenderedFrames;
-	Time = m_iPlayTime / m_pTrackerView->GetDocument()->GetFrameRate();
+	Time = m_iPlayTime / m_pDocument->GetFrameRate();
 	Done = m_bRendering;
 	FramesToRender = m_iRenderEndParam;
 }
@@ -1322,6 +1614,132 @@ bool CSoundGen::IsRendering()
 	return m_bRendering;
 }
 
+void CSoundGen::InitRenderEnd(int SongEndType, int SongEndParam)
+{
+	m_iRenderEndWhen = (RENDER_END)SongEndType;
+	m_iRenderEndParam = SongEndParam;
+	m_iRenderedFrames = 0;
+
+	if (m_iRenderEndWhen == SONG_TIME_LIMIT) {
+		// This variable is stored in seconds, convert to frames
+		m_iRenderEndParam *= m_pDocument->GetFrameRate();
+	}
+	else if (m_iRenderEndWhen == SONG_LOOP_LIMIT) {
+		m_iRenderEndParam = m_pDocument->ScanActualLength(GetPlayTrack(), m_iRenderEndParam);
+	}
+}
+
+// Stem export
+
+bool CSoundGen::RenderStems(const QList<stStemJob> &Jobs, int SongEndType, int SongEndParam)
+{
+	// Called from main thread
+	ASSERT(GetCurrentThreadId() == theApp.m_nThreadID);
+
+	if (!m_pDocument || Jobs.isEmpty() || IsRendering() || IsRenderingStems())
+		return false;
+
+	// The player is stopped while the jobs run since it shares the
+	// emulation globals of the FDS and 5B with them
+	StopPlayer();
+
+	DWORD StartTime = GetTickCount();
+
+	while (m_bPlaying) {
+		if ((GetTickCount() - StartTime) > 2000)
+			return false;
+		QThread::msleep(10);
+	}
+
+	m_iStemsTotal = Jobs.count();
+	m_iStemsDone.fetchAndStoreOrdered(0);
+	m_iStemsFailed.fetchAndStoreOrdered(0);
+	m_bStopStems.fetchAndStoreOrdered(0);
+	m_bRenderingStems.fetchAndStoreOrdered(1);
+
+	// The player thread idles from here on, taking the document lock waits
+	// for a frame it may still be running. Packed patterns are decoded on
+	// first access, do that here since the jobs share the document.
+	m_csDocumentLock.Lock();
+
+	for (int i = 0; i < Jobs.count(); ++i)
+		m_pDocument->UnpackTrackPatterns(Jobs.at(i).Track);
+
+	m_csDocumentLock.Unlock();
+
+	for (int i = 0; i < Jobs.count(); ++i)
+		m_StemPool.start(new CStemRenderJob(this, m_pDocument, Jobs.at(i), SongEndType, SongEndParam, &m_StemDocumentLock, &m_bStopStems));
+
+	return true;
+}
+
+void CSoundGen::StopRenderingStems()
+{
+	// Running jobs finish their current frame and close their files,
+	// queued jobs are skipped. StemsFinished() follows once they are done.
+	m_bStopStems.fetchAndStoreOrdered(1);
+}
+
+void CSoundGen::EndRenderingStems()
+{
+	// Waits for a stopped batch to close its files, only for when the
+	// caller can't wait for StemsFinished()
+	m_StemPool.waitForDone();
+}
+
+void CSoundGen::GetStemRenderStat(int &Done, int &Failed, int &Total)
+{
+	Done = m_iStemsDone.fetchAndAddOrdered(0);
+	Failed = m_iStemsFailed.fetchAndAddOrdered(0);
+	Total = m_iStemsTotal;
+}
+
+bool CSoundGen::IsRenderingStems() const
+{
+	// A batch lasts until its last job is done
+	return m_bRenderingStems.fetchAndAddOrdered(0) != 0;
+}
+
+void CSoundGen::StemIsDone(bool bSuccess)
+{
+	// Called from pool threads
+	if (!bSuccess)
+		m_iStemsFailed.fetchAndAddOrdered(1);
+
+	// The last job ends the batch
+	if (m_iStemsDone.fetchAndAddOrdered(1) + 1 == m_iStemsTotal) {
+		m_bRenderingStems.fetchAndStoreOrdered(0);
+		emit StemsFinished();
+	}
+}
+
+bool CSoundGen::RenderStem(const stStemJob &Job, int SongEndType, int SongEndParam, QAtomicInt *pCancel)
+{
+	// Called on an offline generator, renders one job to its file
+
+	ASSERT(m_bOffline);
+
+	m_iPlayTrack = Job.Track;
+	m_iChannelMask = Job.ChannelMask;
+
+	InitRenderEnd(SongEndType, SongEndParam);
+
+	if (!m_wfWaveFile.OpenFile((LPTSTR)(LPCTSTR)Job.FileName, m_Settings.SampleRate, m_Settings.SampleSize, m_Settings.Stereo ? 2 : 1))
+		return false;
+
+	OnStartRender(0, 0);
+
+	while (m_bRendering) {
+		if (pCancel->fetchAndAddOrdered(0)) {
+			StopRendering();
+			return false;
+		}
+		ProcessFrame();
+	}
+
+	return true;
+}
+
 void CSoundGen::SongIsDone()
 {
 	if (IsRendering())
@@ -1379,12 +1797,15 @@ bool CSoundGen::PreviewDone() const
 
 void CSoundGen::LockDocument()
 {
+	// Waits for stem jobs reading the document
+	m_StemDocumentLock.lockForWrite();
 	m_csDocumentLock.Lock();
 }
 
 void CSoundGen::UnlockDocument()
 {
 	m_csDocumentLock.Unlock();
+	m_StemDocumentLock.unlock();
 }
 
 bool CSoundGen::WaitForStop() const
@@ -1466,10 +1887,35 @@ BOOL CSoundGen::OnIdle(LONG lCount)
 
 	SetEvent(m_hAliveCheck);
 
+	// Stems are rendered by offline generators, this one stays quiet
+	if (IsRenderingStems())
+		return TRUE;
+
+	// Rendering to a file isn't paced by the sound card so run as many
+	// frames as fit in a time slice, then return to the event loop to let
+	// the progress dialog update and the user cancel
+	if (m_bRendering) {
+		QElapsedTimer SliceTimer;
+		SliceTimer.start();
+		while (m_bRendering && SliceTimer.elapsed() < RENDER_SLICE_TIME) {
+			if (!ProcessFrame())
+				break;
+		}
+		return TRUE;
+	}
+
+	return ProcessFrame();
+}
+
+BOOL CSoundGen::ProcessFrame()
+{
+	// Runs one player frame: reads the pattern data, updates the channels
+	// and runs the APU, which hands finished audio to FlushBuffer
+
 	// Access the document object
 	m_csDocumentLock.Lock();
 	
-	if (!m_pDocument || !m_pDSoundChannel) {
+	if (!m_pDocument || (!m_pDSoundChannel && !m_bOffline)) {
 		// Document is unloaded or no sound
 		m_csDocumentLock.Unlock();
 		// Wait for kill signal
@@ -1489,7 +1935,7 @@ BOOL CSoundGen::OnIdle(LONG lCount)
 			int Channel = m_pDocument->GetChannelType(i);
 			
 			// TODO: clean up!
-			if (m_pTrackerView->Arpeggiate[i] > 0) {
+			if (m_pTrackerView && m_pTrackerView->Arpeggiate[i] > 0) {
 				m_pChannels[Channel]->Arpeggiate(m_pTrackerView->Arpeggiate[i]);
 				m_pTrackerView->Arpeggiate[i] = 0;
 			}
@@ -1498,7 +1944,7 @@ BOOL CSoundGen::OnIdle(LONG lCount)
 			if (m_pTrackerChannels[Channel]->NewNoteData()) {
 				stChanNote Note = m_pTrackerChannels[Channel]->GetNote();
 				//PlayNote(Channel, &Note, m_pTrackerChannels[Channel]->GetColumnCount() + 1);
-				PlayNote(Channel, &Note, m_pDocument->GetEffColumns(i) + 1);
+				PlayNote(Channel, &Note, m_pDocument->GetEffColumns(GetPlayTrack(), i) + 1);
 			}
 
 			// Pitch wheel
@@ -1509,11 +1955,12 @@ BOOL CSoundGen::OnIdle(LONG lCount)
 			m_pTrackerChannels[Channel]->SetVolumeMeter(m_pAPU->GetVol(Channel));
 		}
 
-		int SelectedChan = m_pTrackerView->GetSelectedChannel();
-
 		// Instrument sequence visualization
-		if (m_pChannels[SelectedChan])
-			m_pChannels[SelectedChan]->UpdateSequencePlayPos();
+		if (m_pTrackerView) {
+			int SelectedChan = m_pTrackerView->GetSelectedChannel();
+			if (m_pChannels[SelectedChan])
+				m_pChannels[SelectedChan]->UpdateSequencePlayPos();
+		}
 	}
 
 
@@ -1585,7 +2032,10 @@ BOOL CSoundGen::OnIdle(LONG lCount)
 	if (m_iDelayedStart > 0) {
 		--m_iDelayedStart;
 		if (!m_iDelayedStart) {
-			PostThreadMessage(WM_USER_PLAY, MODE_PLAY_START, 0);
+			if (m_bOffline)
+				BeginPlayer(MODE_PLAY_START);
+			else
+				PostThreadMessage(WM_USER_PLAY, MODE_PLAY_START, 0);
 		}
 	}
 
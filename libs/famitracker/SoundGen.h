@@ -22,6 +22,10 @@
 
 #include <QThread>
 #include <QTimer>
+#include <QList>
+#include <QAtomicInt>
+#include <QThreadPool>
+#include <QReadWriteLock>
 
 #include "cqtmfc.h"
 
@@ -69,6 +73,28 @@ struct stDPCMState {
 	int DeltaCntr;
 };
 
+// Settings that affect the generated audio. Each generator keeps a copy
+// so offline generators never read the application settings
+struct stSoundSettings {
+	int  SampleRate;
+	int  SampleSize;
+	int  BassFilter;
+	int  TrebleFilter;
+	int  TrebleDamping;
+	int  MixVolume;
+	bool NamcoMixing;
+	bool NoDPCMReset;
+	bool Stereo;
+	int  ChannelPan[CHANNELS];
+};
+
+// One file of a stem export
+struct stStemJob {
+	CString		 FileName;
+	int			 Track;
+	unsigned int ChannelMask;		// Bit n enables document channel n
+};
+
 class CChannelHandler;
 class CFamiTrackerView;
 class CAPU;
@@ -88,8 +114,10 @@ public slots:
    void recvThreadMessage(unsigned int m,unsigned int w,unsigned int l);
 signals:
    void DrawSamples(int *Samples, int Count);
+   void StemsFinished();
 public:
 	CSoundGen();
+	CSoundGen(CFamiTrackerDoc *pDoc, const stSoundSettings &Settings);	// Offline generator, see RenderStem
 	virtual ~CSoundGen();
 
 	//
@@ -101,6 +129,7 @@ public:
 	void		AssignDocument(CFamiTrackerDoc *pDoc);
 	void		AssignView(CFamiTrackerView *pView);
 	void		RemoveDocument();
+	CFamiTrackerDoc *GetDocument() const { return m_pDocument; }
 	void		SetSampleWindow(CSampleWindow *pWnd);
 
 	// Multiple times initialization
@@ -129,6 +158,10 @@ public:
 
 	int			 ReadNamcoPeriodTable(int index) const;
 
+	// Table generators, these only depend on the document so the compiler can use them without a player
+	static void	 CalculateVibratoTable(int Type, int *pTable);
+	static unsigned int CalculateNamcoPeriod(int Note, int NamcoChannels);
+
 	// Player interface
 	void		 StartPlayer(int Mode);	
 	void		 StopPlayer();
@@ -153,6 +186,16 @@ public:
 	void		 StopRendering();
 	void		 GetRenderStat(int &Frame, int &Time, bool &Done, int &FramesToRender);
 	bool		 IsRendering();	
+
+	// Stem export, renders each job on its own offline generator in a pool of its own,
+	// StemsFinished() is emitted when the last job is done
+	bool		 RenderStems(const QList<stStemJob> &Jobs, int SongEndType, int SongEndParam);
+	void		 StopRenderingStems();
+	void		 EndRenderingStems();
+	void		 GetStemRenderStat(int &Done, int &Failed, int &Total);
+	bool		 IsRenderingStems() const;
+	bool		 RenderStem(const stStemJob &Job, int SongEndType, int SongEndParam, QAtomicInt *pCancel);
+	void		 StemIsDone(bool bSuccess);
 	void		 CheckRenderStop();
 	void		 SongIsDone();
 	void		 FrameIsDone(int SkipFrames);
@@ -165,6 +208,8 @@ public:
 
 	// Used by channels
 	void		AddCycles(int Count);
+	void		RegisterKeyState(int Channel, int Note);
+	const stSoundSettings &GetSoundSettings() const { return m_Settings; };
 
 	// Other
 	uint8		GetReg(int Chip, int Reg) const { return m_pAPU->GetReg(Chip, Reg); };
@@ -188,10 +233,16 @@ private:
 	// Audio
 	bool		ResetSound();
 	void		CloseSound();
+	static stSoundSettings CaptureSoundSettings();
 
 	// Player
+	int			PlayerCommand(char Command, int Value);
+	void		ReadRow();
+	int			GetPlayTrack() const;
+	void		InitRenderEnd(int SongEndType, int SongEndParam);
 	void	 	PlayNote(int Channel, stChanNote *NoteData, int EffColumns);
 	void		RunFrame();
+	BOOL		ProcessFrame();
 	void		CheckControl();
 	void		ResetBuffer();
 	void		BeginPlayer(int Mode);
@@ -279,6 +330,15 @@ private:
 
 	unsigned int		m_iMachineType;						// NTSC/PAL
 
+	stSoundSettings		m_Settings;
+
+	// Offline generators have no view, they keep their own play position
+	bool				m_bOffline;
+	int					m_iPlayTrack;
+	unsigned int		m_iChannelMask;
+	int					m_iPlayFrame;
+	int					m_iPlayRow;
+
 	// Rendering
 	RENDER_END			m_iRenderEndWhen;
 	int					m_iRenderEndParam;
@@ -296,6 +356,15 @@ private:
 
 	CWaveFile			m_wfWaveFile;
 
+	// Stem export
+	mutable QAtomicInt	m_bRenderingStems;
+	QAtomicInt			m_bStopStems;
+	int					m_iStemsTotal;
+	QAtomicInt			m_iStemsDone;
+	QAtomicInt			m_iStemsFailed;
+	QThreadPool			m_StemPool;
+	QReadWriteLock		m_StemDocumentLock;					// Read by stem jobs, written by LockDocument
+
 	// FDS & N163 waves
 	bool				m_bWaveChanged;
 
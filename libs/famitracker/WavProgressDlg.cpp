@@ -23,6 +23,7 @@
 #include "FamiTrackerDoc.h"
 #include "FamiTrackerView.h"
 #include "SoundGen.h"
+#include "TrackerChannel.h"
 #include "WavProgressDlg.h"
 
 
@@ -31,7 +32,7 @@
 IMPLEMENT_DYNAMIC(CWavProgressDlg, CDialog)
 
 CWavProgressDlg::CWavProgressDlg(CWnd* pParent /*=NULL*/)
-	: CDialog(CWavProgressDlg::IDD, pParent)
+	: CDialog(CWavProgressDlg::IDD, pParent), m_bStems(false), m_bStopping(false)
 {
 
 }
@@ -51,6 +52,24 @@ void CWavProgressDlg::DoDataExchange(CDataExchange* pDX)
 //	ON_WM_TIMER()
 //END_MESSAGE_MAP()
 
+void CWavProgressDlg::cancel_clicked()
+{
+   OnBnClickedCancel();
+}
+
+void CWavProgressDlg::stems_finished()
+{
+   // A stopped batch closes the dialog once its files are closed
+   if (m_bStopping)
+      EndDialog(0);
+}
+
+void CWavProgressDlg::timerEvent(QTimerEvent *event)
+{
+   int mfcId = mfcTimerId(event->timerId());
+   OnTimer(mfcId);
+}
+
 // CWavProgressDlg message handlers
 
 void CWavProgressDlg::OnBnClickedCancel()
@@ -60,6 +79,14 @@ void CWavProgressDlg::OnBnClickedCancel()
 		m_pSoundGen->PostThreadMessage(WM_USER_STOP_RENDER, 0, 0);
 	}
 
+	// Wait for StemsFinished() to close the dialog
+	if (m_pSoundGen->IsRenderingStems()) {
+		m_pSoundGen->StopRenderingStems();
+		m_bStopping = true;
+		SetDlgItemText(IDC_CANCEL, _T("Stopping"));
+		return;
+	}
+
 	EndDialog(0);
 }
 
@@ -75,6 +102,12 @@ void CWavProgressDlg::SetOptions(int LengthType, int LengthParam)
 	m_iSongEndParam = LengthParam;
 }
 
+void CWavProgressDlg::SetStems(bool bStems)
+{
+	// Save each channel of the selected track to a file of its own
+	m_bStems = bStems;
+}
+
 BOOL CWavProgressDlg::OnInitDialog()
 {
 	CDialog::OnInitDialog();
@@ -97,7 +130,27 @@ BOOL CWavProgressDlg::OnInitDialog()
 	FileStr.Format(_T("Saving to: %s"), m_sFile.GetString());
 	SetDlgItemText(IDC_PROGRESS_FILE, FileStr);
 
-	if (!m_pSoundGen->RenderToFile(m_sFile.GetBuffer(), m_iSongEndType, m_iSongEndParam))
+	if (m_bStems) {
+		QList<stStemJob> Jobs;
+		CString Base = m_sFile;
+
+		if (Base.Right(4).CompareNoCase(_T(".wav")) == 0)
+			Base = Base.Left(Base.GetLength() - 4);
+
+		for (int i = 0; i < m_pDoc->GetChannelCount(); ++i) {
+			stStemJob Job;
+			Job.FileName.Format(_T("%s - %s.wav"), Base.GetString(), m_pDoc->GetChannel(i)->GetChannelName());
+			Job.Track = m_pDoc->GetSelectedTrack();
+			Job.ChannelMask = 1 << i;
+			Jobs.append(Job);
+		}
+
+		QObject::connect(m_pSoundGen,SIGNAL(StemsFinished()),this,SLOT(stems_finished()),Qt::QueuedConnection);
+
+		if (!m_pSoundGen->RenderStems(Jobs, m_iSongEndType, m_iSongEndParam))
+			EndDialog(0);
+	}
+	else if (!m_pSoundGen->RenderToFile(m_sFile.GetBuffer(), m_iSongEndType, m_iSongEndParam))
 		EndDialog(0);
 
 	m_dwStartTime = GetTickCount();
@@ -111,7 +164,7 @@ void CWavProgressDlg::OnTimer(UINT_PTR nIDEvent)
 {
 	// Update progress status
 	CString Text;
-	int Frame, PercentDone;
+	int Frame, PercentDone = 0;
 	int RenderedTime;
 	int FramesToRender;
 	bool Done;
@@ -122,10 +175,20 @@ void CWavProgressDlg::OnTimer(UINT_PTR nIDEvent)
 
 	m_pSoundGen->GetRenderStat(Frame, RenderedTime, Done, FramesToRender);
 
-	if (m_iSongEndType == SONG_LOOP_LIMIT) {
+	if (m_bStems) {
+		int Files, Failed, Total;
+		m_pSoundGen->GetStemRenderStat(Files, Failed, Total);
+		if (Total > 0)
+			PercentDone = (Files * 100) / Total;
+		Text.Format(_T("Files: %i / %i (%i%% done) "), Files, Total, PercentDone);
+		if (Failed > 0)
+			Text.AppendFormat(_T("- %i failed"), Failed);
+	}
+	else if (m_iSongEndType == SONG_LOOP_LIMIT) {
 		if (Frame > FramesToRender)
 			Frame = FramesToRender;
-		PercentDone = (Frame * 100) / FramesToRender;
+		if (FramesToRender > 0)
+			PercentDone = (Frame * 100) / FramesToRender;
 		Text.Format(_T("Frame: %i / %i (%i%% done) "), Frame, FramesToRender, PercentDone);
 	}
 	else if (m_iSongEndType == SONG_TIME_LIMIT) {
@@ -135,7 +198,8 @@ void CWavProgressDlg::OnTimer(UINT_PTR nIDEvent)
 		TotalMin = m_iSongEndParam / 60;
 		CurrSec = RenderedTime % 60;
 		CurrMin = RenderedTime / 60;
-		PercentDone = (RenderedTime * 100) / m_iSongEndParam;
+		if (m_iSongEndParam > 0)
+			PercentDone = (RenderedTime * 100) / m_iSongEndParam;
 		Text.Format(_T("Time: %02i:%02i / %02i:%02i (%i%% done) "), CurrMin, CurrSec, TotalMin, TotalSec, PercentDone);
 	}
 
@@ -146,7 +210,7 @@ void CWavProgressDlg::OnTimer(UINT_PTR nIDEvent)
 
 	m_pProgressBar->SetPos(PercentDone);
 
-	if (!m_pSoundGen->IsRendering()) {
+	if (!m_pSoundGen->IsRendering() && !m_pSoundGen->IsRenderingStems()) {
 		SetDlgItemText(IDC_CANCEL, _T("Done"));
 		CString title;
 		GetWindowText(title);
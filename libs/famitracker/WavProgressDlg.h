@@ -20,11 +20,27 @@
 
 #pragma once
 
+#include "cqtmfc.h"
+#include "resource.h"
+
+class CSoundGen;
+class CFamiTrackerView;
+class CFamiTrackerDoc;
+
 
 // CWavProgressDlg dialog
 
 class CWavProgressDlg : public CDialog
 {
+   Q_OBJECT
+   // Qt interfaces
+public slots:
+   void cancel_clicked();
+   void stems_finished();
+protected:
+   void timerEvent(QTimerEvent *event);
+
+public:
 	DECLARE_DYNAMIC(CWavProgressDlg)
 
 public:
@@ -33,6 +49,7 @@ public:
 
 	void SetFile(CString File);
 	void SetOptions(int LengthType, int LengthParam);
+	void SetStems(bool bStems);
 
 // Dialog Data
 	enum { IDD = IDD_WAVE_PROGRESS };
@@ -50,6 +67,8 @@ protected:
 
 	CString m_sFile;
 	int m_iSongEndType, m_iSongEndParam;
+	bool m_bStems;
+	bool m_bStopping;
 
 	DECLARE_MESSAGE_MAP()
 public:
@@ -18,58 +18,51 @@
 ** must bear this legend.
 */
 
-#include <windows.h>
+#include <QDataStream>
+
 #include "WaveFile.h"
 
-#include "cqtmfc.h"
+// RIFF header layout, the chunk sizes are patched in when the file is closed
+static const int RIFF_SIZE_OFFSET = 4;
+static const int DATA_SIZE_OFFSET = 40;
+static const int HEADER_SIZE = 44;
 
 bool CWaveFile::OpenFile(LPTSTR Filename, int SampleRate, int SampleSize, int Channels)
 {
 	// Open a wave file for streaming
 	//
 
-	int nError;
-
-	WaveFormat.wf.wFormatTag	  = WAVE_FORMAT_PCM;
-	WaveFormat.wf.nChannels		  = Channels;
-	WaveFormat.wf.nSamplesPerSec  = SampleRate;
-	WaveFormat.wf.nBlockAlign	  = (SampleSize / 8) * Channels;
-	WaveFormat.wf.nAvgBytesPerSec = SampleRate * (SampleSize / 8) * Channels;
-	WaveFormat.wBitsPerSample	  = SampleSize;
-
-   qDebug("mmio stuff...");
-//	hmmioOut = mmioOpen(Filename, NULL, MMIO_ALLOCBUF | MMIO_READWRITE | MMIO_CREATE);
-
-//	ckOutRIFF.fccType = mmioFOURCC('W', 'A', 'V', 'E');
-//	ckOutRIFF.cksize  = 0;
-
-//	nError = mmioCreateChunk(hmmioOut, &ckOutRIFF, MMIO_CREATERIFF);
+#if UNICODE
+	m_File.setFileName(QString::fromWCharArray(Filename));
+#else
+	m_File.setFileName(QString(Filename));
+#endif
 
-//	if (nError != MMSYSERR_NOERROR)
-//		return false;
+	if (!m_File.open(QIODevice::WriteOnly | QIODevice::Truncate))
+		return false;
 
-//	ckOut.ckid	 = mmioFOURCC('f', 'm', 't', ' ');     
-//	ckOut.cksize = sizeof(PCMWAVEFORMAT);
+	m_iDataSize = 0;
 
-//	nError = mmioCreateChunk(hmmioOut, &ckOut, 0);
+	QDataStream Out(&m_File);
+	Out.setByteOrder(QDataStream::LittleEndian);
 
-//	if (nError != MMSYSERR_NOERROR)
-//		return false;
+	Out.writeRawData("RIFF", 4);
+	Out << (quint32)0;
+	Out.writeRawData("WAVE", 4);
 
-//	mmioWrite(hmmioOut, (HPSTR)&WaveFormat, sizeof(PCMWAVEFORMAT));
-//	mmioAscend(hmmioOut, &ckOut, 0);
+	Out.writeRawData("fmt ", 4);
+	Out << (quint32)16;
+	Out << (quint16)1;											// WAVE_FORMAT_PCM
+	Out << (quint16)Channels;
+	Out << (quint32)SampleRate;
+	Out << (quint32)(SampleRate * (SampleSize / 8) * Channels);	// Bytes per second
+	Out << (quint16)((SampleSize / 8) * Channels);				// Block align
+	Out << (quint16)SampleSize;
 
-//	ckOut.ckid	 = mmioFOURCC('d', 'a', 't', 'a');
-//	ckOut.cksize = 0;
+	Out.writeRawData("data", 4);
+	Out << (quint32)0;
 
-//	nError = mmioCreateChunk(hmmioOut, &ckOut, 0);
-
-//	if (nError != MMSYSERR_NOERROR)
-//		return false;
-
-//	mmioGetInfo(hmmioOut, &mmioinfoOut, 0);	
-
-	return true;
+	return Out.status() == QDataStream::Ok;
 }
 
 void CWaveFile::CloseFile()
@@ -77,17 +70,18 @@ void CWaveFile::CloseFile()
 	// Close the file
 	//
 
-   qDebug("mmio stuff...");
-//	mmioinfoOut.dwFlags |= MMIO_DIRTY;
-//	mmioSetInfo(hmmioOut, &mmioinfoOut, 0);
+	if (!m_File.isOpen())
+		return;
 
-//	mmioAscend(hmmioOut, &ckOut, 0);
-//	mmioAscend(hmmioOut, &ckOutRIFF, 0);
+	QDataStream Out(&m_File);
+	Out.setByteOrder(QDataStream::LittleEndian);
 
-//	mmioSeek(hmmioOut, 0, SEEK_SET); 
-//	mmioDescend(hmmioOut, &ckOutRIFF, NULL, 0);
+	m_File.seek(RIFF_SIZE_OFFSET);
+	Out << (quint32)(HEADER_SIZE - 8 + m_iDataSize);
+	m_File.seek(DATA_SIZE_OFFSET);
+	Out << (quint32)m_iDataSize;
 
-//	mmioClose(hmmioOut, 0);
+	m_File.close();
 }
 
 void CWaveFile::WriteWave(char *Data, int Size)
@@ -95,17 +89,5 @@ void CWaveFile::WriteWave(char *Data, int Size)
 	// Save data to the file
 	//
 
-   qDebug("mmio stuff...");
-//	int cT;
-	
-//	for (cT = 0; cT < Size; cT++) {
-//        if (mmioinfoOut.pchNext == mmioinfoOut.pchEndWrite) { 
-//			mmioinfoOut.dwFlags |= MMIO_DIRTY; 
-//			mmioAdvance(hmmioOut, &mmioinfoOut, MMIO_WRITE);
-//		}
-
-//		*((BYTE*)mmioinfoOut.pchNext) = *((BYTE*)Data + cT); 
-//		mmioinfoOut.pchNext++;
-//	}
+	m_iDataSize += m_File.write(Data, Size);
 }
-
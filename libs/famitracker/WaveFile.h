@@ -21,7 +21,9 @@
 #ifndef _WAVEFILE_H_
 #define _WAVEFILE_H_
 
-#include <mmsystem.h>
+#include <QFile>
+
+#include "cqtmfc.h"
 
 class CWaveFile
 {
@@ -31,10 +33,8 @@ class CWaveFile
 		void	WriteWave(char *Data, int Size);
 
 	private:
-		PCMWAVEFORMAT	WaveFormat;
-		MMCKINFO		ckOutRIFF, ckOut;
-		MMIOINFO		mmioinfoOut;
-		HMMIO			hmmioOut;
+		QFile			m_File;
+		unsigned int	m_iDataSize;
 
 };
 
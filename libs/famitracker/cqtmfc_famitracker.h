@@ -13,6 +13,9 @@ extern QHash<int,CMenu*> qtMfcMenuResources;
 
 void qtMfcInit();
 
+// Command line tools only need the string table
+void qtMfcInitStringResources();
+
 void qtMfcInitDialogResource(UINT dlgID,CDialog* parent);
 
 void qtMfcInitToolBarResource(UINT dlgID,CToolBar* parent);
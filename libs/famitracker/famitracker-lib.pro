@@ -136,6 +136,7 @@ SOURCES += \
     resampler/sinc.cpp \
     resampler/resample.inl \
     resampler/resample.cpp \
+    resampler/polyphase.cpp \
     cqtmfc_famitracker.cpp \
     InstrumentEditorVRC7.cpp \
     InstrumentEditorVRC6.cpp \
@@ -255,6 +256,7 @@ HEADERS += \
     PCMImport.h \
     resampler/sinc.hpp \
     resampler/resample.hpp \
+    resampler/polyphase.hpp \
     cqtmfc_famitracker.h \
     InstrumentEditorVRC7.h \
     InstrumentEditorVRC6.h \
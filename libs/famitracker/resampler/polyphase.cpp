@@ -0,0 +1,107 @@
+/**This program is free software. It comes without any warranty, to
+ **the extent permitted by applicable law. You can redistribute it
+ **and/or modify it under the terms of the Do What The Fuck You Want
+ **To Public License, Version 2, as published by Sam Hocevar. See
+ **http://sam.zoy.org/wtfpl/COPYING for more details. **/
+
+//------------------------------------------------------------------------
+#include "polyphase.hpp"
+//------------------------------------------------------------------------
+#include <limits>
+#include <cmath>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define POLYPHASE_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define POLYPHASE_NEON
+#endif
+//------------------------------------------------------------------------
+
+/**Anonymous namespace, internal linking**/
+namespace {
+
+inline float dot(const float *a, const float *b, size_t n)
+{
+    size_t i = 0;
+    float sum = 0.f;
+#if defined(POLYPHASE_SSE2)
+    __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+    for (; i + 8 <= n; i += 8)
+    {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+    }
+    float part[4];
+    _mm_storeu_ps(part, _mm_add_ps(acc0, acc1));
+    sum = (part[0] + part[1]) + (part[2] + part[3]);
+#elif defined(POLYPHASE_NEON)
+    float32x4_t acc0 = vdupq_n_f32(0.f), acc1 = vdupq_n_f32(0.f);
+    for (; i + 8 <= n; i += 8)
+    {
+        acc0 = vmlaq_f32(acc0, vld1q_f32(a + i), vld1q_f32(b + i));
+        acc1 = vmlaq_f32(acc1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+    }
+    float part[4];
+    vst1q_f32(part, vaddq_f32(acc0, acc1));
+    sum = (part[0] + part[1]) + (part[2] + part[3]);
+#endif
+    for (; i < n; ++i)
+    {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+} // anonymous namespace
+
+namespace jarh
+{
+
+//------------------------------------------------------------------------
+// ctor -
+//------------------------------------------------------------------------
+polyphase::polyphase(const sinc &s, float ratio, float cutoff, size_t phases)
+ : phases_((std::max)(size_t(1), phases))
+{
+    // same limits as resample_base::cutoff and resample_base::ratio
+    cutoff_ = (std::min)(1.f, (std::max)(std::numeric_limits<float>::epsilon(), cutoff));
+    ratio_  = (std::max)(std::numeric_limits<float>::epsilon(), ratio);
+
+    const float sincstep = (std::min)(1.f, ratio_) * cutoff_;
+    taps_ = 1 + static_cast<size_t>(std::floor(2*s.range() / sincstep));
+
+    tbl_.resize((phases_ + 1) * taps_);
+    for (size_t p = 0; p <= phases_; ++p)
+    {
+        const float subidx = float(p) / phases_;
+        const float start  = -s.range() + sincstep - subidx * sincstep;
+        float *row = &tbl_[p * taps_];
+        for (size_t i = 0; i < taps_; ++i)
+        {
+            row[i] = s(start + i * sincstep);
+        }
+    }
+}
+
+//------------------------------------------------------------------------
+// conv(const float *buf, float subidx) -
+//  linear interpolation between the rows of the two nearest phases
+//------------------------------------------------------------------------
+float polyphase::conv(const float *buf, float subidx) const
+{
+    const float pos = subidx * phases_;
+    const size_t p  = (std::min)(static_cast<size_t>(pos), phases_ - 1);
+    const float frac= pos - p;
+
+    const float *row = &tbl_[p * taps_];
+    const float v1 = dot(buf, row, taps_);
+    const float v2 = dot(buf, row + taps_, taps_);
+    return v1 + frac * (v2 - v1);
+}
+
+//------------------------------------------------------------------------
+} // namespace jarh
+//------------------------------------------------------------------------
@@ -0,0 +1,67 @@
+/**This program is free software. It comes without any warranty, to
+ **the extent permitted by applicable law. You can redistribute it
+ **and/or modify it under the terms of the Do What The Fuck You Want
+ **To Public License, Version 2, as published by Sam Hocevar. See
+ **http://sam.zoy.org/wtfpl/COPYING for more details. **/
+
+/**Description:
+    Precomputed resampling kernel for a given ratio and cutoff.
+    The windowed sinc is sampled at 'phases' fractional positions
+    between two input samples, one row of filter taps per phase.
+    The convolution interpolates between the two rows surrounding
+    the current fractional position, so the result matches the
+    direct evaluation of the sinc without calling it for each tap.
+
+    A kernel only depends on the sinc, the ratio and the cutoff;
+    it can be shared between any number of resamplers.
+**/
+
+#ifndef POLYPHASE_HPP
+#define POLYPHASE_HPP
+
+//------------------------------------------------------------------------
+#include "sinc.hpp"
+//------------------------------------------------------------------------
+#include <vector>
+#include <cstddef>
+//------------------------------------------------------------------------
+
+namespace jarh
+{
+
+class polyphase
+{
+public:
+    /** ctor:
+      *   builds the table of taps, same ratio and cutoff limits as
+      *   resample_base.
+      */
+    polyphase(const sinc &s, float ratio, float cutoff, size_t phases=256);
+
+    float  ratio()  const { return ratio_; }
+    float  cutoff() const { return cutoff_; }
+    /** taps:
+      *   length of the filter, equals the buffer size of a resampler
+      *   using the same ratio and cutoff.
+      */
+    size_t taps()   const { return taps_; }
+
+    /** conv:
+      *   convolve taps() samples of buf with the kernel at the
+      *   fractional position subidx [0..1[.
+      */
+    float  conv(const float *buf, float subidx) const;
+
+private:
+    std::vector<float> tbl_;    // phases_ + 1 rows of taps_
+    size_t taps_;
+    size_t phases_;
+    float  ratio_;
+    float  cutoff_;
+};
+
+//------------------------------------------------------------------------
+} // namespace jarh
+//------------------------------------------------------------------------
+
+#endif
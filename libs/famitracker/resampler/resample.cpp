@@ -82,7 +82,7 @@ namespace jarh
 //
 //------------------------------------------------------------------------
 resample_base::resample_base(const sinc &s)
- : flags_(goodbit), sinc_(s)
+ : flags_(goodbit), sinc_(s), kernel_(0)
 {
 }
 //------------------------------------------------------------------------
@@ -112,6 +112,7 @@ void resample_base::ratio(float theratio)
 
     sincstep_= (std::min)(1.f, ratio_) * cutoff_;
 
+    kernel_  = 0;
     buf_.resize(1 +
                 static_cast<size_t>(std::floor(
                           2*sinc_.range() / sincstep_
@@ -119,10 +120,22 @@ void resample_base::ratio(float theratio)
             );
 }
 //------------------------------------------------------------------------
+// kernel(const polyphase *k) -
+//  must be set after ratio(), the kernel is dropped when it doesn't fit
+//------------------------------------------------------------------------
+void resample_base::kernel(const polyphase *k)
+{
+    kernel_ = (k && k->ratio() == ratio_ && k->cutoff() == cutoff_ &&
+               k->taps() == buf_.size()) ? k : 0;
+}
+//------------------------------------------------------------------------
 
 //------------------------------------------------------------------------
 float resample_base::conv() const
 {
+    if (kernel_)
+        return kernel_->conv(&buf_[0], subidx_);
+
     return std::inner_product(buf_.begin(),
                               buf_.end(),
                               make_func_iterator(sinc_,
@@ -33,6 +33,7 @@
 #define RESAMPLE_HPP
 //------------------------------------------------------------------------
 #include "sinc.hpp"
+#include "polyphase.hpp"
 //------------------------------------------------------------------------
 #include <limits>
 #include <iterator>
@@ -73,6 +74,10 @@ public:
 protected:
     float   ratio() const { return ratio_; }
 
+public:
+    // precomputed kernel, ignored unless it matches ratio and cutoff
+    void    kernel(const polyphase *k);
+
 
 public:
     // cutoff
@@ -105,6 +110,7 @@ protected:
 private:
     iostate flags_;
     const sinc &sinc_;
+    const polyphase *kernel_;
     std::vector<float> buf_;
     float cutoff_;
     float ratio_;
@@ -112,7 +112,7 @@ char* CNES::DISASSEMBLY ( uint32_t addr )
 void CNES::DISASSEMBLE ( void )
 {
    C6502::DISASSEMBLE();
-   CROM::DISASSEMBLE();
+   CROM::DISASSEMBLEVISIBLE();
 }
 
 void CNES::PRINTABLEADDR ( char* buffer, uint32_t addr )
@@ -278,6 +278,10 @@ void CNES::RESET ( uint32_t mapper, bool soft )
 
    // Reset mapper and set up quick access pointer to mapper function table.
    MAPPERFUNC = &(_mapperfunc[mapper]);
+   if ( nesIsCounting() )
+   {
+      MAPPERCOUNTING ( true );
+   }
    MAPPERFUNC->reset ( soft );
 
    // Reset emulated PPU...
@@ -291,6 +295,49 @@ void CNES::RESET ( uint32_t mapper, bool soft )
    m_frame = 0;
 }
 
+bool CNES::STATE ( CNESState& state )
+{
+   uint32_t magic = NES_STATE_MAGIC;
+   uint32_t version = NES_STATE_VERSION;
+   uint32_t mapper = CROM::MAPPER();
+   int32_t  videoMode = m_videoMode;
+   uint32_t prgBanks = CROM::NUMPRGROMBANKS();
+   uint32_t chrBanks = CROM::NUMCHRROMBANKS();
+
+   // The bank counts keep a snapshot from another cartridge with the
+   // same mapper from mapping banks this cartridge doesn't have.
+   STATESYNC(state,magic);
+   STATESYNC(state,version);
+   STATESYNC(state,mapper);
+   STATESYNC(state,videoMode);
+   STATESYNC(state,prgBanks);
+   STATESYNC(state,chrBanks);
+   if ( state.LOADING() &&
+        (state.OVERRUN() ||
+        (magic != NES_STATE_MAGIC) ||
+        (version != NES_STATE_VERSION) ||
+        (mapper != CROM::MAPPER()) ||
+        (videoMode != m_videoMode) ||
+        (prgBanks != CROM::NUMPRGROMBANKS()) ||
+        (chrBanks != CROM::NUMCHRROMBANKS())) )
+   {
+      return false;
+   }
+
+   STATESYNC(state,m_frame);
+   C6502::STATE ( state );
+   CPPU::STATE ( state );
+   CAPU::STATE ( state );
+   CROM::STATE ( state );
+   if ( MAPPERFUNC->state )
+   {
+      MAPPERFUNC->state ( state );
+   }
+   CIO::STATE ( state );
+
+   return !state.OVERRUN();
+}
+
 void CNES::STEPCPUBREAKPOINT ( void )
 {
    m_bStepCPUBreakpoint = true;
@@ -322,6 +369,11 @@ void CNES::CHECKBREAKPOINT ( eBreakpointTarget target, eBreakpointType type, int
    int32_t value = 0;
    bool force = false;
 
+   if ( nesIsCounting() )
+   {
+      __nescounters.breakpointChecks++;
+   }
+
    // If stepping, break...
    if ( (m_bStepCPUBreakpoint) &&
         (target == eBreakInCPU) &&
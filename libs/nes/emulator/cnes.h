@@ -4,6 +4,7 @@
 #include "ctracer.h"
 #include "cjoypadlogger.h"
 #include "cnesbreakpointinfo.h"
+#include "cnesstate.h"
 
 #include "nes_emulator_core.h"
 
@@ -86,6 +87,12 @@ public:
    // the ROM object with the appropriate mapper index.
    static void RESET ( uint32_t mapper, bool soft );
 
+   // This method saves or restores a complete snapshot of the NES.
+   // Loading fails, leaving the NES untouched, if the snapshot was
+   // taken by a different emulator version or of a different mapper.
+   // Snapshots are only valid between calls to RUN.
+   static bool STATE ( CNESState& state );
+
    // This method emulates a NES video frame and passes the
    // current state of the joypad to the emulation engine.
    // The current state of the joypad is constructed from
@@ -189,6 +189,9 @@ int32_t  C6502::m_writeDmaCounter = 0;
 uint16_t C6502::m_readDmaAddr = 0x0000;
 int32_t     C6502::m_dmaRequest = -1;
 int32_t  C6502::m_readDmaCounter = 0;
+uint8_t  C6502::m_dmaData = 0x00;
+uint8_t  C6502::m_brkVectorLo = 0x00;
+bool     C6502::m_brkIrq = false;
 
 int32_t         C6502::amode;
 uint8_t*  C6502::data = NULL;
@@ -205,6 +208,7 @@ CMarker*         C6502::m_marker = NULL;
 CCodeDataLogger* C6502::m_logger = NULL;
 
 uint8_t*   C6502::m_RAMopcodeMask = NULL;
+bool       C6502::m_RAMopcodeMaskDirty = true;
 char**     C6502::m_RAMdisassembly = NULL;
 uint16_t*  C6502::m_RAMsloc2addr = NULL;
 uint16_t*  C6502::m_RAMaddr2sloc = NULL;
@@ -836,7 +840,6 @@ void C6502::ADVANCE ( bool stealing )
 bool C6502::DMA( void )
 {
    bool doCycle = true;
-   static uint8_t databuf;
 
    // If the DMC DMA request is active it means the CPU was writing when
    // the DMC DMA controller went active.  We need to assert RDY on the next
@@ -919,7 +922,7 @@ bool C6502::DMA( void )
       // If we're ready to do the sprite DMA read, do it.
       if ( m_writeDmaCounter )
       {
-         databuf = DMA(m_writeDmaAddr|(((512-m_writeDmaCounter)>>1)&0xFF));
+         m_dmaData = DMA(m_writeDmaAddr|(((512-m_writeDmaCounter)>>1)&0xFF));
 
          if ( nesIsDebuggable() )
          {
@@ -987,7 +990,7 @@ bool C6502::DMA( void )
       {
          DMA ( (m_writeDmaAddr)|(((512-m_writeDmaCounter)>>1)&0xFF),
                OAMDATA,
-               databuf );
+               m_dmaData );
          m_writeDmaCounter--;
          doCycle = false;
          goto done;
@@ -1038,7 +1041,7 @@ bool C6502::DMA( void )
       // If this is a read-beat, do the read.
       if ( !(m_writeDmaCounter&0x01) )
       {
-         databuf = DMA(m_writeDmaAddr|(((512-m_writeDmaCounter)>>1)&0xFF));
+         m_dmaData = DMA(m_writeDmaAddr|(((512-m_writeDmaCounter)>>1)&0xFF));
          doCycle = false;
       }
       // If this is a write-beat, do the write.
@@ -1046,7 +1049,7 @@ bool C6502::DMA( void )
       {
          DMA ( (m_writeDmaAddr)|(((512-m_writeDmaCounter)>>1)&0xFF),
                OAMDATA,
-               databuf );
+               m_dmaData );
          doCycle = false;
       }
       m_writeDmaCounter--;
@@ -1091,7 +1094,7 @@ bool C6502::DMA( void )
       {
          if ( !(m_writeDmaCounter&1) )
          {
-            databuf = DMA(m_writeDmaAddr|(((512-m_writeDmaCounter)>>1)&0xFF));
+            m_dmaData = DMA(m_writeDmaAddr|(((512-m_writeDmaCounter)>>1)&0xFF));
             m_writeDmaCounter--;
             doCycle = false;
          }
@@ -1100,7 +1103,7 @@ bool C6502::DMA( void )
          {
             DMA ( (m_writeDmaAddr)|(((512-m_writeDmaCounter)>>1)&0xFF),
                   OAMDATA,
-                  databuf );
+                  m_dmaData );
             m_writeDmaCounter--;
             doCycle = false;
          }
@@ -3389,8 +3392,6 @@ void C6502::SED ( void )
 void C6502::BRK ( void )
 {
    uint8_t         pchi;
-   static uint8_t  pclo = 0x00;
-   static bool     doingIrq = false;
 
    if ( !m_killed )
    {
@@ -3407,26 +3408,26 @@ void C6502::BRK ( void )
          PUSH ( rF() );
          if ( m_nmiPending )
          {
-            doingIrq = false;
+            m_brkIrq = false;
          }
          else
          {
-            doingIrq = true;
+            m_brkIrq = true;
          }
       }
       else
       {
-         if ( m_nmiPending && !doingIrq )
+         if ( m_nmiPending && !m_brkIrq )
          {
             if ( m_instrCycle == 5 )
             {
-               pclo = MEM(VECTOR_NMI);
+               m_brkVectorLo = MEM(VECTOR_NMI);
             }
             else if ( m_instrCycle == 6 )
             {
                pchi = MEM(VECTOR_NMI+1);
 
-               wPC ( MAKE16(pclo,pchi) );
+               wPC ( MAKE16(m_brkVectorLo,pchi) );
 
                if ( rPC() == m_pcGoto )
                {
@@ -3442,20 +3443,20 @@ void C6502::BRK ( void )
 
                sI();
                m_nmiPending = false;
-               doingIrq = false;
+               m_brkIrq = false;
             }
          }
          else
          {
             if ( m_instrCycle == 5 )
             {
-               pclo = MEM(VECTOR_IRQ);
+               m_brkVectorLo = MEM(VECTOR_IRQ);
             }
             else if ( m_instrCycle == 6 )
             {
                pchi = MEM(VECTOR_IRQ+1);
 
-               wPC ( MAKE16(pclo,pchi) );
+               wPC ( MAKE16(m_brkVectorLo,pchi) );
 
                if ( rPC() == m_pcGoto )
                {
@@ -3471,7 +3472,7 @@ void C6502::BRK ( void )
 
                sI();
                m_irqPending = false;
-               doingIrq = false;
+               m_brkIrq = false;
             }
          }
       }
@@ -3602,6 +3603,59 @@ void C6502::RESET ( bool soft )
    }
 }
 
+void C6502::STATE ( CNESState& state )
+{
+   uint8_t haveOpcode;
+
+   STATESYNC(state,m_killed);
+   STATESYNC(state,m_irqAsserted);
+   STATESYNC(state,m_irqPending);
+   STATESYNC(state,m_nmiAsserted);
+   STATESYNC(state,m_nmiPending);
+   state.SYNC(m_6502memory,MEM_2KB);
+   STATESYNC(state,m_a);
+   STATESYNC(state,m_x);
+   STATESYNC(state,m_y);
+   STATESYNC(state,m_f);
+   STATESYNC(state,m_pc);
+   STATESYNC(state,m_pcSync);
+   STATESYNC(state,m_pcSyncSet);
+   STATESYNC(state,m_sp);
+   STATESYNC(state,m_ea);
+   STATESYNC(state,m_cycles);
+   STATESYNC(state,m_instrCycle);
+   STATESYNC(state,m_curCycles);
+   STATESYNC(state,amode);
+   STATESYNC(state,m_dmaRequest);
+   STATESYNC(state,m_writeDmaAddr);
+   STATESYNC(state,m_writeDmaCounter);
+   STATESYNC(state,m_readDmaAddr);
+   STATESYNC(state,m_readDmaCounter);
+   STATESYNC(state,m_dmaData);
+   STATESYNC(state,m_brkVectorLo);
+   STATESYNC(state,m_brkIrq);
+   STATESYNC(state,opcodeData);
+   STATESYNC(state,opcodeSize);
+   STATESYNC(state,m_write);
+   STATESYNC(state,m_openBusData);
+   STATESYNC(state,m_phase);
+
+   // The opcode being executed is kept as a pointer into the opcode
+   // table so it is saved as a flag plus the opcode that selects it.
+   haveOpcode = pOpcodeStruct?1:0;
+   STATESYNC(state,haveOpcode);
+
+   if ( state.LOADING() )
+   {
+      pOpcodeStruct = haveOpcode?m_6502opcode+(*opcodeData):NULL;
+      data = opcodeData+1;
+
+      // The tracer doesn't survive a state load.
+      pDisassemblySample = NULL;
+      m_RAMopcodeMaskDirty = true;
+   }
+}
+
 uint8_t C6502::LOAD ( uint32_t addr, int8_t* pTarget )
 {
    uint8_t data = C6502::OPENBUS();
@@ -3674,6 +3728,12 @@ void C6502::STORE ( uint32_t addr, uint8_t data, int8_t* pTarget )
       (*pTarget) = eTarget_RAM;
       addr &= 0x7FF; // RAM mirrored...
       m_6502memory[addr] = data&0xFF;
+
+      // Self-modifying code invalidates the RAM disassembly...
+      if ( nesIsDebuggable() )
+      {
+         OPCODEWRITTEN ( addr );
+      }
    }
    else if ( addr < 0x4000 )
    {
@@ -4266,8 +4326,11 @@ uint32_t C6502::MAKEADDR ( int32_t amode, uint8_t* data )
 
 void C6502::DISASSEMBLE ()
 {
-   if ( __PCSYNC() < 0x800 )
+   if ( (__PCSYNC() < 0x800) &&
+        (m_RAMopcodeMaskDirty) )
    {
+      m_RAMopcodeMaskDirty = false;
+
       DISASSEMBLE ( m_RAMdisassembly,
                     m_6502memory,
                     MEM_2KB,
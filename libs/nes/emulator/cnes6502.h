@@ -4,6 +4,7 @@
 #include "nes_emulator_core.h"
 
 #include "cnes.h"
+#include "cnesstate.h"
 
 #include "cmarker.h"
 #include "ctracer.h"
@@ -162,6 +163,9 @@ public:
    // CPU reset vector routine.
    static void RESET ( bool soft );
 
+   // Save or restore the CPU core's complete state.
+   static void STATE ( CNESState& state );
+
    // Routines to manipulate the IRQ/NMI inputs to the CPU core.
    static void ASSERTIRQ ( int8_t source );
    static void RELEASEIRQ ( int8_t source );
@@ -316,10 +320,12 @@ public:
    static void MEMSET ( uint32_t addr, uint8_t* data, uint32_t length )
    {
       memcpy(m_6502memory+addr,data,length);
+      m_RAMopcodeMaskDirty = true;
    };
    static void MEMCLR ( void )
    {
       memset(m_6502memory,0,MEM_2KB);
+      m_RAMopcodeMaskDirty = true;
    }
 
    // Method to return the current open bus data.
@@ -541,9 +547,15 @@ public:
    // need to display disassembly of a memory location they
    // retrieve it from the database generated by the runtime
    // disassembler.
+   // The disassembly of RAM is only regenerated if the opcode mask
+   // changes or if a byte that has been executed as code is written.
    static inline void OPCODEMASK ( uint32_t addr, uint8_t mask )
    {
-      *(m_RAMopcodeMask+(addr&MEM_2KB)) = mask;
+      if ( (*(m_RAMopcodeMask+(addr&MASK_2KB))) != mask )
+      {
+         m_RAMopcodeMaskDirty = true;
+      }
+      *(m_RAMopcodeMask+(addr&MASK_2KB)) = mask;
    }
    static inline void OPCODEMASKCLR ( void )
    {
@@ -552,6 +564,14 @@ public:
       {
          m_RAMopcodeMask[idx] = 0;
       }
+      m_RAMopcodeMaskDirty = true;
+   }
+   static inline void OPCODEWRITTEN ( uint32_t addr )
+   {
+      if ( *(m_RAMopcodeMask+(addr&MASK_2KB)) )
+      {
+         m_RAMopcodeMaskDirty = true;
+      }
    }
    static inline char* DISASSEMBLY ( uint32_t addr )
    {
@@ -661,6 +681,14 @@ protected:
    static uint16_t m_readDmaAddr;
    static int32_t m_readDmaCounter;
 
+   // Byte in flight between the read and write beats of sprite DMA.
+   static uint8_t m_dmaData;
+
+   // Interrupt vector low byte and NMI/IRQ selection carried across
+   // the cycles of a BRK/NMI/IRQ sequence.
+   static uint8_t m_brkVectorLo;
+   static bool    m_brkIrq;
+
    // The current opcode's full 1-, 2-, or 3-byte instruction data.
    static uint8_t*  data;
    static uint8_t   opcodeData [ 4 ]; // 3 opcode bytes and 1 byte for operand return data [extra cycle]
@@ -717,6 +745,7 @@ protected:
 
    // The data structures that support runtime disassembly of executed code.
    static uint8_t*   m_RAMopcodeMask;
+   static bool       m_RAMopcodeMaskDirty;
    static char**           m_RAMdisassembly;
    static uint16_t*  m_RAMsloc2addr;
    static uint16_t*  m_RAMaddr2sloc;
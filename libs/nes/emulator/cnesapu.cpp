@@ -561,6 +561,41 @@ void CAPU::RESET ( void )
    apuDataAvailable = 0;
 }
 
+void CAPU::STATE ( CNESState& state )
+{
+   bool muted [ 5 ];
+
+   STATESYNC(state,m_APUreg);
+   STATESYNC(state,m_APUregDirty);
+   STATESYNC(state,m_irqEnabled);
+   STATESYNC(state,m_irqAsserted);
+   STATESYNC(state,m_sequencerMode);
+   STATESYNC(state,m_newSequencerMode);
+   STATESYNC(state,m_changeModes);
+   STATESYNC(state,m_sequenceStep);
+   STATESYNC(state,m_cycles);
+
+   // The channels have no virtual methods or pointers to emulated memory
+   // so they are kept whole.  Muting is a user setting, not machine state.
+   muted[0] = m_square[0].MUTED();
+   muted[1] = m_square[1].MUTED();
+   muted[2] = m_triangle.MUTED();
+   muted[3] = m_noise.MUTED();
+   muted[4] = m_dmc.MUTED();
+   STATESYNC(state,m_square);
+   STATESYNC(state,m_triangle);
+   STATESYNC(state,m_noise);
+   m_dmc.STATE(state);
+   m_square[0].MUTE(muted[0]);
+   m_square[1].MUTE(muted[1]);
+   m_triangle.MUTE(muted[2]);
+   m_noise.MUTE(muted[3]);
+   m_dmc.MUTE(muted[4]);
+
+   // The sample buffer holds audio not yet played; it isn't part of
+   // the machine's state.
+}
+
 CAPUOscillator::CAPUOscillator (uint8_t periodAdjust) :
       m_periodAdjust(periodAdjust)
 {
@@ -1734,6 +1769,11 @@ if ( wavOut )
 
       apuDataAvailable++;
 
+      if ( nesIsCounting() )
+      {
+         __nescounters.apuSamples++;
+      }
+
       if ( apuDataAvailable >= APU_BUFFER_PRERENDER )
       {
          nesBreakAudio();
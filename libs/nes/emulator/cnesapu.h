@@ -2,6 +2,7 @@
 #define APU_H
 
 #include "nes_emulator_core.h"
+#include "cnesstate.h"
 
 #include "cregisterdata.h"
 #include "cbreakpointinfo.h"
@@ -488,6 +489,19 @@ public:
 
    void DMASAMPLE ( uint8_t data );
 
+   // Save or restore the channel.  The DMA source belongs to the
+   // music designer so it is left alone by a state load.
+   void STATE ( CNESState& state )
+   {
+      uint8_t* dmaSource = m_dmaSource;
+      uint8_t* dmaSourcePtr = m_dmaSourcePtr;
+
+      state.SYNC(this,sizeof(CAPUDMC));
+
+      m_dmaSource = dmaSource;
+      m_dmaSourcePtr = dmaSourcePtr;
+   }
+
    // These methods deal with the delta-modulation channel's interrupt flag.
    bool IRQASSERTED ( void ) const
    {
@@ -584,6 +598,7 @@ public:
    CAPU();
 
    static void RESET ( void );
+   static void STATE ( CNESState& state );
    static uint32_t APU ( uint32_t addr );
    static void APU ( uint32_t addr, uint8_t data );
    static void EMULATE ( void );
@@ -481,3 +481,31 @@ void CIOVaus::SPECIAL(int32_t port,int32_t special)
 {
    m_trimPot[port] = special;
 }
+
+void CIO::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_ioJoy);
+
+   CIOStandardJoypad::STATE(state);
+   CIOTurboJoypad::STATE(state);
+   CIOVaus::STATE(state);
+}
+
+void CIOStandardJoypad::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_ioJoyLatch);
+   STATESYNC(state,m_last4016);
+}
+
+void CIOTurboJoypad::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_lastFrame);
+   STATESYNC(state,m_alternator);
+}
+
+void CIOVaus::STATE ( CNESState& state )
+{
+   // The trim pot is a user setting, not machine state.
+   STATESYNC(state,m_ioPotLatch);
+   STATESYNC(state,m_last4016);
+}
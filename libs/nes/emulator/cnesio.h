@@ -2,6 +2,7 @@
 #define IO_H
 
 #include "cjoypadlogger.h"
+#include "cnesstate.h"
 #include "nes_emulator_core.h"
 
 class CIO
@@ -18,6 +19,9 @@ public:
       *(m_ioJoy+joy) = data;
    }
 
+   // Save or restore the state of every controller type.
+   static void STATE ( CNESState& state );
+
 protected:
    static uint32_t  m_ioJoy [ NUM_CONTROLLERS ];
 };
@@ -32,6 +36,7 @@ public:
    static void _IO ( uint32_t addr, uint8_t data );
    static uint32_t _IO ( uint32_t addr );
    static inline CJoypadLogger* LOGGER ( int idx ) { return m_logger+idx; }
+   static void STATE ( CNESState& state );
 
 protected:
    static uint8_t   m_ioJoyLatch [ NUM_CONTROLLERS ];
@@ -47,6 +52,7 @@ public:
    static void IO ( uint32_t addr, uint8_t data );
    static void _IO ( uint32_t addr, uint8_t data );
    static uint32_t _IO ( uint32_t addr );
+   static void STATE ( CNESState& state );
 
 protected:
    static uint32_t m_lastFrame;
@@ -63,6 +69,7 @@ public:
    static void _IO ( uint32_t addr, uint8_t data );
    static uint32_t _IO ( uint32_t addr );
    static void SPECIAL ( int32_t port, int32_t special );
+   static void STATE ( CNESState& state );
 
 protected:
    static uint8_t   m_ioPotLatch [ NUM_CONTROLLERS ];
@@ -2,6 +2,7 @@
 #define MAPPERS_H
 
 #include "nes_emulator_core.h"
+#include "cnesstate.h"
 
 typedef void (*RESETFUNC)(bool soft);
 typedef uint32_t (*MAPPERRFUNC)(uint32_t addr);
@@ -10,6 +11,7 @@ typedef void (*SYNCPPUFUNC)(uint32_t ppuCycle, uint32_t ppuAddr);
 typedef void (*SYNCCPUFUNC)(void);
 typedef uint16_t (*SOUNDFUNC)(void);
 typedef void (*SOUNDENAFUNC)(uint32_t mask);
+typedef void (*STATEFUNC)(CNESState& state);
 
 typedef struct _MapperFuncs
 {
@@ -25,10 +27,14 @@ typedef struct _MapperFuncs
    SOUNDENAFUNC soundenable;
    bool     remapPrg;
    bool     remapChr;
+   STATEFUNC    state; // NULL if the mapper has no registers of its own.
 } MapperFuncs;
 
 extern MapperFuncs _mapperfunc[];
 
 extern MapperFuncs* MAPPERFUNC;
 
+// Installs or removes the call-counting wrapper around MAPPERFUNC.
+void MAPPERCOUNTING ( bool enable );
+
 #endif
@@ -1138,6 +1138,88 @@ void CPPU::RESET ( bool soft )
    }
 }
 
+void CPPU::STATE ( CNESState& state )
+{
+   uint32_t ref = 0;
+   uint8_t* ptr [ 8 ];
+   int32_t  bank;
+
+   STATESYNC(state,m_PALETTEmemory);
+   state.SYNC(m_PPUmemory,MEM_4KB);
+
+   // Nametables may be mapped to the PPU's own memory or to
+   // cartridge memory by some mappers.
+   for ( bank = 0; bank < 8; bank++ )
+   {
+      if ( state.SAVING() )
+      {
+         if ( (m_pPPUmemory[bank] >= m_PPUmemory) &&
+              (m_pPPUmemory[bank] < m_PPUmemory+MEM_4KB) )
+         {
+            ref = STATE_REF(STATE_REGION_VRAM,m_pPPUmemory[bank]-m_PPUmemory);
+         }
+         else
+         {
+            ref = CROM::STATEREF(m_pPPUmemory[bank]);
+         }
+      }
+      STATESYNC(state,ref);
+      if ( state.LOADING() )
+      {
+         if ( STATE_REF_REGION(ref) == STATE_REGION_VRAM )
+         {
+            ptr[bank] = (STATE_REF_OFFSET(ref) < MEM_4KB) ? m_PPUmemory+STATE_REF_OFFSET(ref) : NULL;
+         }
+         else
+         {
+            ptr[bank] = CROM::STATEPTR(ref);
+         }
+
+         // The nametables are always mapped somewhere.
+         if ( !ptr[bank] )
+         {
+            state.FAIL();
+         }
+      }
+   }
+   if ( state.LOADING() && (!state.OVERRUN()) )
+   {
+      for ( bank = 0; bank < 8; bank++ )
+      {
+         m_pPPUmemory[bank] = ptr[bank];
+      }
+   }
+
+   STATESYNC(state,m_ppuRegByte);
+   STATESYNC(state,m_oamAddr);
+   STATESYNC(state,m_ppuAddr);
+   STATESYNC(state,m_ppuAddrLatch);
+   STATESYNC(state,m_ppuAddrIncrement);
+   STATESYNC(state,m_ppuReadLatch);
+   STATESYNC(state,m_ppuIOLatch);
+   STATESYNC(state,m_ppuIOLatchDecayFrames);
+   STATESYNC(state,m_PPUreg);
+   STATESYNC(state,m_PPUoam);
+   STATESYNC(state,m_ppuScrollX);
+   STATESYNC(state,m_oneScreen);
+   STATESYNC(state,m_extraVRAM);
+   STATESYNC(state,m_cycles);
+   STATESYNC(state,m_frame);
+   STATESYNC(state,m_curCycles);
+   STATESYNC(state,m_vblankChoked);
+   STATESYNC(state,m_nmiChoked);
+   STATESYNC(state,m_nmiReenabled);
+   STATESYNC(state,m_spriteTemporaryMemory);
+   STATESYNC(state,m_spriteBuffer);
+   STATESYNC(state,m_bkgndBuffer);
+   STATESYNC(state,m_last2005x);
+   STATESYNC(state,m_last2005y);
+   STATESYNC(state,m_lastSprite0HitX);
+   STATESYNC(state,m_lastSprite0HitY);
+   STATESYNC(state,m_x);
+   STATESYNC(state,m_y);
+}
+
 uint32_t CPPU::PPU ( uint32_t addr )
 {
    uint8_t data = 0xFF;
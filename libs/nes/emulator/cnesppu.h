@@ -199,6 +199,11 @@ public:
    // Cleans up the PPU state as if a NES reset had just occurred.
    static void RESET ( bool soft );
 
+   // Save or restore the PPU's complete state.  State is only taken
+   // between frames, when no fetch is in progress in the rendering
+   // routines, so their working variables don't need to be saved.
+   static void STATE ( CNESState& state );
+
    // State and internal data accessor interfaces.
    // Read a PPU register, affecting the PPU's internal state.
    // This function is used during emulation.
@@ -94,6 +94,8 @@ CMemoryDatabase* CROM::m_dbCHRMemory = dbCHRMemory;
 CBreakpointEventInfo** CROM::m_tblBreakpointEvents = tblMapperEvents;
 int32_t                CROM::m_numBreakpointEvents = NUM_MAPPER_EVENTS;
 
+uint8_t*  CROM::m_PRGROMbuffer = NULL;
+uint8_t*  CROM::m_PRGROMbase = NULL;
 uint8_t** CROM::m_PRGROMmemory = NULL;
 uint8_t** CROM::m_CHRmemory = NULL;
 uint8_t*  CROM::m_pPRGROMmemory [] = { NULL, NULL, NULL, NULL };
@@ -103,8 +105,10 @@ uint8_t*  CROM::m_pSRAMmemory [] = { NULL, NULL, NULL, NULL, NULL };
 uint8_t*  CROM::m_EXRAMmemory = NULL;
 
 uint32_t           CROM::m_mapper = 0;
+uint32_t           CROM::m_submapper = 0;
 uint32_t           CROM::m_numPrgBanks = 0;
 uint32_t           CROM::m_numChrBanks = 0;
+uint32_t           CROM::m_numSramBanks = NUM_SRAM_BANKS;
 
 CCodeDataLogger* CROM::m_pLogger [] = { NULL, };
 CCodeDataLogger* CROM::m_pEXRAMLogger = NULL;
@@ -137,6 +141,8 @@ CROM::CROM()
    int32_t bank;
    int32_t addr;
 
+   m_PRGROMbuffer = new uint8_t[NUM_ROM_BANKS*MEM_8KB];
+   m_PRGROMbase = m_PRGROMbuffer;
    m_PRGROMmemory = new uint8_t*[NUM_ROM_BANKS];
    m_PRGROMdisassembly = new char**[NUM_ROM_BANKS];
    m_PRGROMopcodeMaskDirty = new bool[NUM_ROM_BANKS];
@@ -146,7 +152,7 @@ CROM::CROM()
    m_PRGROMsloc = new uint32_t[NUM_ROM_BANKS];
    for ( bank = 0; bank < NUM_ROM_BANKS; bank++ )
    {
-      m_PRGROMmemory[bank] = new uint8_t[MEM_8KB+1]; // Leave room for bank ID.
+      m_PRGROMmemory[bank] = m_PRGROMbuffer+(bank*MEM_8KB);
       m_PRGROMdisassembly[bank] = new char*[MEM_8KB];
       m_PRGROMopcodeMaskDirty[bank] = true;
       m_PRGROMopcodeMask[bank] = new uint8_t[MEM_8KB];
@@ -162,12 +168,6 @@ CROM::CROM()
          m_PRGROMsloc2addr[bank][addr] = 0;
          m_PRGROMaddr2sloc[bank][addr] = 0;
       }
-
-      // Store bank ID in bank data at the end.  This is used only
-      // by code that needs to calculate absolute address stuff.
-      // Since the banks are stored non-contiguously this is a cheap
-      // way to get the bank ID without having to implement a structure.
-      m_PRGROMmemory[bank][MEM_8KB] = bank;
    }
 
    m_SRAMmemory = new uint8_t*[NUM_SRAM_BANKS];
@@ -254,13 +254,13 @@ CROM::~CROM()
       {
          delete m_PRGROMdisassembly[bank][addr];
       }
-      delete [] m_PRGROMmemory[bank];
       delete [] m_PRGROMopcodeMask[bank];
       delete [] m_PRGROMsloc2addr[bank];
       delete [] m_PRGROMaddr2sloc[bank];
    }
    delete [] m_PRGROMopcodeMaskDirty;
    delete [] m_PRGROMmemory;
+   delete [] m_PRGROMbuffer;
    delete [] m_PRGROMopcodeMask;
    delete [] m_PRGROMsloc2addr;
    delete [] m_PRGROMaddr2sloc;
@@ -300,12 +300,76 @@ CROM::~CROM()
    delete [] m_EXRAMaddr2sloc;
 }
 
+void CROM::ClearPRGBanks ()
+{
+   uint32_t bank;
+
+   // Go back to the internal PRG-ROM buffer in case a ROM image
+   // was previously handed to us with SetPRGROM.
+   m_PRGROMbase = m_PRGROMbuffer;
+   for ( bank = 0; bank < NUM_ROM_BANKS; bank++ )
+   {
+      m_PRGROMmemory[bank] = m_PRGROMbuffer+(bank*MEM_8KB);
+      m_PRGROMopcodeMaskDirty[bank] = true;
+   }
+   m_numPrgBanks = 0;
+   m_submapper = 0;
+   m_numSramBanks = NUM_SRAM_BANKS;
+}
+
 void CROM::SetPRGBank ( int32_t bank, uint8_t* data )
 {
    memcpy ( m_PRGROMmemory[m_numPrgBanks], data, MEM_8KB );
    m_numPrgBanks++;
 }
 
+void CROM::SetPRGROM ( uint8_t* data, uint32_t numBanks )
+{
+   uint32_t bank;
+
+   // Use the caller's ROM image in place rather than copying it.  The image
+   // is only ever read so it may be a read-only memory mapping of the ROM
+   // file shared by every emulator instance running the same ROM.
+   if ( numBanks > NUM_ROM_BANKS )
+   {
+      numBanks = NUM_ROM_BANKS;
+   }
+   if ( numBanks == 0 )
+   {
+      return;
+   }
+
+   m_PRGROMbase = data;
+   for ( bank = 0; bank < NUM_ROM_BANKS; bank++ )
+   {
+      // Banks beyond the end of the image mirror the image, as they would
+      // on a cartridge with unconnected upper PRG-ROM address lines.
+      m_PRGROMmemory[bank] = data+((bank%numBanks)*MEM_8KB);
+      m_PRGROMopcodeMaskDirty[bank] = true;
+   }
+   m_numPrgBanks = numBanks;
+}
+
+void CROM::SetPRGRAMSize ( uint32_t size )
+{
+   m_numSramBanks = size/MEM_8KB;
+   if ( size == 0 )
+   {
+      // The size is unknown, let the mapper bank all of the SRAM.
+      m_numSramBanks = NUM_SRAM_BANKS;
+   }
+   else if ( m_numSramBanks == 0 )
+   {
+      // Anything that has SRAM has at least one bank of it as far
+      // as the emulator is concerned.
+      m_numSramBanks = 1;
+   }
+   else if ( m_numSramBanks > NUM_SRAM_BANKS )
+   {
+      m_numSramBanks = NUM_SRAM_BANKS;
+   }
+}
+
 void CROM::SetCHRBank ( int32_t bank, uint8_t* data )
 {
    uint8_t ibank;
@@ -330,7 +394,9 @@ void CROM::DoneLoadingBanks ()
    if ( nesIsDebuggable() )
    {
       // Initial disassembly will be 'crap' but do it anyway...
-      DISASSEMBLE();
+      // Banks that aren't mapped in yet are left for the background
+      // disassembler or for when they are first mapped in.
+      DISASSEMBLEVISIBLE();
    }
 
    // We just put a cartridge in...the SRAM isn't dirty yet.
@@ -418,6 +484,142 @@ void CROM::RESET ( uint32_t mapper, bool soft )
    }
 }
 
+// Saves or restores a set of bank pointers.  A snapshot bank that
+// doesn't resolve to memory this cartridge has fails the load and
+// leaves the whole set as it was.
+static void STATEBANKS ( CNESState& state, uint8_t** banks, int32_t count )
+{
+   uint32_t ref;
+   uint8_t* ptr [ 8 ];
+   int32_t  bank;
+
+   for ( bank = 0; bank < count; bank++ )
+   {
+      ref = CROM::STATEREF(banks[bank]);
+      STATESYNC(state,ref);
+      if ( state.LOADING() )
+      {
+         ptr[bank] = CROM::STATEPTR(ref);
+         if ( (!ptr[bank]) && (STATE_REF_REGION(ref) != STATE_REGION_NULL) )
+         {
+            state.FAIL();
+         }
+      }
+   }
+   if ( state.LOADING() && (!state.OVERRUN()) )
+   {
+      for ( bank = 0; bank < count; bank++ )
+      {
+         banks[bank] = ptr[bank];
+      }
+   }
+}
+
+void CROM::STATE ( CNESState& state )
+{
+   int32_t  bank;
+
+   // Only cartridge RAM is saved.  CHR banks past the end of CHR-ROM
+   // are RAM, either CHR-RAM or the extra banks some mappers add.
+   for ( bank = 0; bank < NUM_SRAM_BANKS; bank++ )
+   {
+      state.SYNC(m_SRAMmemory[bank],MEM_8KB);
+   }
+   state.SYNC(m_EXRAMmemory,MEM_1KB);
+   for ( bank = m_numChrBanks<<3; bank < NUM_CHR_BANKS; bank++ )
+   {
+      state.SYNC(m_CHRmemory[bank],MEM_1KB);
+   }
+
+   // Bank mapping.
+   STATEBANKS ( state, m_pPRGROMmemory, 4 );
+   STATEBANKS ( state, m_pCHRmemory, 8 );
+   STATEBANKS ( state, m_pSRAMmemory, 5 );
+
+   if ( state.LOADING() && (!state.OVERRUN()) )
+   {
+      // SRAM no longer matches what was last saved to disk.
+      m_SRAMdirty = true;
+      for ( bank = 0; bank < NUM_SRAM_BANKS; bank++ )
+      {
+         m_SRAMopcodeMaskDirty[bank] = true;
+      }
+      m_EXRAMopcodeMaskDirty = true;
+   }
+}
+
+uint32_t CROM::STATEREF ( uint8_t* ptr )
+{
+   uint32_t bank;
+
+   if ( !ptr )
+   {
+      return STATE_REF(STATE_REGION_NULL,0);
+   }
+   if ( m_PRGROMbase &&
+        (ptr >= m_PRGROMbase) &&
+        (ptr < m_PRGROMbase+(m_numPrgBanks*MEM_8KB)) )
+   {
+      return STATE_REF(STATE_REGION_PRGROM,ptr-m_PRGROMbase);
+   }
+   if ( (ptr >= m_EXRAMmemory) && (ptr < m_EXRAMmemory+MEM_1KB) )
+   {
+      return STATE_REF(STATE_REGION_EXRAM,ptr-m_EXRAMmemory);
+   }
+
+   // SRAM and CHR banks are allocated separately so each must be checked.
+   for ( bank = 0; bank < NUM_SRAM_BANKS; bank++ )
+   {
+      if ( (ptr >= m_SRAMmemory[bank]) && (ptr < m_SRAMmemory[bank]+MEM_8KB) )
+      {
+         return STATE_REF(STATE_REGION_SRAM,(bank*MEM_8KB)+(ptr-m_SRAMmemory[bank]));
+      }
+   }
+   for ( bank = 0; bank < NUM_CHR_BANKS; bank++ )
+   {
+      if ( (ptr >= m_CHRmemory[bank]) && (ptr < m_CHRmemory[bank]+MEM_1KB) )
+      {
+         return STATE_REF(STATE_REGION_CHRMEM,(bank*MEM_1KB)+(ptr-m_CHRmemory[bank]));
+      }
+   }
+
+   return STATE_REF(STATE_REGION_NULL,0);
+}
+
+uint8_t* CROM::STATEPTR ( uint32_t ref )
+{
+   uint32_t offset = STATE_REF_OFFSET(ref);
+
+   switch ( STATE_REF_REGION(ref) )
+   {
+   case STATE_REGION_PRGROM:
+      if ( m_PRGROMbase && (offset < m_numPrgBanks*MEM_8KB) )
+      {
+         return m_PRGROMbase+offset;
+      }
+      break;
+   case STATE_REGION_CHRMEM:
+      if ( offset < NUM_CHR_BANKS*MEM_1KB )
+      {
+         return m_CHRmemory[offset>>SHIFT_8KB_1KB]+(offset&MASK_1KB);
+      }
+      break;
+   case STATE_REGION_SRAM:
+      if ( offset < NUM_SRAM_BANKS*MEM_8KB )
+      {
+         return m_SRAMmemory[offset>>SHIFT_64KB_8KB]+(offset&MASK_8KB);
+      }
+      break;
+   case STATE_REGION_EXRAM:
+      if ( offset < MEM_1KB )
+      {
+         return m_EXRAMmemory+offset;
+      }
+      break;
+   }
+   return NULL;
+}
+
 uint32_t CROM::LMAPPER ( uint32_t addr )
 {
    uint8_t data = C6502::OPENBUS();
@@ -446,6 +648,24 @@ void CROM::LMAPPER ( uint32_t addr, uint8_t data )
    }
 }
 
+static inline void DISASSEMBLEBANK ( bool* dirty, char** disassembly, uint8_t* binary, int32_t binaryLength, uint8_t* opcodeMask, uint16_t* sloc2addr, uint16_t* addr2sloc, uint32_t* sourceLength )
+{
+   if ( (*dirty) )
+   {
+      // Clear the dirty flag before disassembling so that a write to
+      // executed code that occurs during disassembly is not lost.
+      (*dirty) = false;
+
+      C6502::DISASSEMBLE ( disassembly,
+                           binary,
+                           binaryLength,
+                           opcodeMask,
+                           sloc2addr,
+                           addr2sloc,
+                           sourceLength );
+   }
+}
+
 void CROM::DISASSEMBLE ()
 {
    uint32_t bank;
@@ -453,50 +673,86 @@ void CROM::DISASSEMBLE ()
    // Disassemble PRG-ROM banks...
    for ( bank = 0; bank < m_numPrgBanks; bank++ )
    {
-      if ( *(m_PRGROMopcodeMaskDirty+bank) )
-      {
-         C6502::DISASSEMBLE ( m_PRGROMdisassembly[bank],
-                              m_PRGROMmemory[bank],
-                              MEM_8KB,
-                              m_PRGROMopcodeMask[bank],
-                              m_PRGROMsloc2addr[bank],
-                              m_PRGROMaddr2sloc[bank],
-                              &(m_PRGROMsloc[bank]) );
-
-         *(m_PRGROMopcodeMaskDirty+bank) = false;
-      }
+      DISASSEMBLEBANK ( m_PRGROMopcodeMaskDirty+bank,
+                        m_PRGROMdisassembly[bank],
+                        m_PRGROMmemory[bank],
+                        MEM_8KB,
+                        m_PRGROMopcodeMask[bank],
+                        m_PRGROMsloc2addr[bank],
+                        m_PRGROMaddr2sloc[bank],
+                        &(m_PRGROMsloc[bank]) );
    }
 
    // Disassemble SRAM...
    for ( bank = 0; bank < NUM_SRAM_BANKS; bank++ )
    {
-      if ( *(m_SRAMopcodeMaskDirty+bank) )
-      {
-         C6502::DISASSEMBLE ( m_SRAMdisassembly[bank],
-                              m_SRAMmemory[bank],
-                              MEM_8KB,
-                              m_SRAMopcodeMask[bank],
-                              m_SRAMsloc2addr[bank],
-                              m_SRAMaddr2sloc[bank],
-                              &(m_SRAMsloc[bank]) );
-
-         *(m_SRAMopcodeMaskDirty+bank) = false;
-      }
+      DISASSEMBLEBANK ( m_SRAMopcodeMaskDirty+bank,
+                        m_SRAMdisassembly[bank],
+                        m_SRAMmemory[bank],
+                        MEM_8KB,
+                        m_SRAMopcodeMask[bank],
+                        m_SRAMsloc2addr[bank],
+                        m_SRAMaddr2sloc[bank],
+                        &(m_SRAMsloc[bank]) );
    }
 
    // Disassemble EXRAM...
-   if ( m_EXRAMopcodeMaskDirty )
+   DISASSEMBLEBANK ( &m_EXRAMopcodeMaskDirty,
+                     m_EXRAMdisassembly,
+                     m_EXRAMmemory,
+                     MEM_1KB,
+                     m_EXRAMopcodeMask,
+                     m_EXRAMsloc2addr,
+                     m_EXRAMaddr2sloc,
+                     &(m_EXRAMsloc) );
+}
+
+void CROM::DISASSEMBLEVISIBLE ()
+{
+   uint32_t addr;
+   uint32_t bank;
+
+   if ( !m_numPrgBanks )
    {
-      C6502::DISASSEMBLE ( m_EXRAMdisassembly,
-                           m_EXRAMmemory,
-                           MEM_1KB,
-                           m_EXRAMopcodeMask,
-                           m_EXRAMsloc2addr,
-                           m_EXRAMaddr2sloc,
-                           &(m_EXRAMsloc) );
+      return;
+   }
+
+   // Disassemble PRG-ROM banks mapped at $8000-$FFFF...
+   for ( addr = MEM_32KB; addr < MEM_64KB; addr += MEM_8KB )
+   {
+      bank = PRGBANK_PHYS(addr);
 
-      m_EXRAMopcodeMaskDirty = false;
+      DISASSEMBLEBANK ( m_PRGROMopcodeMaskDirty+bank,
+                        m_PRGROMdisassembly[bank],
+                        m_PRGROMmemory[bank],
+                        MEM_8KB,
+                        m_PRGROMopcodeMask[bank],
+                        m_PRGROMsloc2addr[bank],
+                        m_PRGROMaddr2sloc[bank],
+                        &(m_PRGROMsloc[bank]) );
    }
+
+   // Disassemble SRAM bank mapped at $6000-$7FFF...
+   bank = SRAMBANK_PHYS(SRAM_START);
+
+   DISASSEMBLEBANK ( m_SRAMopcodeMaskDirty+bank,
+                     m_SRAMdisassembly[bank],
+                     m_SRAMmemory[bank],
+                     MEM_8KB,
+                     m_SRAMopcodeMask[bank],
+                     m_SRAMsloc2addr[bank],
+                     m_SRAMaddr2sloc[bank],
+                     &(m_SRAMsloc[bank]) );
+
+   // Disassemble EXRAM...
+   DISASSEMBLEBANK ( &m_EXRAMopcodeMaskDirty,
+                     m_EXRAMdisassembly,
+                     m_EXRAMmemory,
+                     MEM_1KB,
+                     m_EXRAMopcodeMask,
+                     m_EXRAMsloc2addr,
+                     m_EXRAMaddr2sloc,
+                     &(m_EXRAMsloc) );
 }
 
 uint32_t CROM::PRGROMSLOC2ADDR ( uint16_t sloc )
@@ -16,7 +16,10 @@
 // Retrieve the bank-offset address portion of a 6502-address for use within PRG ROM banks
 #define PRGBANK_OFF(addr) ( addr&MASK_8KB )
 // Resolve a 6502-address to one of the 8KB PRG ROM banks within a ROM file [the absolute physical address]
-#define PRGBANK_PHYS(addr) ( *((*(m_pPRGROMmemory+PRGBANK_VIRT(addr)))+MEM_8KB) )
+// NOTE: PRG-ROM banks are stored contiguously, either in the internal PRG-ROM buffer or in a
+// caller-provided (possibly memory-mapped, read-only) ROM image, so the bank ID is simply the
+// distance of the mapped bank from the start of PRG-ROM.
+#define PRGBANK_PHYS(addr) ( ((*(m_pPRGROMmemory+PRGBANK_VIRT(addr)))-m_PRGROMbase)>>SHIFT_32KB_8KB )
 
 // Resolve an absolute address to a PRG-ROM bank
 #define PRGBANK_ABSBANK(absAddr) ( absAddr>>SHIFT_32KB_8KB )
@@ -45,16 +48,19 @@ public:
    ~CROM();
 
    // Priming interfaces (data setup/initialization)
-   static void ClearPRGBanks ()
-   {
-      m_numPrgBanks = 0;
-   }
+   static void ClearPRGBanks ();
    static void ClearCHRBanks ()
    {
       m_numChrBanks = 0;
    }
    static void SetCHRBank ( int32_t bank, uint8_t* data );
    static void SetPRGBank ( int32_t bank, uint8_t* data );
+   static void SetPRGROM ( uint8_t* data, uint32_t numBanks );
+   static void SetSubmapper ( uint32_t submapper )
+   {
+      m_submapper = submapper;
+   }
+   static void SetPRGRAMSize ( uint32_t size );
    static void DoneLoadingBanks ( void );
    static uint32_t NUMPRGROMBANKS ( void )
    {
@@ -64,6 +70,10 @@ public:
    {
       return m_numChrBanks;
    }
+   static uint32_t NUMSRAMBANKS ( void )
+   {
+      return m_numSramBanks;
+   }
 
    // Operations
    static bool IsWriteProtected ( void )
@@ -107,6 +117,10 @@ public:
    {
       *(*(m_pSRAMmemory+SRAMBANK_VIRT(addr))+SRAMBANK_OFF(addr)) = data;
       m_SRAMdirty = true;
+      if ( nesIsDebuggable() )
+      {
+         SRAMOPCODEWRITTEN ( SRAMBANK_PHYS(addr), SRAMBANK_OFF(addr) );
+      }
    }
    static inline uint32_t SRAMPHYS ( uint32_t addr )
    {
@@ -119,10 +133,15 @@ public:
       {
          m_SRAMdirty = true;
       }
+      if ( nesIsDebuggable() )
+      {
+         SRAMOPCODEWRITTEN ( SRAMBANK_ABSBANK(addr), SRAMBANK_OFF(addr) );
+      }
    }
    static inline void REMAPSRAM ( uint32_t addr, uint8_t bank )
    {
-      *(m_pSRAMmemory+SRAMBANK_VIRT(addr)) = *(m_SRAMmemory+bank);
+      // SRAM bank selects wrap at the PRG-RAM size declared by the ROM header.
+      *(m_pSRAMmemory+SRAMBANK_VIRT(addr)) = *(m_SRAMmemory+(bank%m_numSramBanks));
    }
    static inline uint32_t EXRAMABSADDR ( uint32_t addr )
    {
@@ -135,6 +154,10 @@ public:
    static inline void EXRAM ( uint32_t addr, uint8_t data )
    {
       *(m_EXRAMmemory+(addr-EXRAM_START)) = data;
+      if ( nesIsDebuggable() && (*(m_EXRAMopcodeMask+(addr-EXRAM_START))) )
+      {
+         m_EXRAMopcodeMaskDirty = true;
+      }
    }
 
    // Mapper interfaces [called by emulator through mapperfunc array]
@@ -144,6 +167,10 @@ public:
    {
       return m_mapper;
    }
+   static uint32_t SUBMAPPER ( void )
+   {
+      return m_submapper;
+   }
    static uint32_t HMAPPER ( uint32_t addr )
    {
       return PRGROM(addr);
@@ -163,6 +190,15 @@ public:
    }
    static void SOUNDENABLE ( uint32_t mask ) {}
 
+   // Save or restore the cartridge's RAM and bank mapping.  Mappers
+   // with their own registers save them in their own STATE routine.
+   static void STATE ( CNESState& state );
+
+   // Conversion of pointers into cartridge memory to and from
+   // a form that can be saved in a state snapshot.
+   static uint32_t STATEREF ( uint8_t* ptr );
+   static uint8_t* STATEPTR ( uint32_t ref );
+
    // Code/Data logger support functions
    static inline CCodeDataLogger* LOGGERVIRT ( uint32_t addr )
    {
@@ -196,6 +232,10 @@ public:
    }
    static inline void PRGROMOPCODEMASKATABSADDR ( uint32_t absAddr, uint8_t mask )
    {
+      if ( (*(*(m_PRGROMopcodeMask+PRGBANK_ABSBANK(absAddr))+PRGBANK_OFF(absAddr))) != mask )
+      {
+         *(m_PRGROMopcodeMaskDirty+PRGBANK_ABSBANK(absAddr)) = true;
+      }
       *(*(m_PRGROMopcodeMask+PRGBANK_ABSBANK(absAddr))+PRGBANK_OFF(absAddr)) = mask;
    }
    static inline void PRGROMOPCODEMASKCLR ( void )
@@ -233,6 +273,15 @@ public:
       }
       *(*(m_SRAMopcodeMask+SRAMBANK_PHYS(addr))+SRAMBANK_OFF(addr)) = mask;
    }
+   // Code executed from SRAM may be modified by the CPU.  Only writes to bytes
+   // that have been executed invalidate the bank's disassembly.
+   static inline void SRAMOPCODEWRITTEN ( uint32_t bank, uint32_t offset )
+   {
+      if ( *(*(m_SRAMopcodeMask+bank)+offset) )
+      {
+         *(m_SRAMopcodeMaskDirty+bank) = true;
+      }
+   }
    static inline void SRAMOPCODEMASKCLR ( void )
    {
       int32_t idx1;
@@ -284,7 +333,14 @@ public:
    {
       return m_EXRAMsloc;
    }
+   // Disassembly is cached per physical bank and only regenerated when the
+   // bank is dirty.  DISASSEMBLEVISIBLE only considers the banks currently
+   // mapped into the CPU's address space so it is cheap enough to run on
+   // every debugger update.  DISASSEMBLE walks every bank in the cartridge
+   // and may run on a worker while the emulator is stopped.  The two must
+   // never run at the same time since they share the bank caches.
    static void DISASSEMBLE ();
+   static void DISASSEMBLEVISIBLE ();
 
    // Breakpoint support functions
    static CBreakpointEventInfo** BREAKPOINTEVENTS()
@@ -323,6 +379,8 @@ public:
    }
 
 protected:
+   static uint8_t*   m_PRGROMbuffer;
+   static uint8_t*   m_PRGROMbase;
    static uint8_t**  m_PRGROMmemory;
    static uint8_t**  m_CHRmemory;
    static uint8_t**  m_SRAMmemory;
@@ -330,8 +388,10 @@ protected:
 
    // Mapper stuff...
    static uint32_t           m_mapper;
+   static uint32_t           m_submapper;
    static uint32_t           m_numPrgBanks;
    static uint32_t           m_numChrBanks;
+   static uint32_t           m_numSramBanks;
    static uint8_t* m_pPRGROMmemory [ 4 ];
    static uint8_t* m_pCHRmemory [ 8 ];
    static uint8_t* m_pSRAMmemory [ 5 ];
@@ -109,6 +109,17 @@ void CROMMapper001::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper001::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+   STATESYNC(state,m_regdef);
+   STATESYNC(state,m_sr);
+   STATESYNC(state,m_sel);
+   STATESYNC(state,m_srCount);
+   STATESYNC(state,m_cpuCycleOfLastWrite);
+   STATESYNC(state,m_cpuCycle);
+}
+
 void CROMMapper001::SYNCCPU()
 {
    // This may not be the actual CPU cycle but it doesn't matter.
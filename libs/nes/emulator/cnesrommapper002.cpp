@@ -67,6 +67,11 @@ void CROMMapper002::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper002::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+}
+
 uint32_t CROMMapper002::DEBUGINFO ( uint32_t addr )
 {
    return m_reg;
@@ -142,6 +142,20 @@ void CROMMapper004::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper004::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+   STATESYNC(state,m_irqAsserted);
+   STATESYNC(state,m_irqCounter);
+   STATESYNC(state,m_irqLatch);
+   STATESYNC(state,m_irqEnable);
+   STATESYNC(state,m_irqReload);
+   STATESYNC(state,m_prg);
+   STATESYNC(state,m_chr);
+   STATESYNC(state,m_lastPPUAddrA12);
+   STATESYNC(state,m_lastPPUCycle);
+}
+
 void CROMMapper004::SYNCPPU ( uint32_t ppuCycle, uint32_t ppuAddr )
 {
    bool zero = false;
@@ -10,6 +10,7 @@ public:
    ~CROMMapper004();
 
    static void RESET ( bool soft );
+   static void STATE ( CNESState& state );
    static void HMAPPER ( uint32_t addr, uint8_t data );
    static void SYNCPPU ( uint32_t ppuCycle, uint32_t ppuAddr );
    static void SETCPU ( void );
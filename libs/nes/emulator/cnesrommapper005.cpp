@@ -372,6 +372,40 @@ void CROMMapper005::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper005::STATE ( CNESState& state )
+{
+   bool muted [ 3 ];
+
+   STATESYNC(state,m_prgMode);
+   STATESYNC(state,m_chrMode);
+   STATESYNC(state,m_chrHigh);
+   STATESYNC(state,m_irqScanline);
+   STATESYNC(state,m_irqEnabled);
+   STATESYNC(state,m_irqStatus);
+   STATESYNC(state,m_prgRAM);
+   STATESYNC(state,m_wp);
+   STATESYNC(state,m_ppuCycle);
+   STATESYNC(state,m_chr);
+   STATESYNC(state,m_wp1);
+   STATESYNC(state,m_wp2);
+   STATESYNC(state,m_mult1);
+   STATESYNC(state,m_mult2);
+   STATESYNC(state,m_prod);
+   STATESYNC(state,m_fillTile);
+   STATESYNC(state,m_fillAttr);
+   STATESYNC(state,m_reg);
+
+   // Muting is a user setting, not machine state.
+   muted[0] = m_square[0].MUTED();
+   muted[1] = m_square[1].MUTED();
+   muted[2] = m_dmc.MUTED();
+   STATESYNC(state,m_square);
+   m_dmc.STATE(state);
+   m_square[0].MUTE(muted[0]);
+   m_square[1].MUTE(muted[1]);
+   m_dmc.MUTE(muted[2]);
+}
+
 void CROMMapper005::SYNCCPU ( void )
 {
    m_square[0].TIMERTICK();
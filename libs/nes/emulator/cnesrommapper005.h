@@ -11,6 +11,7 @@ public:
    ~CROMMapper005();
 
    static void RESET ( bool soft );
+   static void STATE ( CNESState& state );
    static uint32_t HMAPPER ( uint32_t addr );
    static void HMAPPER ( uint32_t addr, uint8_t data );
    static uint32_t LMAPPER ( uint32_t addr );
@@ -72,6 +72,11 @@ void CROMMapper007::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper007::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+}
+
 uint32_t CROMMapper007::DEBUGINFO ( uint32_t addr )
 {
    return m_reg;
@@ -117,6 +117,17 @@ void CROMMapper010::RESET ( bool soft )
    m_pCHRmemory [ 7 ] = m_CHRmemory [ (m_latch1FE<<2)+3 ];
 }
 
+void CROMMapper010::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+   STATESYNC(state,m_latch0);
+   STATESYNC(state,m_latch1);
+   STATESYNC(state,m_latch0FD);
+   STATESYNC(state,m_latch0FE);
+   STATESYNC(state,m_latch1FD);
+   STATESYNC(state,m_latch1FE);
+}
+
 uint32_t CROMMapper010::DEBUGINFO ( uint32_t addr )
 {
    switch ( addr&0xF000 )
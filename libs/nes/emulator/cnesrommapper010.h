@@ -10,6 +10,7 @@ public:
    ~CROMMapper010();
 
    static void RESET ( bool soft );
+   static void STATE ( CNESState& state );
    static void HMAPPER ( uint32_t addr, uint8_t data );
    static void SYNCPPU ( uint32_t ppuCycle, uint32_t ppuAddr );
    static uint32_t DEBUGINFO ( uint32_t addr );
@@ -68,6 +68,11 @@ void CROMMapper011::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper011::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+}
+
 uint32_t CROMMapper011::DEBUGINFO ( uint32_t addr )
 {
    return m_reg;
@@ -67,6 +67,11 @@ void CROMMapper013::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper013::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+}
+
 uint32_t CROMMapper013::DEBUGINFO ( uint32_t addr )
 {
    return m_reg;
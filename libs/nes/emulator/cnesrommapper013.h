@@ -10,6 +10,7 @@ public:
    ~CROMMapper013();
 
    static void RESET ( bool soft );
+   static void STATE ( CNESState& state );
    static void HMAPPER ( uint32_t addr, uint8_t data );
    static uint32_t DEBUGINFO ( uint32_t addr );
 
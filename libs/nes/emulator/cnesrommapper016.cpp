@@ -154,6 +154,20 @@ void CROMMapper016::RESET159 ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper016::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+   STATESYNC(state,m_irqCounter);
+   STATESYNC(state,m_irqEnabled);
+   STATESYNC(state,m_irqAsserted);
+   STATESYNC(state,m_eepromBitCounter);
+   STATESYNC(state,m_eepromState);
+   STATESYNC(state,m_eepromCmd);
+   STATESYNC(state,m_eepromAddr);
+   STATESYNC(state,m_eepromDataBuf);
+   STATESYNC(state,m_eepromRWBit);
+}
+
 void CROMMapper016::SYNCCPU ( void )
 {
    if ( m_irqEnabled )
@@ -11,6 +11,7 @@ public:
 
    static void RESET016 ( bool soft );
    static void RESET159 ( bool soft );
+   static void STATE ( CNESState& state );
    static void HMAPPER ( uint32_t addr, uint8_t data );
    static uint32_t LMAPPER ( uint32_t addr );
    static void LMAPPER ( uint32_t addr, uint8_t data );
@@ -166,6 +166,16 @@ void CROMMapper018::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper018::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+   STATESYNC(state,m_prg);
+   STATESYNC(state,m_chr);
+   STATESYNC(state,m_irqReload);
+   STATESYNC(state,m_irqCounter);
+   STATESYNC(state,m_irqEnabled);
+}
+
 void CROMMapper018::SYNCCPU ( void )
 {
    uint16_t counterMask;
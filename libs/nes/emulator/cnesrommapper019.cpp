@@ -150,6 +150,30 @@ void CROMMapper019::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper019::STATE ( CNESState& state )
+{
+   bool    muted;
+   int32_t idx;
+
+   STATESYNC(state,m_reg);
+   STATESYNC(state,m_chr);
+   STATESYNC(state,m_irqCounter);
+   STATESYNC(state,m_irqEnabled);
+   STATESYNC(state,m_soundRAM);
+   STATESYNC(state,m_soundRAMAddr);
+   STATESYNC(state,m_soundChansEnabled);
+
+   // The channels point at the sound RAM and have a user mute setting,
+   // neither of which are machine state.
+   for ( idx = 0; idx < 8; idx++ )
+   {
+      muted = m_wave[idx].muted;
+      STATESYNC(state,m_wave[idx]);
+      m_wave[idx].muted = muted;
+      m_wave[idx].SOUNDRAM(m_soundRAM);
+   }
+}
+
 void CROMMapper019::SYNCCPU ( void )
 {
    int32_t idx;
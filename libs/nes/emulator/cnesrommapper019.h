@@ -90,6 +90,7 @@ public:
    ~CROMMapper019();
 
    static void RESET ( bool soft );
+   static void STATE ( CNESState& state );
    static uint32_t LMAPPER ( uint32_t addr );
    static void LMAPPER ( uint32_t addr, uint8_t data );
    static void HMAPPER ( uint32_t addr, uint8_t data );
@@ -104,6 +104,12 @@ void CROMMapper022::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper022::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+   STATESYNC(state,m_chr);
+}
+
 uint32_t CROMMapper022::DEBUGINFO ( uint32_t addr )
 {
    switch ( addr )
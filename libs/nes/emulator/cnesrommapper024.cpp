@@ -173,6 +173,29 @@ void CROMMapper024::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper024::STATE ( CNESState& state )
+{
+   bool muted [ 3 ];
+
+   STATESYNC(state,m_reg);
+   STATESYNC(state,m_chr);
+   STATESYNC(state,m_irqReload);
+   STATESYNC(state,m_irqCounter);
+   STATESYNC(state,m_irqPrescaler);
+   STATESYNC(state,m_irqPrescalerPhase);
+   STATESYNC(state,m_irqEnabled);
+
+   // Muting is a user setting, not machine state.
+   muted[0] = m_pulse[0].muted;
+   muted[1] = m_pulse[1].muted;
+   muted[2] = m_sawtooth.muted;
+   STATESYNC(state,m_pulse);
+   STATESYNC(state,m_sawtooth);
+   m_pulse[0].muted = muted[0];
+   m_pulse[1].muted = muted[1];
+   m_sawtooth.muted = muted[2];
+}
+
 void CROMMapper024::SYNCCPU ( void )
 {
    uint8_t phases[3] = { 114, 114, 113 };
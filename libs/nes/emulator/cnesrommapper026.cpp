@@ -171,6 +171,17 @@ void CROMMapper026::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper026::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+   STATESYNC(state,m_chr);
+   STATESYNC(state,m_irqReload);
+   STATESYNC(state,m_irqCounter);
+   STATESYNC(state,m_irqPrescaler);
+   STATESYNC(state,m_irqPrescalerPhase);
+   STATESYNC(state,m_irqEnabled);
+}
+
 void CROMMapper026::SYNCCPU ( void )
 {
    uint8_t phases[3] = { 114, 114, 113 };
@@ -72,6 +72,17 @@ void CROMMapper028::RESET ( bool soft )
    }
 }
 
+void CROMMapper028::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_chr_bank);
+   STATESYNC(state,m_prg_inner_bank);
+   STATESYNC(state,m_prg_size);
+   STATESYNC(state,m_prg_mode);
+   STATESYNC(state,m_mirror);
+   STATESYNC(state,m_prg_outer_bank);
+   STATESYNC(state,m_bank_size_mask);
+}
+
 void CROMMapper028::SETCPU ( void )
 {
    uint8_t bank[2];
@@ -111,6 +111,11 @@ void CROMMapper033::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper033::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+}
+
 uint32_t CROMMapper033::DEBUGINFO ( uint32_t addr )
 {
    switch ( addr&0xA003 )
@@ -88,9 +88,20 @@ void CROMMapper034::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper034::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+}
+
+// Mapper 34 is two unrelated boards.  NES 2.0 submapper 1 is the AVE NINA-001,
+// which has its registers at $7FFD-$7FFF, and submapper 2 is BNROM, which has
+// its bank register at $8000-$FFFF.  Without a submapper both are emulated.
+#define NINA001() ( m_submapper != 2 )
+#define BNROM() ( m_submapper != 1 )
+
 uint32_t CROMMapper034::LMAPPER ( uint32_t addr )
 {
-   if ( (addr >= 0x7ffd) && (addr < 0x8000) )
+   if ( NINA001() && (addr >= 0x7ffd) && (addr < 0x8000) )
    {
       return m_reg[addr-0x7ffd];
    }
@@ -104,7 +115,7 @@ void CROMMapper034::LMAPPER ( uint32_t addr, uint8_t data )
 {
    uint8_t bank;
 
-   if ( (addr >= 0x7ffd) && (addr < 0x8000) )
+   if ( NINA001() && (addr >= 0x7ffd) && (addr < 0x8000) )
    {
       m_reg[addr-0x7ffd] = data;
 
@@ -157,6 +168,11 @@ void CROMMapper034::HMAPPER ( uint32_t addr, uint8_t data )
 {
    uint8_t bank;
 
+   if ( !BNROM() )
+   {
+      return;
+   }
+
    m_reg[3] = data%m_numPrgBanks;
 
    bank = m_reg[3]<<2;
@@ -120,6 +120,14 @@ void CROMMapper065::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper065::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+   STATESYNC(state,m_irqCounter);
+   STATESYNC(state,m_irqEnable);
+   STATESYNC(state,m_irqReload);
+}
+
 void CROMMapper065::SYNCCPU ( void )
 {
    if ( m_irqEnable )
@@ -98,6 +98,11 @@ void CROMMapper068::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper068::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+}
+
 uint32_t CROMMapper068::DEBUGINFO ( uint32_t addr )
 {
    switch ( addr&0xF000 )
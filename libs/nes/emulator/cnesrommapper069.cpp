@@ -117,6 +117,20 @@ void CROMMapper069::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper069::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+   STATESYNC(state,m_subReg);
+   STATESYNC(state,m_irqAsserted);
+   STATESYNC(state,m_irqCounter);
+   STATESYNC(state,m_irqEnable);
+   STATESYNC(state,m_irqCountEnable);
+   STATESYNC(state,m_prg);
+   STATESYNC(state,m_chr);
+   STATESYNC(state,m_sramAreaIsSram);
+   STATESYNC(state,m_sramAreaEnabled);
+}
+
 void CROMMapper069::SYNCCPU ( void )
 {
    uint32_t prevCounter = m_irqCounter;
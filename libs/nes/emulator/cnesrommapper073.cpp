@@ -116,6 +116,14 @@ void CROMMapper073::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper073::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+   STATESYNC(state,m_irqReload);
+   STATESYNC(state,m_irqCounter);
+   STATESYNC(state,m_irqEnabled);
+}
+
 void CROMMapper073::SYNCCPU ( void )
 {
    uint16_t counterMask;
@@ -106,6 +106,13 @@ void CROMMapper075::RESET ( bool soft )
    // CHR ROM/RAM already set up in CROM::RESET()...
 }
 
+void CROMMapper075::STATE ( CNESState& state )
+{
+   STATESYNC(state,m_reg);
+   STATESYNC(state,m_prg);
+   STATESYNC(state,m_chr);
+}
+
 void CROMMapper075::SETCPU ( void )
 {
    m_pPRGROMmemory [ 0 ] = m_PRGROMmemory [ m_prg[0] ];
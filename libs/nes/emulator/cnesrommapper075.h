@@ -10,6 +10,7 @@ public:
    ~CROMMapper075();
 
    static void RESET ( bool soft );
+   static void STATE ( CNESState& state );
    static void HMAPPER ( uint32_t addr, uint8_t data );
    static void SETCPU ( void );
    static void SETPPU ( void );
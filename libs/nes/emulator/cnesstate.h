@@ -0,0 +1,110 @@
+#if !defined ( NES_STATE_H )
+#define NES_STATE_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Snapshot identification.  The version must be bumped whenever a
+// STATE routine changes what it saves.
+#define NES_STATE_MAGIC   0x4154534E // 'NSTA'
+#define NES_STATE_VERSION 2
+
+// The CNESState class is the stream used to take and restore a complete
+// snapshot of the emulated machine.  Each emulator object has a STATE
+// routine that passes every piece of its state through SYNC, in a fixed
+// order, so the same routine serves for both saving and loading.  Saving
+// into a NULL buffer just measures the size of the snapshot.
+//
+// Snapshots are raw copies of the emulator's internal variables so they
+// are only valid for the emulator version that took them.
+class CNESState
+{
+public:
+   CNESState ( uint8_t* buffer, uint32_t size, bool saving )
+      : m_buffer(buffer),
+        m_size(size),
+        m_cursor(0),
+        m_saving(saving),
+        m_error(false)
+   {
+   }
+
+   inline void SYNC ( void* data, uint32_t size )
+   {
+      if ( m_saving )
+      {
+         if ( m_buffer && (m_cursor+size <= m_size) )
+         {
+            memcpy ( m_buffer+m_cursor, data, size );
+         }
+         else if ( m_buffer )
+         {
+            m_error = true;
+         }
+      }
+      else
+      {
+         if ( m_cursor+size <= m_size )
+         {
+            memcpy ( data, m_buffer+m_cursor, size );
+         }
+         else
+         {
+            m_error = true;
+         }
+      }
+      m_cursor += size;
+   }
+
+   inline bool SAVING ( void ) const
+   {
+      return m_saving;
+   }
+   inline bool LOADING ( void ) const
+   {
+      return !m_saving;
+   }
+   inline uint32_t SIZE ( void ) const
+   {
+      return m_cursor;
+   }
+   inline bool OVERRUN ( void ) const
+   {
+      return m_error;
+   }
+
+   // Marks a snapshot being loaded as unusable, for example when it
+   // refers to memory the running cartridge doesn't have.
+   inline void FAIL ( void )
+   {
+      m_error = true;
+   }
+
+protected:
+   uint8_t* m_buffer;
+   uint32_t m_size;
+   uint32_t m_cursor;
+   bool     m_saving;
+   bool     m_error;
+};
+
+// Passes a variable or array through the state stream.
+#define STATESYNC(state,var) (state).SYNC(&(var),sizeof(var))
+
+// Pointers into emulated memory can't be saved as-is.  They are saved
+// as a reference to the memory region they point into and an offset
+// within that region.
+enum
+{
+   STATE_REGION_NULL = 0,
+   STATE_REGION_PRGROM,
+   STATE_REGION_CHRMEM,
+   STATE_REGION_SRAM,
+   STATE_REGION_EXRAM,
+   STATE_REGION_VRAM
+};
+#define STATE_REF(region,offset) ( ((region)<<24)|((offset)&0xFFFFFF) )
+#define STATE_REF_REGION(ref) ( (ref)>>24 )
+#define STATE_REF_OFFSET(ref) ( (ref)&0xFFFFFF )
+
+#endif
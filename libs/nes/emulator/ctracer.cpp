@@ -63,6 +63,11 @@ TracerInfo* CTracer::AddSample(uint32_t cycle, int8_t type, int8_t source, int8_
    TracerInfo* pTargetSample = NULL;
    int8_t      overwrittenSource;
 
+   if ( nesIsCounting() )
+   {
+      __nescounters.tracerSamples++;
+   }
+
    // Save overwritten sample's type to adjust
    // sample counts later on...
    overwrittenSource = pSample->source;
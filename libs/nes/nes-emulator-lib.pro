@@ -109,6 +109,7 @@ HEADERS +=\
    emulator/cnesrommapper001.h \
    emulator/cnesrom.h \
    emulator/cnesppu.h \
+   emulator/cnesstate.h \
    emulator/cnesmappers.h \
    emulator/cnesio.h \
    emulator/cnesapu.h \
@@ -5,6 +5,7 @@
 #include "cnesppu.h"
 #include "cnesapu.h"
 #include "cnes6502.h"
+#include "cnesmappers.h"
 #include "cnesrommapper001.h"
 #include "cnesrommapper004.h"
 #include "cnesrommapper009.h"
@@ -42,6 +43,27 @@ void nesDisableDebug ( void )
    __nesdebug = false;
 }
 
+bool __nescounting = false;
+NESCounters __nescounters = { 0, 0, 0, 0 };
+
+void nesEnableCounters ( bool enable )
+{
+   __nescounting = enable;
+
+   // Mapper calls are counted by swapping in a wrapper table.
+   MAPPERCOUNTING ( enable );
+}
+
+void nesResetCounters ( void )
+{
+   memset ( &__nescounters, 0, sizeof(__nescounters) );
+}
+
+void nesGetCounters ( NESCounters* counters )
+{
+   (*counters) = __nescounters;
+}
+
 void nesSetBreakOnKIL ( bool breakOnKIL )
 {
    C6502::BREAKONKIL(breakOnKIL);
@@ -346,6 +368,11 @@ void nesDisassemble ()
    CNES::DISASSEMBLE();
 }
 
+void nesDisassembleAllBanks ()
+{
+   CROM::DISASSEMBLE();
+}
+
 void nesDisassembleSingle ( uint8_t* pOpcode, char* buffer )
 {
    C6502::Disassemble(pOpcode,buffer);
@@ -411,11 +438,132 @@ void nesLoadPRGROMBank ( uint32_t bank, uint8_t* bankData )
    CROM::SetPRGBank ( bank, bankData );
 }
 
+void nesLoadPRGROM ( uint8_t* prgRom, uint32_t numBanks )
+{
+   CROM::SetPRGROM ( prgRom, numBanks );
+}
+
 void nesLoadCHRROMBank ( uint32_t bank, uint8_t* bankData )
 {
    CROM::SetCHRBank ( bank, bankData );
 }
 
+void nesSetSubmapper ( uint32_t submapper )
+{
+   CROM::SetSubmapper ( submapper );
+}
+
+void nesSetPRGRAMSize ( uint32_t size )
+{
+   CROM::SetPRGRAMSize ( size );
+}
+
+static uint64_t nes2ROMSize ( uint8_t lsb, uint8_t msb, uint32_t units )
+{
+   uint64_t multiplier;
+   uint32_t exponent;
+
+   if ( msb == 0x0F )
+   {
+      // Exponent-multiplier notation: 2^E * (MM*2+1) bytes.  No image is
+      // 4GB or more so larger exponents are clamped to keep the product
+      // in range, the caller rejects it against the image size.
+      exponent = lsb>>2;
+      multiplier = ((lsb&0x03)<<1)+1;
+      if ( exponent > 32 )
+      {
+         exponent = 32;
+      }
+      return (((uint64_t)1)<<exponent)*multiplier;
+   }
+
+   return ((uint64_t)((msb<<8)|lsb))*units;
+}
+
+static uint32_t nes2RAMSize ( uint8_t shift )
+{
+   // A shift count of zero means no RAM, otherwise 64 << shift bytes.
+   return shift ? (64<<shift) : 0;
+}
+
+bool nesParseROMHeader ( uint8_t* image, uint32_t imageSize, NESROMHeader* header )
+{
+   uint32_t id;
+   uint64_t prgRomSize;
+   uint64_t chrRomSize;
+
+   if ( imageSize < INES_HEADER_SIZE )
+   {
+      return false;
+   }
+
+   id = image[0]|(image[1]<<8)|(image[2]<<16)|(image[3]<<24);
+   if ( id != INES_HEADER_ID )
+   {
+      return false;
+   }
+
+   // Flags common to iNES 1.0 and NES 2.0 [header byte 6].
+   header->verticalMirroring = ((image[6]&FLAG_MIRROR) == FLAG_MIRROR_VERT);
+   header->fourScreen = ((image[6]&FLAG_VRAM) == FLAG_FOURSCREEN_VRAM);
+   header->batteryBackedRam = ((image[6]&FLAG_SRAM) == FLAG_SRAM_ENABLED);
+   header->trainer = ((image[6]&FLAG_TRAINER) != FLAG_NO_TRAINER);
+   header->nes2 = ((image[7]&NES2_HEADER_MASK) == NES2_HEADER_ID);
+
+   if ( header->nes2 )
+   {
+      header->mapper = ((image[6]>>4)&0x0F)|(image[7]&0xF0)|((image[8]&0x0F)<<8);
+      header->submapper = (image[8]>>4)&0x0F;
+      prgRomSize = nes2ROMSize(image[4],image[9]&0x0F,MEM_16KB);
+      chrRomSize = nes2ROMSize(image[5],(image[9]>>4)&0x0F,MEM_8KB);
+      header->prgRamSize = nes2RAMSize(image[10]&0x0F);
+      header->prgNvramSize = nes2RAMSize((image[10]>>4)&0x0F);
+      header->chrRamSize = nes2RAMSize(image[11]&0x0F);
+      header->chrNvramSize = nes2RAMSize((image[11]>>4)&0x0F);
+      header->timing = image[12]&0x03;
+   }
+   else
+   {
+      // iNES 1.0 headers with garbage in bytes 7-15 (for example "DiskDude!")
+      // only have reliable lower mapper nibbles.
+      if ( image[7]&0x0F )
+      {
+         header->mapper = (image[6]>>4)&0x0F;
+      }
+      else
+      {
+         header->mapper = ((image[6]>>4)&0x0F)|(image[7]&0xF0);
+      }
+      header->submapper = 0;
+      prgRomSize = image[4]*MEM_16KB;
+      chrRomSize = image[5]*MEM_8KB;
+
+      // Byte 8 is left 0 by most iNES 1.0 dumps so the PRG-RAM size is
+      // unknown.  Mappers that bank PRG-RAM get all of it.
+      header->prgRamSize = 0;
+      header->prgNvramSize = 0;
+      header->chrRamSize = chrRomSize?0:MEM_8KB;
+      header->chrNvramSize = 0;
+      header->timing = NES2_TIMING_NTSC;
+   }
+
+   // Make sure the image actually contains what the header says it does.
+   // Each size is checked on its own first so adding them up can't wrap.
+   header->prgRomOffset = INES_HEADER_SIZE+(header->trainer?INES_TRAINER_SIZE:0);
+   if ( (prgRomSize == 0) ||
+        (prgRomSize > imageSize) ||
+        (chrRomSize > imageSize) ||
+        (header->prgRomOffset+prgRomSize+chrRomSize > imageSize) )
+   {
+      return false;
+   }
+   header->prgRomSize = (uint32_t)prgRomSize;
+   header->chrRomSize = (uint32_t)chrRomSize;
+   header->chrRomOffset = header->prgRomOffset+header->prgRomSize;
+
+   return true;
+}
+
 void nesLoadROM ( void )
 {
    CROM::DoneLoadingBanks();
@@ -446,9 +594,21 @@ void nesReset ( bool soft )
    CNES::RESET(CROM::MAPPER(),soft);
 }
 
-void nesResetInitial ( uint32_t mapper )
+bool nesIsMapperSupported ( uint32_t mapper )
+{
+   // Mappers beyond the iNES 1.0 range aren't emulated.
+   return mapper <= 255;
+}
+
+bool nesResetInitial ( uint32_t mapper )
 {
+   if ( !nesIsMapperSupported(mapper) )
+   {
+      return false;
+   }
+
    CNES::RESET(mapper,false);
+   return true;
 }
 
 void nesRun ( uint32_t* joypads )
@@ -456,6 +616,48 @@ void nesRun ( uint32_t* joypads )
    CNES::RUN(joypads);
 }
 
+uint32_t nesSaveState ( uint8_t* buffer, uint32_t size )
+{
+   CNESState state(buffer,size,true);
+
+   CNES::STATE(state);
+   if ( state.OVERRUN() )
+   {
+      return 0;
+   }
+   return state.SIZE();
+}
+
+bool nesLoadState ( uint8_t* buffer, uint32_t size )
+{
+   CNESState measure(NULL,0,true);
+   CNESState state(buffer,size,false);
+   uint8_t*  backup;
+   bool      loaded;
+
+   // Refuse a snapshot of the wrong size up front.
+   CNES::STATE(measure);
+   if ( (!buffer) || (size != measure.SIZE()) )
+   {
+      return false;
+   }
+
+   // A snapshot can still turn out to be unusable part way through,
+   // so keep the current state to put back if it does.
+   backup = new uint8_t [ size ];
+   CNESState save(backup,size,true);
+   CNES::STATE(save);
+
+   loaded = CNES::STATE(state);
+   if ( !loaded )
+   {
+      CNESState restore(backup,size,false);
+      CNES::STATE(restore);
+   }
+   delete [] backup;
+   return loaded;
+}
+
 uint8_t* nesGetAudioSamples ( uint16_t samples )
 {
    return CAPU::PLAY(samples);
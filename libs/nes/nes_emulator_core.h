@@ -347,6 +347,43 @@ enum
 };
 
 #define INES_HEADER_ID 0x1a53454e
+#define INES_HEADER_SIZE 16
+#define INES_TRAINER_SIZE 512
+
+// NES 2.0 is identified by bits 2-3 of header byte 7 being 10b.
+#define NES2_HEADER_MASK 0x0C
+#define NES2_HEADER_ID   0x08
+
+// NES 2.0 CPU/PPU timing modes [header byte 12].
+enum
+{
+   NES2_TIMING_NTSC = 0,
+   NES2_TIMING_PAL,
+   NES2_TIMING_MULTI,
+   NES2_TIMING_DENDY
+};
+
+// Cartridge description extracted from an iNES 1.0 or NES 2.0 header.
+// Sizes are in bytes and offsets are from the start of the ROM image.
+typedef struct _NESROMHeader
+{
+   bool     nes2;
+   uint32_t mapper;
+   uint32_t submapper;
+   uint32_t prgRomSize;
+   uint32_t chrRomSize;
+   uint32_t prgRamSize;
+   uint32_t prgNvramSize;
+   uint32_t chrRamSize;
+   uint32_t chrNvramSize;
+   uint32_t timing;
+   bool     verticalMirroring;
+   bool     fourScreen;
+   bool     batteryBackedRam;
+   bool     trainer;
+   uint32_t prgRomOffset;
+   uint32_t chrRomOffset;
+} NESROMHeader;
 
 // Supported NES input (controller) types:
 // Standard joypad
@@ -472,7 +509,12 @@ char* nesGetVersion();
 // 3. Clear any emulation state by using nesUnloadROM().
 // 4. Pass 16KB PRG-ROM banks in order and 8KB CHR-ROM banks in order to the emulation
 //    core by using nesLoadPRGROMBank() and nesLoadCHRROMBank() respectively.  If no
-//    CHR-ROM banks are present, do not call nesLoadCHRROMBank().
+//    CHR-ROM banks are present, do not call nesLoadCHRROMBank().  Alternatively the
+//    whole PRG-ROM can be handed over with nesLoadPRGROM(), in which case the core
+//    reads it in place instead of copying it; the memory must stay valid until the
+//    next nesUnloadROM().  nesParseROMHeader() decodes iNES 1.0 and NES 2.0 headers.
+//    For NES 2.0 ROMs also pass on the submapper and PRG-RAM size using nesSetSubmapper()
+//    and nesSetPRGRAMSize().  A PRG-RAM size of 0 means the size is unknown.
 // 5. If the game has fixed mirroring, tell the emulator core which one it is by
 //    using nesSetHorizontalMirroring() or nesSetVerticalMirroring().
 // 6. Tell the emulator core you're done passing it ROM data by using
@@ -495,13 +537,18 @@ void nesSetSystemMode ( uint32_t mode );
 uint32_t nesGetSystemMode ( void );
 void nesSetTVOut ( int8_t* tv );
 void nesUnloadROM ( void );
+bool nesParseROMHeader ( uint8_t* image, uint32_t imageSize, NESROMHeader* header );
 void nesLoadPRGROMBank ( uint32_t bank, uint8_t* bankData );
+void nesLoadPRGROM ( uint8_t* prgRom, uint32_t numBanks );
 void nesLoadCHRROMBank ( uint32_t bank, uint8_t* bankData );
+void nesSetSubmapper ( uint32_t submapper );
+void nesSetPRGRAMSize ( uint32_t size );
 void nesSetHorizontalMirroring ( void );
 void nesSetVerticalMirroring ( void );
 void nesSetFourScreen ( void );
 void nesLoadROM ( void );
-void nesResetInitial ( uint32_t mapper );
+bool nesIsMapperSupported ( uint32_t mapper );
+bool nesResetInitial ( uint32_t mapper );
 void nesReset ( bool soft );
 void nesRun ( uint32_t* joypads );
 int32_t nesGetAudioSamplesAvailable ( void );
@@ -512,12 +559,39 @@ void nesSetControllerScreenPosition ( int32_t port, int32_t px, int32_t py, int3
 void nesSetControllerSpecial ( int32_t port, int32_t special );
 bool nesROMIsLoaded ( void );
 
+// State snapshot interfaces.
+// A snapshot holds the complete state of the emulated NES and can only be
+// taken or restored between calls to nesRun().  Snapshots are only valid for
+// the emulator version and ROM that produced them.  nesSaveState() returns the
+// number of bytes written, or the number of bytes needed if buffer is NULL,
+// or 0 if the buffer is too small.  nesLoadState() leaves the NES untouched
+// and returns false if the snapshot doesn't fit the running emulator.
+uint32_t nesSaveState ( uint8_t* buffer, uint32_t size );
+bool nesLoadState ( uint8_t* buffer, uint32_t size );
+
 // Internal debug interfaces.
 extern bool __nesdebug;
 #define nesIsDebuggable() ( __nesdebug )
 void nesBreak ( void );
 void nesBreakAudio ( void );
 
+// Performance counter interfaces.
+// Counting is off by default so normal emulation pays nothing for it.
+typedef struct _NESCounters
+{
+   uint64_t mapperCalls;
+   uint64_t breakpointChecks;
+   uint64_t tracerSamples;
+   uint64_t apuSamples;
+} NESCounters;
+
+extern bool __nescounting;
+extern NESCounters __nescounters;
+#define nesIsCounting() ( __nescounting )
+void nesEnableCounters ( bool enable );
+void nesResetCounters ( void );
+void nesGetCounters ( NESCounters* counters );
+
 CBreakpointInfo* nesGetBreakpointDatabase ( void );
 CBreakpointEventInfo** nesGetCpuBreakpointEventDatabase ( void );
 int32_t nesGetSizeOfCpuBreakpointEventDatabase ( void );
@@ -561,6 +635,7 @@ void nesSetN106AudioChannelMask ( uint32_t mask );
 void nesSetAudioChannelMask ( uint8_t mask );
 uint8_t nesGetMemory ( uint32_t addr );
 void nesDisassemble ();
+void nesDisassembleAllBanks ();
 void nesDisassembleSingle ( uint8_t* pOpcode, char* buffer );
 char* nesGetDisassemblyAtAddress ( uint32_t addr );
 void nesGetDisassemblyAtAbsoluteAddress ( uint32_t absAddr, char* buffer );